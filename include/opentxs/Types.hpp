@@ -28,6 +28,8 @@
 
 #define OPENTXS_ARG_BACKUP_DIRECTORY "backupdirectory"
 #define OPENTXS_ARG_BINDIP "bindip"
+#define OPENTXS_ARG_BLOCK_FILE_SIZE "blockfilesize"
+#define OPENTXS_ARG_BLOCK_PRUNE "blockprune"
 #define OPENTXS_ARG_BLOCK_STORAGE_LEVEL "blockstoragelevel"
 #define OPENTXS_ARG_COMMANDPORT "commandport"
 #define OPENTXS_ARG_EEP "eep"
@@ -52,6 +54,7 @@
 #define OPENTXS_ARG_TERMS "terms"
 #define OPENTXS_ARG_VERSION "version"
 #define OPENTXS_ARG_WORDS "words"
+#define OPENTXS_ARG_WORKERS "workers"
 
 namespace opentxs
 {
@@ -357,6 +360,13 @@ enum class StorageBox : std::uint8_t {
     UNKNOWN = 255,
 };
 
+/** Type of change announced by the activity thread publisher */
+enum class ThreadUpdate : std::uint8_t {
+    Added = 0,
+    Changed = 1,
+    Removed = 2,
+};
+
 enum class EcdsaCurve : std::uint8_t {
     invalid = 0,
     secp256k1 = 1,
@@ -189,6 +189,15 @@ public:
     OPENTXS_EXPORT virtual std::shared_ptr<proto::StorageThread> Thread(
         const identifier::Nym& nymID,
         const Identifier& threadID) const noexcept = 0;
+    /**   Load a single item from an activity thread
+     *
+     *    Returns nullptr if the thread or item does not exist
+     */
+    OPENTXS_EXPORT virtual std::shared_ptr<proto::StorageThreadItem>
+    ThreadItem(
+        const identifier::Nym& nymID,
+        const Identifier& threadID,
+        const Identifier& itemID) const noexcept = 0;
     /**   Obtain a list of thread ids for the specified nym
      *
      *    \param[in] nym the identifier of the nym
@@ -204,6 +213,13 @@ public:
     OPENTXS_EXPORT virtual std::size_t UnreadCount(
         const identifier::Nym& nym) const noexcept = 0;
 
+    /**   Endpoint which announces changes to the nym's activity threads
+     *
+     *    The first frame of each message contains the thread id. If a second
+     *    frame is present it contains a ThreadUpdate value and the remaining
+     *    frames contain the ids of the affected items. Otherwise the entire
+     *    thread should be reloaded.
+     */
     OPENTXS_EXPORT virtual std::string ThreadPublisher(
         const identifier::Nym& nym) const noexcept = 0;
 
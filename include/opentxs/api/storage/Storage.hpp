@@ -47,6 +47,7 @@ class Purse;
 class Seed;
 class ServerContract;
 class StorageThread;
+class StorageThreadItem;
 class UnitDefinition;
 }  // namespace proto
 
@@ -260,6 +261,11 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         std::shared_ptr<proto::StorageThread>& thread) const = 0;
+    OPENTXS_EXPORT virtual bool Load(
+        const std::string& nymId,
+        const std::string& threadId,
+        const std::string& itemId,
+        std::shared_ptr<proto::StorageThreadItem>& item) const = 0;
     OPENTXS_EXPORT virtual bool Load(
         std::shared_ptr<proto::Ciphertext>& output,
         const bool checking = false) const = 0;
@@ -10,6 +10,7 @@
 
 #include <cstdint>
 #include <ctime>
+#include <vector>
 
 #if OT_CASH
 #include "opentxs/core/Contract.hpp"
@@ -84,6 +85,14 @@ public:
         const identity::Nym& notary,
         const blind::Token& token,
         const PasswordPrompt& reason) = 0;
+    /**   Verify the signatures of several tokens concurrently
+     *
+     *    \returns One result for each input token, in the same order
+     */
+    OPENTXS_EXPORT virtual std::vector<bool> VerifyTokens(
+        const identity::Nym& notary,
+        const std::vector<const blind::Token*>& tokens,
+        const PasswordPrompt& reason) = 0;
 
     OPENTXS_EXPORT ~Mint() override = default;
 
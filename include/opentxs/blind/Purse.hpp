@@ -12,6 +12,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 #if OT_CASH
 #include "opentxs/Pimpl.hpp"
@@ -78,6 +79,14 @@ public:
         const PasswordPrompt& reason) const = 0;
     OPENTXS_EXPORT virtual bool Verify(
         const api::server::internal::Manager& server) const = 0;
+    /**   Verify the signatures of every token using the notary's mints
+     *
+     *    \returns One result for each token in the purse, in the same order
+     */
+    OPENTXS_EXPORT virtual std::vector<bool> VerifyTokens(
+        const api::server::internal::Manager& server,
+        const identity::Nym& notary,
+        const PasswordPrompt& reason) const = 0;
     OPENTXS_EXPORT virtual Amount Value() const = 0;
 
     OPENTXS_EXPORT virtual bool AddNym(
@@ -23,7 +23,7 @@ namespace opentxs
 class Flag
 {
 public:
-    static OTFlag Factory(const bool state);
+    OPENTXS_EXPORT static OTFlag Factory(const bool state);
 
     virtual operator bool() const = 0;
 
@@ -11,6 +11,7 @@
 #include <irrxml/irrXML.hpp>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -71,6 +72,11 @@ using listOfLongNumbers = std::list<std::int64_t>;
 class OTCron final : public Contract
 {
 public:
+    /** Returns an object which holds whatever locks are needed to process the
+     * item for as long as the object exists. */
+    using ItemLock =
+        std::function<std::shared_ptr<const void>(const OTCronItem&)>;
+
     static std::chrono::milliseconds GetCronMsBetweenProcess()
     {
         return __cron_ms_between_process;
@@ -152,7 +158,7 @@ public:
      * ProcessCronItems() call, and all the trades and payment plans within,
      * since it will not be replenished again at least until the call has
      * finished.) */
-    void ProcessCronItems();
+    void ProcessCronItems(const ItemLock& lock = {});
 
     std::chrono::milliseconds computeTimeout();
 
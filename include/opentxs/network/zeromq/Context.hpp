@@ -168,7 +168,9 @@ public:
         const std::string& endpoint) const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::Pipeline> Pipeline(
         const api::internal::Core& api,
-        std::function<void(zeromq::Message&)> callback) const noexcept = 0;
+        std::function<void(zeromq::Message&)> callback,
+        const socket::Socket::Threading threading =
+            socket::Socket::Threading::Dedicated) const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::Proxy> Proxy(
         socket::Socket& frontend,
         socket::Socket& backend) const noexcept = 0;
@@ -178,21 +180,28 @@ public:
         const socket::Socket::Direction direction) const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::socket::Pull> PullSocket(
         const ListenCallback& callback,
-        const socket::Socket::Direction direction) const noexcept = 0;
+        const socket::Socket::Direction direction,
+        const socket::Socket::Threading threading =
+            socket::Socket::Threading::Dedicated) const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::socket::Push> PushSocket(
         const socket::Socket::Direction direction) const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::Message> ReplyMessage(
         const zeromq::Message& request) const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::socket::Reply> ReplySocket(
         const ReplyCallback& callback,
-        const socket::Socket::Direction direction) const noexcept = 0;
+        const socket::Socket::Direction direction,
+        const socket::Socket::Threading threading =
+            socket::Socket::Threading::Dedicated) const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::socket::Request>
     RequestSocket() const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::socket::Router> RouterSocket(
         const ListenCallback& callback,
         const socket::Socket::Direction direction) const noexcept = 0;
     OPENTXS_EXPORT virtual Pimpl<network::zeromq::socket::Subscribe>
-    SubscribeSocket(const ListenCallback& callback) const noexcept = 0;
+    SubscribeSocket(
+        const ListenCallback& callback,
+        const socket::Socket::Threading threading =
+            socket::Socket::Threading::Dedicated) const noexcept = 0;
 
     OPENTXS_EXPORT virtual ~Context() = default;
 
@@ -97,6 +97,13 @@ public:
     OPENTXS_EXPORT virtual auto AddFrame(
         const void* input,
         const std::size_t size) -> Frame& = 0;
+    // The following overloads share or take ownership of the payload instead
+    // of copying it
+    OPENTXS_EXPORT virtual auto AddFrame(const Frame& input) -> Frame& = 0;
+    OPENTXS_EXPORT virtual auto AddFrame(Pimpl<opentxs::Data>&& input)
+        -> Frame& = 0;
+    OPENTXS_EXPORT virtual auto AddFrame(Space&& input) -> Frame& = 0;
+    OPENTXS_EXPORT virtual auto AddFrame(std::string&& input) -> Frame& = 0;
 #endif
     OPENTXS_EXPORT virtual Frame& at(const std::size_t index) = 0;
     OPENTXS_EXPORT virtual FrameSection Body() = 0;
@@ -53,6 +53,10 @@ class Socket
 public:
     using SendResult = std::pair<opentxs::SendResult, OTZMQMessage>;
     enum class Direction : bool { Bind = false, Connect = true };
+    /** Receiving sockets either run a dedicated thread, or share a small
+     *  number of threads owned by the context. Callbacks for shared sockets
+     *  must not block for long periods. */
+    enum class Threading : bool { Dedicated = false, Shared = true };
 
     OPENTXS_EXPORT virtual operator void*() const noexcept = 0;
 
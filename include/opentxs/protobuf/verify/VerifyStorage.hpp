@@ -61,6 +61,7 @@ OPENTXS_EXPORT const VersionMap& StorageSeedsAllowedStorageItemHash() noexcept;
 OPENTXS_EXPORT const VersionMap&
 StorageServersAllowedStorageItemHash() noexcept;
 OPENTXS_EXPORT const VersionMap& StorageThreadAllowedItem() noexcept;
+OPENTXS_EXPORT const VersionMap& StorageThreadAllowedStorageItemHash() noexcept;
 OPENTXS_EXPORT const VersionMap& StorageUnitsAllowedStorageItemHash() noexcept;
 }  // namespace proto
 }  // namespace opentxs
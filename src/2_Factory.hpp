@@ -184,6 +184,7 @@ namespace implementation
 {
 class Context;
 class Proxy;
+class Reactor;
 }  // namespace implementation
 }  // namespace zeromq
 }  // namespace network
@@ -748,8 +749,8 @@ public:
     static auto Pipeline(
         const api::internal::Core& api,
         const network::zeromq::Context& context,
-        std::function<void(network::zeromq::Message&)> callback)
-        -> opentxs::network::zeromq::Pipeline*;
+        std::function<void(network::zeromq::Message&)> callback,
+        const bool threading) -> opentxs::network::zeromq::Pipeline*;
     static auto PrimaryCredential(
         const api::internal::Core& api,
         identity::internal::Authority& parent,
@@ -805,7 +806,8 @@ public:
     static auto PullSocket(
         const network::zeromq::Context& context,
         const bool direction,
-        const network::zeromq::ListenCallback& callback)
+        const network::zeromq::ListenCallback& callback,
+        const network::zeromq::implementation::Reactor* reactor)
         -> network::zeromq::socket::Pull*;
     static auto PushSocket(
         const network::zeromq::Context& context,
@@ -813,7 +815,8 @@ public:
     static auto ReplySocket(
         const network::zeromq::Context& context,
         const bool direction,
-        const network::zeromq::ReplyCallback& callback)
+        const network::zeromq::ReplyCallback& callback,
+        const network::zeromq::implementation::Reactor* reactor)
         -> network::zeromq::socket::Reply*;
     static auto RequestSocket(const network::zeromq::Context& context)
         -> network::zeromq::socket::Request*;
@@ -980,7 +983,7 @@ public:
         const Digest& hash,
         const Random& random) -> opentxs::api::storage::Multiplex*;
 #if OT_STORAGE_SQLITE
-    static auto StorageSqlite3(
+    OPENTXS_EXPORT static auto StorageSqlite3(
         const api::storage::Storage& storage,
         const StorageConfig& config,
         const Digest& hash,
@@ -1004,7 +1007,8 @@ public:
         -> std::shared_ptr<contract::peer::request::StoreSecret>;
     static auto SubscribeSocket(
         const network::zeromq::Context& context,
-        const network::zeromq::ListenCallback& callback)
+        const network::zeromq::ListenCallback& callback,
+        const network::zeromq::implementation::Reactor* reactor)
         -> network::zeromq::socket::Subscribe*;
     static auto Symmetric(const api::internal::Core& api)
         -> api::crypto::Symmetric*;
@@ -1139,6 +1143,12 @@ public:
         const std::size_t size) -> network::zeromq::Frame*;
     OPENTXS_EXPORT static auto ZMQFrame(const ProtobufType& data)
         -> network::zeromq::Frame*;
+    OPENTXS_EXPORT static auto ZMQFrame(OTData&& data)
+        -> network::zeromq::Frame*;
+    OPENTXS_EXPORT static auto ZMQFrame(Space&& data)
+        -> network::zeromq::Frame*;
+    OPENTXS_EXPORT static auto ZMQFrame(std::string&& data)
+        -> network::zeromq::Frame*;
     OPENTXS_EXPORT static auto ZMQMessage() -> network::zeromq::Message*;
     OPENTXS_EXPORT static auto ZMQMessage(
         const void* data,
@@ -88,6 +88,7 @@
 #include "opentxs/crypto/key/Secp256k1.hpp"
 #include "opentxs/crypto/key/Symmetric.hpp"
 #include "opentxs/ext/OTPayment.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Pipeline.hpp"
 #include "opentxs/protobuf/AsymmetricKey.pb.h"
 #include "opentxs/protobuf/CashEnums.pb.h"
@@ -1878,8 +1879,7 @@ auto Factory::Pipeline(
     std::function<void(opentxs::network::zeromq::Message&)> callback) const
     -> OTZMQPipeline
 {
-    return OTZMQPipeline{
-        opentxs::Factory::Pipeline(api_, api_.ZeroMQ(), callback)};
+    return api_.ZeroMQ().Pipeline(api_, callback);
 }
 
 #if OT_CASH
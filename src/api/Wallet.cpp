@@ -11,7 +11,6 @@
 #include <functional>
 #include <iterator>
 #include <stdexcept>
-#include <thread>
 #include <type_traits>
 
 #include "2_Factory.hpp"
@@ -104,6 +103,60 @@ const Wallet::UnitNameMap Wallet::unit_of_account_{
 const Wallet::UnitNameReverse Wallet::unit_lookup_{
     reverse_unit_map(unit_of_account_)};
 
+Wallet::Waiters::Waiters() noexcept
+    : lock_()
+    , map_()
+{
+}
+
+auto Wallet::Waiters::Notify(const std::string& id) noexcept -> void
+{
+    Lock lock(lock_);
+    auto it = map_.find(id);
+
+    if (map_.end() == it) { return; }
+
+    it->second->promise_.set_value();
+    map_.erase(it);
+}
+
+auto Wallet::Waiters::Wait(
+    const std::string& id,
+    const std::chrono::milliseconds& timeout,
+    const Check& check,
+    const Request& request) noexcept -> bool
+{
+    Lock lock(lock_);
+    auto& pPending = map_[id];
+    const auto first = (false == bool(pPending));
+
+    if (first) { pPending = std::make_shared<Pending>(); }
+
+    auto pending = pPending;
+    ++pending->waiters_;
+    lock.unlock();
+    auto output = check();
+
+    if (false == output) {
+        if (first) { request(); }
+
+        output = (std::future_status::ready ==
+                  pending->future_.wait_for(timeout));
+    }
+
+    lock.lock();
+    auto it = map_.find(id);
+
+    // The last waiter to time out removes the entry so that a later lookup
+    // sends a new request
+    if ((0 == --pending->waiters_) && (map_.end() != it) &&
+        (it->second == pending)) {
+        map_.erase(it);
+    }
+
+    return output;
+}
+
 Wallet::Wallet(const api::internal::Core& core)
     : api_(core)
     , context_map_()
@@ -114,13 +167,15 @@ Wallet::Wallet(const api::internal::Core& core)
     , unit_map_()
     , issuer_map_()
     , account_map_lock_()
-    , nym_map_lock_()
     , server_map_lock_()
     , unit_map_lock_()
     , issuer_map_lock_()
     , peer_map_lock_()
     , peer_lock_()
     , nymfile_map_lock_()
+    , nym_waiters_()
+    , server_waiters_()
+    , unit_waiters_()
     , nymfile_lock_()
 #if OT_CASH
     , purse_lock_()
@@ -1038,56 +1093,63 @@ auto Wallet::Nym(
     const std::chrono::milliseconds& timeout) const -> Nym_p
 {
     const std::string nym = id.str();
-    Lock mapLock(nym_map_lock_);
-    bool inMap = (nym_map_.find(nym) != nym_map_.end());
-    bool valid = false;
+    auto& shard = nym_shard(nym);
 
-    if (!inMap) {
-        auto pSerialized = std::shared_ptr<proto::Nym>{};
-        auto alias = std::string{};
-        bool loaded = api_.Storage().Load(nym, pSerialized, alias, true);
+    {
+        sLock mapLock(shard.lock_);
+        auto it = shard.map_.find(nym);
 
-        if (loaded) {
-            OT_ASSERT(pSerialized)
+        if (shard.map_.end() != it) { return verified_nym(it->second); }
+    }
 
-            const auto& serialized = *pSerialized;
-            auto& pNym = nym_map_[nym].second;
-            pNym.reset(opentxs::Factory::Nym(api_, serialized, alias));
+    auto pSerialized = std::shared_ptr<proto::Nym>{};
+    auto alias = std::string{};
+    bool loaded = api_.Storage().Load(nym, pSerialized, alias, true);
 
-            if (pNym && pNym->CompareID(id)) {
-                valid = pNym->VerifyPseudonym();
-                pNym->SetAliasStartup(alias);
-            } else {
-                nym_map_.erase(nym);
-            }
-        } else {
-            dht_nym_requester_->Send(nym);
+    if (loaded) {
+        OT_ASSERT(pSerialized)
 
-            if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
-
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (nym_map_.find(nym) != nym_map_.end());
-                    mapLock.unlock();
+        const auto& serialized = *pSerialized;
+        auto pNym = std::shared_ptr<identity::internal::Nym>{
+            opentxs::Factory::Nym(api_, serialized, alias)};
 
-                    if (found) { break; }
-                }
+        if (false == (pNym && pNym->CompareID(id))) { return nullptr; }
 
-                return Nym(id);  // timeout of zero prevents infinite
-                                 // recursion
-            }
+        pNym->SetAliasStartup(alias);
+        const auto revision = pNym->Revision();
+        const auto valid = pNym->VerifyPseudonym();
+        eLock mapLock(shard.lock_);
+        auto& entry = shard.map_[nym];
+
+        // Another thread may have loaded the same nym while this one was
+        // verifying it
+        if (false == bool(entry.nym_)) {
+            entry.nym_ = pNym;
+
+            if (valid) { entry.verified_.store(revision + 1u); }
         }
-    } else {
-        auto& pNym = nym_map_[nym].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
+
+        nym_waiters_.Notify(nym);
+
+        return verified_nym(entry);
     }
 
-    if (valid) { return nym_map_[nym].second; }
+    if (timeout > std::chrono::milliseconds(0)) {
+        nym_waiters_.Wait(
+            nym,
+            timeout,
+            [&] {
+                sLock mapLock(shard.lock_);
+
+                return shard.map_.find(nym) != shard.map_.end();
+            },
+            [&] { dht_nym_requester_->Send(nym); });
+
+        return Nym(id);  // timeout of zero prevents infinite
+                         // recursion
+    }
+
+    dht_nym_requester_->Send(nym);
 
     return nullptr;
 }
@@ -1126,13 +1188,17 @@ auto Wallet::Nym(const proto::Nym& serialized) const -> Nym_p
                 .Flush();
             candidate.WriteCredentials();
             SaveCredentialIDs(candidate);
-            Lock mapLock(nym_map_lock_);
-            auto& mapNym = nym_map_[id].second;
+            const auto revision = candidate.Revision();
+            auto& shard = nym_shard(id);
+            eLock mapLock(shard.lock_);
+            auto& entry = shard.map_[id];
             // TODO update existing nym rather than destroying it
-            mapNym.reset(pCandidate.release());
+            entry.nym_.reset(pCandidate.release());
+            entry.verified_.store(revision + 1u);
+            nym_waiters_.Notify(id);
             nym_publisher_->Send(id);
 
-            return mapNym;
+            return entry.nym_;
         } else {
             LogOutput(OT_METHOD)(__FUNCTION__)(": Incoming nym is not valid.")
                 .Flush();
@@ -1161,12 +1227,15 @@ auto Wallet::Nym(
 
     if (nym.VerifyPseudonym()) {
         nym.SetAlias(name);
+        // The alias is not covered by any credential signature
+        const auto revision = nym.Revision();
+        auto& shard = nym_shard(nym.ID().str());
 
         {
-            Lock mapLock(nym_map_lock_);
-            auto it = nym_map_.find(nym.ID().str());
+            sLock mapLock(shard.lock_);
+            auto it = shard.map_.find(nym.ID().str());
 
-            if (nym_map_.end() != it) { return it->second.second; }
+            if (shard.map_.end() != it) { return it->second.nym_; }
         }
 
         if (SaveCredentialIDs(nym)) {
@@ -1176,9 +1245,10 @@ auto Wallet::Nym(
                 auto nymfile = mutable_nymfile(pNym, pNym, nym.ID(), reason);
             }
 
-            Lock mapLock(nym_map_lock_);
-            auto& pMapNym = nym_map_[nym.ID().str()].second;
-            pMapNym = pNym;
+            eLock mapLock(shard.lock_);
+            auto& entry = shard.map_[nym.ID().str()];
+            entry.nym_ = pNym;
+            entry.verified_.store(revision + 1u);
 
             {
                 auto work =
@@ -1213,18 +1283,18 @@ auto Wallet::mutable_Nym(
             .Flush();
     }
 
-    Lock mapLock(nym_map_lock_);
-    auto it = nym_map_.find(nym);
+    auto& shard = nym_shard(nym);
+    sLock mapLock(shard.lock_);
+    auto it = shard.map_.find(nym);
 
-    if (nym_map_.end() == it) { OT_FAIL }
+    if (shard.map_.end() == it) { OT_FAIL }
 
     std::function<void(NymData*, Lock&)> callback = [&](NymData* nymData,
                                                         Lock& lock) -> void {
         this->save(nymData, lock);
     };
 
-    return NymData(
-        api_.Factory(), it->second.first, it->second.second, callback);
+    return NymData(api_.Factory(), it->second.lock_, it->second.nym_, callback);
 }
 
 auto Wallet::Nymfile(const identifier::Nym& id, const PasswordPrompt& reason)
@@ -1291,6 +1361,11 @@ auto Wallet::mutable_nymfile(
     return EditorType(nymfile_lock(id), nymfile.release(), callback, deleter);
 }
 
+auto Wallet::nym_shard(const std::string& id) const -> NymShard&
+{
+    return nym_map_[std::hash<std::string>{}(id) % nym_shards_];
+}
+
 auto Wallet::nymfile_lock(const identifier::Nym& nymID) const -> std::mutex&
 {
     Lock map_lock(nymfile_map_lock_);
@@ -1302,28 +1377,41 @@ auto Wallet::nymfile_lock(const identifier::Nym& nymID) const -> std::mutex&
 
 auto Wallet::NymByIDPartialMatch(const std::string& partialId) const -> Nym_p
 {
-    Lock mapLock(nym_map_lock_);
-    bool inMap = (nym_map_.find(partialId) != nym_map_.end());
-    bool valid = false;
+    {
+        auto& shard = nym_shard(partialId);
+        sLock mapLock(shard.lock_);
+        auto it = shard.map_.find(partialId);
 
-    if (!inMap) {
-        for (auto& it : nym_map_) {
-            if (it.first.compare(0, partialId.length(), partialId) == 0)
-                if (it.second.second->VerifyPseudonym())
-                    return it.second.second;
-        }
-        for (auto& it : nym_map_) {
-            if (it.second.second->Alias().compare(
-                    0, partialId.length(), partialId) == 0)
-                if (it.second.second->VerifyPseudonym())
-                    return it.second.second;
+        if (shard.map_.end() != it) { return verified_nym(it->second); }
+    }
+
+    for (auto& shard : nym_map_) {
+        sLock mapLock(shard.lock_);
+
+        for (auto& it : shard.map_) {
+            if (it.first.compare(0, partialId.length(), partialId) == 0) {
+                auto output = verified_nym(it.second);
+
+                if (output) { return output; }
+            }
         }
-    } else {
-        auto& pNym = nym_map_[partialId].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
     }
 
-    if (valid) { return nym_map_[partialId].second; }
+    for (auto& shard : nym_map_) {
+        sLock mapLock(shard.lock_);
+
+        for (auto& it : shard.map_) {
+            const auto& pNym = it.second.nym_;
+
+            if (false == bool(pNym)) { continue; }
+
+            if (pNym->Alias().compare(0, partialId.length(), partialId) == 0) {
+                auto output = verified_nym(it.second);
+
+                if (output) { return output; }
+            }
+        }
+    }
 
     return nullptr;
 }
@@ -2119,8 +2207,9 @@ auto Wallet::SaveCredentialIDs(const identity::Nym& nym) const -> bool
 auto Wallet::SetNymAlias(const identifier::Nym& id, const std::string& alias)
     const -> bool
 {
-    Lock mapLock(nym_map_lock_);
-    auto& nym = nym_map_[id.str()].second;
+    auto& shard = nym_shard(id.str());
+    eLock mapLock(shard.lock_);
+    auto& nym = shard.map_[id.str()].nym_;
 
     nym->SetAlias(alias);
 
@@ -2157,32 +2246,27 @@ auto Wallet::Server(
                 if (pServer) {
                     valid = true;  // Factory() performs validation
                     pServer->InitAlias(alias);
+                    server_waiters_.Notify(server);
                 } else {
                     server_map_.erase(server);
                 }
             }
+        } else if (timeout > std::chrono::milliseconds(0)) {
+            mapLock.unlock();
+            server_waiters_.Wait(
+                server,
+                timeout,
+                [&] {
+                    Lock lock(server_map_lock_);
+
+                    return server_map_.find(server) != server_map_.end();
+                },
+                [&] { dht_server_requester_->Send(server); });
+
+            return Server(id);  // timeout of zero prevents infinite
+                                // recursion
         } else {
             dht_server_requester_->Send(server);
-
-            if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
-
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found =
-                        (server_map_.find(server) != server_map_.end());
-                    mapLock.unlock();
-
-                    if (found) { break; }
-                }
-
-                return Server(id);  // timeout of zero prevents infinite
-                                    // recursion
-            }
         }
     } else {
         auto& pServer = server_map_[server];
@@ -2218,6 +2302,7 @@ auto Wallet::server(std::unique_ptr<contract::Server> contract) const
         Lock mapLock(server_map_lock_);
         server_map_[server].reset(contract.release());
         mapLock.unlock();
+        server_waiters_.Notify(server);
         publish_server(id);
     } else {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to save server contract.")
@@ -2438,31 +2523,27 @@ auto Wallet::UnitDefinition(
                 if (pUnit) {
                     valid = true;  // Factory() performs validation
                     pUnit->InitAlias(alias);
+                    unit_waiters_.Notify(unit);
                 } else {
                     unit_map_.erase(unit);
                 }
             }
+        } else if (timeout > std::chrono::milliseconds(0)) {
+            mapLock.unlock();
+            unit_waiters_.Wait(
+                unit,
+                timeout,
+                [&] {
+                    Lock lock(unit_map_lock_);
+
+                    return unit_map_.find(unit) != unit_map_.end();
+                },
+                [&] { dht_unit_requester_->Send(unit); });
+
+            return UnitDefinition(id);  // timeout of zero prevents infinite
+                                        // recursion
         } else {
             dht_unit_requester_->Send(unit);
-
-            if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
-
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (unit_map_.find(unit) != unit_map_.end());
-                    mapLock.unlock();
-
-                    if (found) { break; }
-                }
-
-                return UnitDefinition(id);  // timeout of zero prevents infinite
-                                            // recursion
-            }
         }
     } else {
         auto& pUnit = unit_map_[unit];
@@ -2492,6 +2573,7 @@ auto Wallet::unit_definition(std::shared_ptr<contract::Unit>&& contract) const
                 }
 
                 mapLock.unlock();
+                unit_waiters_.Notify(unit);
             }
         }
     }
@@ -2622,6 +2704,26 @@ auto Wallet::UnitDefinition(
     return UnitDefinition(identifier::UnitDefinition::Factory(unit));
 }
 
+auto Wallet::verified_nym(NymLock& entry) const -> Nym_p
+{
+    const auto& pNym = entry.nym_;
+
+    if (false == bool(pNym)) { return nullptr; }
+
+    // Credentials are only verified again after the revision changes
+    const auto revision = pNym->Revision();
+
+    if (entry.verified_.load() == (revision + 1u)) { return pNym; }
+
+    if (pNym->VerifyPseudonym()) {
+        entry.verified_.store(revision + 1u);
+
+        return pNym;
+    }
+
+    return nullptr;
+}
+
 auto Wallet::LoadCredential(
     const std::string& id,
     std::shared_ptr<proto::Credential>& credential) const -> bool
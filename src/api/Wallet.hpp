@@ -5,9 +5,14 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <functional>
+#include <future>
 #include <iosfwd>
 #include <list>
 #include <map>
@@ -363,10 +368,52 @@ protected:
     Wallet(const api::internal::Core& core);
 
 private:
+    // Threads waiting for an object which has been requested from the network
+    class Waiters
+    {
+    public:
+        using Check = std::function<bool()>;
+        using Request = std::function<void()>;
+
+        // Wakes every thread waiting for the specified object
+        auto Notify(const std::string& id) noexcept -> void;
+        // Blocks until Notify is called for the specified object or until the
+        // timeout expires. The request callback is only executed by the first
+        // of several concurrent waiters. The check callback is executed after
+        // the caller is registered so an object which arrives before the
+        // caller starts waiting is not missed.
+        auto Wait(
+            const std::string& id,
+            const std::chrono::milliseconds& timeout,
+            const Check& check,
+            const Request& request) noexcept -> bool;
+
+        Waiters() noexcept;
+
+    private:
+        struct Pending {
+            std::promise<void> promise_{};
+            std::shared_future<void> future_{promise_.get_future()};
+            std::size_t waiters_{0};
+        };
+
+        std::mutex lock_;
+        std::map<std::string, std::shared_ptr<Pending>> map_;
+    };
+
     using AccountMap = std::map<OTIdentifier, AccountLock>;
-    using NymLock =
-        std::pair<std::mutex, std::shared_ptr<identity::internal::Nym>>;
+    struct NymLock {
+        std::mutex lock_{};
+        std::shared_ptr<identity::internal::Nym> nym_{};
+        // One more than the revision of nym_ which most recently passed
+        // VerifyPseudonym, or zero if no revision has been verified
+        std::atomic<std::uint64_t> verified_{0};
+    };
     using NymMap = std::map<std::string, NymLock>;
+    struct NymShard {
+        std::shared_mutex lock_{};
+        NymMap map_{};
+    };
     using ServerMap = std::map<std::string, std::shared_ptr<contract::Server>>;
     using UnitMap = std::map<std::string, std::shared_ptr<contract::Unit>>;
     using IssuerID = std::pair<OTIdentifier, OTIdentifier>;
@@ -379,20 +426,23 @@ private:
 
     static const UnitNameMap unit_of_account_;
     static const UnitNameReverse unit_lookup_;
+    static constexpr std::size_t nym_shards_{16};
 
     mutable AccountMap account_map_;
-    mutable NymMap nym_map_;
+    mutable std::array<NymShard, nym_shards_> nym_map_;
     mutable ServerMap server_map_;
     mutable UnitMap unit_map_;
     mutable IssuerMap issuer_map_;
     mutable std::mutex account_map_lock_;
-    mutable std::mutex nym_map_lock_;
     mutable std::mutex server_map_lock_;
     mutable std::mutex unit_map_lock_;
     mutable std::mutex issuer_map_lock_;
     mutable std::mutex peer_map_lock_;
     mutable std::map<std::string, std::mutex> peer_lock_;
     mutable std::mutex nymfile_map_lock_;
+    mutable Waiters nym_waiters_;
+    mutable Waiters server_waiters_;
+    mutable Waiters unit_waiters_;
     mutable std::map<OTIdentifier, std::mutex> nymfile_lock_;
 #if OT_CASH
     mutable std::mutex purse_lock_;
@@ -455,6 +505,7 @@ private:
         [[maybe_unused]] const std::string& name) const noexcept
     {
     }
+    auto nym_shard(const std::string& id) const -> NymShard&;
     auto nymfile_lock(const identifier::Nym& nymID) const -> std::mutex&;
     auto peer_lock(const std::string& nymID) const -> std::mutex&;
     void publish_server(const identifier::Server& id) const;
@@ -497,6 +548,9 @@ private:
         noexcept(false) -> OTServerContract;
     auto unit_definition(std::shared_ptr<contract::Unit>&& contract) const
         -> OTUnitDefinition;
+    // Returns the nym if its current revision has passed VerifyPseudonym.
+    // The caller must hold the lock for the shard which contains the entry.
+    auto verified_nym(NymLock& entry) const -> Nym_p;
 
     Wallet() = delete;
     Wallet(const Wallet&) = delete;
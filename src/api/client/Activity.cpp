@@ -19,6 +19,9 @@
 
 #include "2_Factory.hpp"
 #include "internal/api/Api.hpp"
+#if OT_BLOCKCHAIN
+#include "internal/api/client/blockchain/Blockchain.hpp"
+#endif  // OT_BLOCKCHAIN
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Endpoints.hpp"
@@ -124,6 +127,14 @@ auto Activity::add_blockchain_transaction(
     auto output{true};
     const auto& txid = transaction.ID();
     const auto chains = transaction.Chains();
+    auto items = std::vector<std::string>{};
+    std::transform(
+        std::begin(chains),
+        std::end(chains),
+        std::back_inserter(items),
+        [&](const auto& chain) {
+            return blockchain_thread_item_id(api_.Crypto(), chain, txid)->str();
+        });
     std::for_each(std::begin(added), std::end(added), [&](const auto& thread) {
         const auto sThreadID = thread->str();
 
@@ -135,7 +146,9 @@ auto Activity::add_blockchain_transaction(
                         nym, thread, chain, txid, transaction.Timestamp());
                 });
 
-            if (saved) { publish(nym, sThreadID); }
+            if (saved) {
+                publish(nym, sThreadID, ThreadUpdate::Added, items);
+            }
 
             output &= saved;
         } else {
@@ -145,14 +158,15 @@ auto Activity::add_blockchain_transaction(
     std::for_each(
         std::begin(removed), std::end(removed), [&](const auto& thread) {
             auto saved{true};
-            const auto chains = transaction.Chains();
             std::for_each(
                 std::begin(chains), std::end(chains), [&](const auto& chain) {
                     saved &= api_.Storage().RemoveBlockchainThreadItem(
                         nym, thread, chain, txid);
                 });
 
-            if (saved) { publish(nym, thread->str()); }
+            if (saved) {
+                publish(nym, thread->str(), ThreadUpdate::Removed, items);
+            }
 
             output &= saved;
         });
@@ -210,7 +224,9 @@ auto Activity::AddPaymentEvent(
         type,
         workflowID.str());
 
-    if (saved) { publish(nymID, sthreadID); }
+    if (saved) {
+        publish(nymID, sthreadID, ThreadUpdate::Added, {itemID.str()});
+    }
 
     return saved;
 }
@@ -487,7 +503,7 @@ auto Activity::Mail(
             OTIdentifier{id},
             box);
         preload.detach();
-        publish(nym, threadID);
+        publish(nym, threadID, ThreadUpdate::Added, {output});
 
         return output;
     }
@@ -544,7 +560,11 @@ auto Activity::MarkRead(
     const std::string thread = threadId.str();
     const std::string item = itemId.str();
 
-    return api_.Storage().SetReadState(nym, thread, item, false);
+    const auto saved = api_.Storage().SetReadState(nym, thread, item, false);
+
+    if (saved) { publish(nymId, thread, ThreadUpdate::Changed, {item}); }
+
+    return saved;
 }
 
 auto Activity::MarkUnread(
@@ -556,7 +576,11 @@ auto Activity::MarkUnread(
     const std::string thread = threadId.str();
     const std::string item = itemId.str();
 
-    return api_.Storage().SetReadState(nym, thread, item, true);
+    const auto saved = api_.Storage().SetReadState(nym, thread, item, true);
+
+    if (saved) { publish(nymId, thread, ThreadUpdate::Changed, {item}); }
+
+    return saved;
 }
 
 void Activity::MigrateLegacyThreads() const noexcept
@@ -814,10 +838,17 @@ void Activity::PreloadThread(
 
 void Activity::publish(
     const identifier::Nym& nymID,
-    const std::string& threadID) const noexcept
+    const std::string& threadID,
+    const ThreadUpdate type,
+    const std::vector<std::string>& items) const noexcept
 {
-    auto& publisher = get_publisher(nymID);
-    publisher.Send(threadID);
+    auto message = api_.ZeroMQ().Message();
+    message->AddFrame(threadID);
+    message->AddFrame(type);
+
+    for (const auto& item : items) { message->AddFrame(item); }
+
+    get_publisher(nymID).Send(message);
 }
 
 auto Activity::start_publisher(const std::string& endpoint) const noexcept
@@ -834,6 +865,19 @@ auto Activity::start_publisher(const std::string& endpoint) const noexcept
     return output;
 }
 
+auto Activity::ThreadItem(
+    const identifier::Nym& nymID,
+    const Identifier& threadID,
+    const Identifier& itemID) const noexcept
+    -> std::shared_ptr<proto::StorageThreadItem>
+{
+    sLock lock(shared_lock_);
+    std::shared_ptr<proto::StorageThreadItem> output;
+    api_.Storage().Load(nymID.str(), threadID.str(), itemID.str(), output);
+
+    return output;
+}
+
 auto Activity::Thread(const identifier::Nym& nymID, const Identifier& threadID)
     const noexcept -> std::shared_ptr<proto::StorageThread>
 {
@@ -49,6 +49,7 @@ class Nym;
 namespace proto
 {
 class StorageThread;
+class StorageThreadItem;
 }  // namespace proto
 
 class Contact;
@@ -125,6 +126,11 @@ public:
         const PasswordPrompt& reason) const noexcept final;
     auto Thread(const identifier::Nym& nymID, const Identifier& threadID)
         const noexcept -> std::shared_ptr<proto::StorageThread> final;
+    auto ThreadItem(
+        const identifier::Nym& nymID,
+        const Identifier& threadID,
+        const Identifier& itemID) const noexcept
+        -> std::shared_ptr<proto::StorageThreadItem> final;
     auto Threads(const identifier::Nym& nym, const bool unreadOnly = false)
         const noexcept -> ObjectList final;
     auto UnreadCount(const identifier::Nym& nym) const noexcept
@@ -187,8 +193,11 @@ private:
         -> const opentxs::network::zeromq::socket::Publish&;
     auto get_publisher(const identifier::Nym& nymID, std::string& endpoint)
         const noexcept -> const opentxs::network::zeromq::socket::Publish&;
-    void publish(const identifier::Nym& nymID, const std::string& threadID)
-        const noexcept;
+    void publish(
+        const identifier::Nym& nymID,
+        const std::string& threadID,
+        const ThreadUpdate type,
+        const std::vector<std::string>& items) const noexcept;
     auto start_publisher(const std::string& endpoint) const noexcept
         -> OTZMQPublishSocket;
     auto verify_thread_exists(const std::string& nym, const std::string& thread)
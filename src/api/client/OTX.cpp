@@ -244,21 +244,24 @@ OTX::OTX(
           }))
     , find_nym_listener_(client_.ZeroMQ().PullSocket(
           find_nym_callback_,
-          zmq::socket::Socket::Direction::Bind))
+          zmq::socket::Socket::Direction::Bind,
+          zmq::socket::Socket::Threading::Shared))
     , find_server_callback_(zmq::ListenCallback::Factory(
           [this](const zmq::Message& message) -> void {
               this->find_server(message);
           }))
     , find_server_listener_(client_.ZeroMQ().PullSocket(
           find_server_callback_,
-          zmq::socket::Socket::Direction::Bind))
+          zmq::socket::Socket::Direction::Bind,
+          zmq::socket::Socket::Threading::Shared))
     , find_unit_callback_(zmq::ListenCallback::Factory(
           [this](const zmq::Message& message) -> void {
               this->find_unit(message);
           }))
     , find_unit_listener_(client_.ZeroMQ().PullSocket(
           find_unit_callback_,
-          zmq::socket::Socket::Direction::Bind))
+          zmq::socket::Socket::Direction::Bind,
+          zmq::socket::Socket::Threading::Shared))
     , task_finished_(client_.ZeroMQ().PublishSocket())
     , auto_process_inbox_(Flag::Factory(true))
     , next_task_id_(0)
@@ -75,6 +75,30 @@ auto BlockFilter::LoadFilter(const FilterType type, const ReadView blockHash)
     return output;
 }
 
+auto BlockFilter::LoadFilters(
+    const FilterType type,
+    const std::vector<ReadView>& blockHashes) const noexcept
+    -> std::vector<std::unique_ptr<const opentxs::blockchain::internal::GCS>>
+{
+    auto output =
+        std::vector<std::unique_ptr<const opentxs::blockchain::internal::GCS>>{};
+    output.reserve(blockHashes.size());
+
+    try {
+        // Every lookup shares the snapshot's read transaction
+        const auto snapshot = lmdb_.ReadSnapshot();
+
+        for (const auto& hash : blockHashes) {
+            output.emplace_back(LoadFilter(type, hash));
+        }
+    } catch (...) {
+    }
+
+    output.resize(blockHashes.size());
+
+    return output;
+}
+
 auto BlockFilter::LoadFilterHash(
     const FilterType type,
     const ReadView blockHash,
@@ -53,6 +53,10 @@ public:
         const noexcept -> bool;
     auto LoadFilter(const FilterType type, const ReadView blockHash) const
         noexcept -> std::unique_ptr<const opentxs::blockchain::internal::GCS>;
+    auto LoadFilters(
+        const FilterType type,
+        const std::vector<ReadView>& blockHashes) const noexcept
+        -> std::vector<std::unique_ptr<const opentxs::blockchain::internal::GCS>>;
     auto LoadFilterHash(
         const FilterType type,
         const ReadView blockHash,
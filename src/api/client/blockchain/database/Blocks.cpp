@@ -12,9 +12,14 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <exception>
+#include <map>
 #include <memory>
+#include <set>
 #include <stdexcept>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "api/client/blockchain/database/Database.hpp"
 #include "internal/api/client/blockchain/Blockchain.hpp"
@@ -40,66 +45,94 @@ constexpr auto KiB_ = std::size_t{1024u};
 constexpr auto MiB_ = std::size_t{1024u * KiB_};
 constexpr auto GiB_ = std::size_t{1024u * MiB_};
 [[maybe_unused]] constexpr auto TiB_ = std::size_t{1024u * GiB_};
-constexpr auto target_file_size_ =
+// NOTE databases created before the file size was configurable used sparse
+// files of this size
+constexpr auto legacy_file_size_ =
 #if OT_VALGRIND
     std::size_t{4u * GiB_};
 #else
     std::size_t{8u * TiB_};
 #endif  // OT_VALGRIND
+constexpr auto default_file_size_ = std::size_t{1u * GiB_};
+constexpr auto min_file_size_ = std::size_t{256u * MiB_};
 
-constexpr auto get_file_count(const std::size_t bytes) noexcept -> std::size_t
+constexpr auto get_file_count(
+    const std::size_t bytes,
+    const std::size_t fileSize) noexcept -> std::size_t
 {
     return std::max(
         std::size_t{1},
-        ((bytes + 1u) / target_file_size_) +
-            std::min(std::size_t{1}, (bytes + 1u) % target_file_size_));
+        ((bytes + 1u) / fileSize) +
+            std::min(std::size_t{1}, (bytes + 1u) % fileSize));
 }
 
 using Offset = std::pair<std::size_t, std::size_t>;
 
-constexpr auto get_offset(const std::size_t in) noexcept -> Offset
+constexpr auto get_offset(
+    const std::size_t in,
+    const std::size_t fileSize) noexcept -> Offset
 {
-    return Offset{in / target_file_size_, in % target_file_size_};
+    return Offset{in / fileSize, in % fileSize};
 }
 
-constexpr auto get_start_position(const std::size_t file) noexcept
-    -> std::size_t
+constexpr auto get_start_position(
+    const std::size_t file,
+    const std::size_t fileSize) noexcept -> std::size_t
 {
-    return file * target_file_size_;
+    return file * fileSize;
 }
 
 const std::size_t Blocks::address_key_{
     static_cast<std::size_t>(Database::Key::NextBlockAddress)};
+const std::size_t Blocks::file_size_key_{
+    static_cast<std::size_t>(Database::Key::BlockFileSize)};
+const std::size_t Blocks::maintenance_interval_{100};
+const std::size_t Blocks::sequence_key_{
+    static_cast<std::size_t>(Database::Key::NextBlockSequence)};
 
 Blocks::Blocks(
     opentxs::storage::lmdb::LMDB& lmdb,
-    const std::string& path) noexcept(false)
+    const std::string& path,
+    const std::size_t fileSize,
+    const std::size_t prune) noexcept(false)
     : lmdb_(lmdb)
     , path_prefix_(path)
+    , file_size_(load_file_size(lmdb_, fileSize))
+    , prune_(prune)
     , next_position_(load_position(lmdb_))
-    , files_(init_files(path_prefix_, next_position_))
+    , next_sequence_(load_sequence(lmdb_))
+    , files_(init_files(path_prefix_, next_position_, file_size_))
     , lock_()
     , block_locks_()
+    , moving_()
+    , reserved_()
+    , maintenance_lock_()
+    , maintenance_cv_()
+    , stored_(maintenance_interval_)
+    , running_(0 < prune_)
+    , maintenance_()
 {
+    static constexpr auto size = legacy_file_size_;
     static_assert(sizeof(std::uint64_t) == sizeof(std::size_t));
-    static_assert(1 == get_file_count(0));
-    static_assert(1 == get_file_count(1));
-    static_assert(1 == get_file_count(target_file_size_ - 1u));
-    static_assert(2 == get_file_count(target_file_size_));
-    static_assert(2 == get_file_count(target_file_size_ + 1u));
-    static_assert(4 == get_file_count(3u * target_file_size_));
-    static_assert(Offset{0, 0} == get_offset(0));
+    static_assert(1 == get_file_count(0, size));
+    static_assert(1 == get_file_count(1, size));
+    static_assert(1 == get_file_count(size - 1u, size));
+    static_assert(2 == get_file_count(size, size));
+    static_assert(2 == get_file_count(size + 1u, size));
+    static_assert(4 == get_file_count(3u * size, size));
+    static_assert(Offset{0, 0} == get_offset(0, size));
+    static_assert(Offset{0, size - 1u} == get_offset(size - 1u, size));
+    static_assert(Offset{1, 0} == get_offset(size, size));
+    static_assert(Offset{1, 1} == get_offset(size + 1u, size));
+    static_assert(0 == get_start_position(0, size));
+    static_assert(size == get_start_position(1, size));
     static_assert(
-        Offset{0, target_file_size_ - 1u} ==
-        get_offset(target_file_size_ - 1u));
-    static_assert(Offset{1, 0} == get_offset(target_file_size_));
-    static_assert(Offset{1, 1} == get_offset(target_file_size_ + 1u));
-    static_assert(0 == get_start_position(0));
-    static_assert(target_file_size_ == get_start_position(1));
+        sizeof(IndexData) ==
+        (sizeof(MemoryPosition) + sizeof(BlockSize) + sizeof(Sequence)));
 
     {
         Lock lock(lock_);
-        const auto offset = get_offset(next_position_);
+        const auto offset = get_offset(next_position_, file_size_);
 
         OT_ASSERT(files_.size() == (offset.first + 1));
 
@@ -107,6 +140,24 @@ Blocks::Blocks(
 
         OT_ASSERT(files_.size() == (offset.first + 1));
     }
+
+    if (running_) { maintenance_ = std::thread{&Blocks::maintenance, this}; }
+}
+
+auto Blocks::allocate(const MemoryPosition next, const BlockSize bytes)
+    const noexcept -> MemoryPosition
+{
+    // NOTE This check prevents writing past end of file
+    const auto start = get_offset(next, file_size_).first;
+    const auto end = get_offset(next + (bytes - 1), file_size_).first;
+
+    if (end != start) {
+        OT_ASSERT(end > start);
+
+        return get_start_position(end, file_size_);
+    }
+
+    return next;
 }
 
 auto Blocks::calculate_file_name(
@@ -128,13 +179,78 @@ auto Blocks::check_file(const Lock& lock, const FileCounter position)
     const noexcept -> void
 {
     while (files_.size() < (position + 1)) {
-        create_or_load(path_prefix_, files_.size(), files_);
+        create_or_load(path_prefix_, files_.size(), file_size_, files_);
+    }
+}
+
+auto Blocks::compact() const noexcept -> void
+{
+    auto files = std::vector<FileCounter>{};
+
+    {
+        Lock lock(lock_);
+        files = compaction_candidates(lock);
+    }
+
+    for (const auto file : files) {
+        auto moves = std::vector<Move>{};
+        auto copied{false};
+
+        {
+            Lock lock(lock_);
+
+            if (auto it = reserved_.find(file); reserved_.end() != it) {
+                moves = std::move(it->second);
+                reserved_.erase(it);
+                copied = true;
+            } else if (false == reserve(lock, file, moves)) {
+                continue;
+            }
+        }
+
+        // NOTE Nothing else writes to the reserved space, and Store writes
+        // blocks which are being moved to a new position instead of
+        // overwriting the source
+        if (false == copied) {
+            for (const auto& move : moves) {
+                std::memcpy(move.destination_, move.source_, move.to_.size_);
+            }
+        }
+
+        Lock lock(lock_);
+
+        if (false == reclaim(lock, file, moves)) {
+            reserved_.emplace(file, std::move(moves));
+        }
+    }
+}
+
+auto Blocks::compaction_candidates(const Lock& lock) const noexcept
+    -> std::vector<FileCounter>
+{
+    const auto head = get_offset(next_position_, file_size_).first;
+    auto live = std::map<FileCounter, std::size_t>{};
+    auto output = std::vector<FileCounter>{};
+
+    for (const auto& [hash, index] : load_index(lock)) {
+        live[get_offset(index.position_, file_size_).first] += index.size_;
+    }
+
+    for (auto file = FileCounter{0}; file < head; ++file) {
+        if (false == files_.at(file).is_open()) { continue; }
+
+        if (live[file] > (file_size_ / 2u)) { continue; }
+
+        output.emplace_back(file);
     }
+
+    return output;
 }
 
 auto Blocks::create_or_load(
     const std::string& prefix,
     const FileCounter file,
+    const std::size_t fileSize,
     std::vector<boost::iostreams::mapped_file>& output) noexcept -> void
 {
     auto params =
@@ -145,17 +261,17 @@ auto Blocks::create_or_load(
 
     try {
         if (fs::exists(path)) {
-            if (target_file_size_ == fs::file_size(path)) {
+            if (fileSize == fs::file_size(path)) {
                 params.new_file_size = 0;
             } else {
                 LogOutput(OT_METHOD)(__FUNCTION__)(": Incorrect size for ")(
                     path)
                     .Flush();
                 fs::remove(path);
-                params.new_file_size = target_file_size_;
+                params.new_file_size = fileSize;
             }
         } else {
-            params.new_file_size = target_file_size_;
+            params.new_file_size = fileSize;
         }
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
@@ -183,15 +299,24 @@ auto Blocks::Exists(const Hash& block) const noexcept -> bool
 
 auto Blocks::init_files(
     const std::string& prefix,
-    const MemoryPosition position) noexcept
+    const MemoryPosition position,
+    const std::size_t fileSize) noexcept
     -> std::vector<boost::iostreams::mapped_file>
 {
     auto output = std::vector<boost::iostreams::mapped_file>{};
-    const auto target = get_file_count(position);
+    const auto target = get_file_count(position, fileSize);
     output.reserve(target);
 
     for (auto i = FileCounter{0}; i < target; ++i) {
-        create_or_load(prefix, i, output);
+        const auto head = (i + 1u) == target;
+
+        // NOTE files which have been reclaimed by compaction are represented
+        // by closed placeholders so that file numbers remain valid indices
+        if (head || fs::exists(calculate_file_name(prefix, i))) {
+            create_or_load(prefix, i, fileSize, output);
+        } else {
+            output.emplace_back();
+        }
     }
 
     return output;
@@ -201,11 +326,7 @@ auto Blocks::Load(const Hash& block) const noexcept -> BlockReader
 {
     Lock lock(lock_);
     auto index = IndexData{};
-    auto cb = [&index](const auto in) {
-        if (sizeof(index) != in.size()) { return; }
-
-        std::memcpy(static_cast<void*>(&index), in.data(), in.size());
-    };
+    auto cb = [&index](const auto in) { read_index(in, index); };
     lmdb_.Load(Table::BlockIndex, block.Bytes(), cb);
 
     if (0 == index.size_) {
@@ -216,14 +337,72 @@ auto Blocks::Load(const Hash& block) const noexcept -> BlockReader
         return {};
     }
 
-    const auto [file, offset] = get_offset(index.position_);
+    const auto [file, offset] = get_offset(index.position_, file_size_);
     check_file(lock, file);
 
+    if (false == files_.at(file).is_open()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": File for block ")(block.asHex())(
+            " is missing")
+            .Flush();
+
+        return {};
+    }
+
     return BlockReader{
         ReadView{files_.at(file).const_data() + offset, index.size_},
         block_locks_[block]};
 }
 
+auto Blocks::load_file_size(
+    opentxs::storage::lmdb::LMDB& db,
+    const std::size_t requested) noexcept -> std::size_t
+{
+    auto output = std::size_t{0};
+
+    if (db.Exists(Table::Config, tsv(file_size_key_))) {
+        auto cb = [&output](const auto in) {
+            if (sizeof(output) != in.size()) { return; }
+
+            std::memcpy(&output, in.data(), in.size());
+        };
+        db.Load(Table::Config, tsv(file_size_key_), cb);
+
+        if (0 < output) { return output; }
+    }
+
+    if (db.Exists(Table::Config, tsv(address_key_))) {
+        output = legacy_file_size_;
+    } else {
+        output = std::max(
+            (0 == requested) ? default_file_size_ : requested, min_file_size_);
+    }
+
+    db.Store(Table::Config, tsv(file_size_key_), tsv(output));
+
+    return output;
+}
+
+auto Blocks::load_index(const Lock&) const noexcept -> std::vector<Entry>
+{
+    using Dir = opentxs::storage::lmdb::LMDB::Dir;
+
+    auto output = std::vector<Entry>{};
+    lmdb_.Read(
+        Table::BlockIndex,
+        [&](const auto key, const auto value) -> bool {
+            auto index = IndexData{};
+
+            if (false == read_index(value, index)) { return true; }
+
+            output.emplace_back(Data::Factory(key.data(), key.size()), index);
+
+            return true;
+        },
+        Dir::Forward);
+
+    return output;
+}
+
 auto Blocks::load_position([
     [maybe_unused]] opentxs::storage::lmdb::LMDB& db) noexcept -> MemoryPosition
 {
@@ -246,6 +425,244 @@ auto Blocks::load_position([
     return output;
 }
 
+auto Blocks::load_sequence(opentxs::storage::lmdb::LMDB& db) noexcept
+    -> Sequence
+{
+    auto output = Sequence{0};
+    auto cb = [&output](const auto in) {
+        if (sizeof(output) != in.size()) { return; }
+
+        std::memcpy(&output, in.data(), in.size());
+    };
+    db.Load(Table::Config, tsv(sequence_key_), cb);
+
+    return output;
+}
+
+auto Blocks::maintenance() noexcept -> void
+{
+    while (true) {
+        {
+            Lock wait(maintenance_lock_);
+            maintenance_cv_.wait(wait, [this] {
+                return (false == running_) ||
+                       (stored_ >= maintenance_interval_);
+            });
+
+            if (false == running_) { return; }
+
+            stored_ = 0;
+        }
+
+        {
+            Lock lock(lock_);
+            prune(lock);
+        }
+
+        compact();
+    }
+}
+
+auto Blocks::Pin(const Hash& block) const noexcept -> bool
+{
+    static const auto value = std::uint8_t{1};
+
+    return lmdb_.Store(Table::BlockPins, block.Bytes(), tsv(value)).first;
+}
+
+auto Blocks::prune(const Lock& lock) const noexcept -> void
+{
+    auto index = load_index(lock);
+
+    if (index.size() <= prune_) { return; }
+
+    std::sort(index.begin(), index.end(), [](const auto& lhs, const auto& rhs) {
+        return std::tie(lhs.second.sequence_, lhs.second.position_) >
+               std::tie(rhs.second.sequence_, rhs.second.position_);
+    });
+    auto kept = std::size_t{0};
+    auto locked = std::vector<pHash>{};
+
+    for (const auto& [hash, data] : index) {
+        if (lmdb_.Exists(Table::BlockPins, hash->Bytes())) { continue; }
+
+        if (kept < prune_) {
+            ++kept;
+
+            continue;
+        }
+
+        // NOTE blocks which are currently being read or written are retained
+        // until the next pass
+        if (block_locks_[hash].try_lock()) { locked.emplace_back(hash); }
+    }
+
+    if (locked.empty()) { return; }
+
+    auto tx = lmdb_.TransactionRW();
+
+    for (const auto& hash : locked) {
+        lmdb_.Delete(Table::BlockIndex, hash->Bytes(), tx);
+    }
+
+    if (tx.Finalize(true)) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Pruned ")(locked.size())(
+            " blocks")
+            .Flush();
+    } else {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Database update error").Flush();
+    }
+
+    for (const auto& hash : locked) {
+        auto it = block_locks_.find(hash);
+        it->second.unlock();
+        block_locks_.erase(it);
+    }
+}
+
+auto Blocks::read_index(const ReadView in, IndexData& out) noexcept -> bool
+{
+    static constexpr auto legacy = sizeof(MemoryPosition) + sizeof(BlockSize);
+
+    if ((sizeof(out) != in.size()) && (legacy != in.size())) { return false; }
+
+    out = IndexData{};
+    std::memcpy(static_cast<void*>(&out), in.data(), in.size());
+
+    return true;
+}
+
+auto Blocks::reclaim(
+    const Lock& lock,
+    const FileCounter file,
+    const std::vector<Move>& moves) const noexcept -> bool
+{
+    auto locks = std::vector<eLock>{};
+    locks.reserve(moves.size());
+
+    for (const auto& move : moves) {
+        locks.emplace_back(block_locks_[move.hash_], std::try_to_lock);
+
+        if (false == locks.back().owns_lock()) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": Block ")(
+                move.hash_->asHex())(" is in use, retrying file ")(file)(
+                " later")
+                .Flush();
+
+            return false;
+        }
+    }
+
+    if (0 < moves.size()) {
+        auto tx = lmdb_.TransactionRW();
+
+        for (const auto& move : moves) {
+            const auto& hash = move.hash_;
+            auto current = IndexData{};
+            auto cb = [&current](const auto in) { read_index(in, current); };
+            lmdb_.Load(Table::BlockIndex, hash->Bytes(), cb);
+
+            // NOTE a block stored again during the copy has already been
+            // written to a new position
+            if (current.position_ != move.from_.position_) { continue; }
+
+            const auto result = lmdb_.Store(
+                Table::BlockIndex, hash->Bytes(), tsv(move.to_), tx);
+
+            if (false == result.first) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to update index for block ")(hash->asHex())
+                    .Flush();
+
+                return false;
+            }
+        }
+
+        const auto result = lmdb_.Store(
+            Table::Config, tsv(address_key_), tsv(next_position_), tx);
+
+        if (false == result.first) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to update next write position")
+                .Flush();
+
+            return false;
+        }
+
+        if (false == tx.Finalize(true)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Database update error")
+                .Flush();
+
+            return false;
+        }
+    }
+
+    locks.clear();
+
+    for (const auto& move : moves) { moving_.erase(move.hash_); }
+
+    files_.at(file).close();
+
+    try {
+        fs::remove(calculate_file_name(path_prefix_, file));
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+    }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Moved ")(moves.size())(
+        " blocks out of file ")(file)
+        .Flush();
+
+    return true;
+}
+
+auto Blocks::reserve(
+    const Lock& lock,
+    const FileCounter file,
+    std::vector<Move>& moves) const noexcept -> bool
+{
+    for (const auto& [hash, index] : load_index(lock)) {
+        if (file != get_offset(index.position_, file_size_).first) {
+            continue;
+        }
+
+        // NOTE blocks which are currently being read or written are retained
+        // until the next pass
+        auto& mutex = block_locks_[hash];
+
+        if (false == mutex.try_lock()) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": Block ")(hash->asHex())(
+                " is in use, skipping file ")(file)
+                .Flush();
+
+            return false;
+        }
+
+        mutex.unlock();
+        moves.emplace_back(Move{hash, index, {}, nullptr, nullptr});
+    }
+
+    auto next = next_position_;
+
+    for (auto& move : moves) {
+        const auto& size = move.from_.size_;
+        const auto position = allocate(next, size);
+        const auto to = get_offset(position, file_size_);
+        check_file(lock, to.first);
+        const auto from = get_offset(move.from_.position_, file_size_);
+        move.to_ = IndexData{position, size, move.from_.sequence_};
+        move.source_ = files_.at(from.first).const_data() + from.second;
+        move.destination_ = files_.at(to.first).data() + to.second;
+        next = position + size;
+    }
+
+    next_position_ = next;
+
+    for (const auto& move : moves) { moving_.emplace(move.hash_); }
+
+    return true;
+}
+
 auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
     -> BlockWriter
 {
@@ -257,15 +674,21 @@ auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
         return {};
     }
 
+    if (bytes > file_size_) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Block ")(block.asHex())(
+            " is larger than the block file size")
+            .Flush();
+
+        return {};
+    }
+
     Lock lock(lock_);
     auto index = IndexData{};
-    auto cb = [&index](const auto in) {
-        if (sizeof(index) != in.size()) { return; }
-
-        std::memcpy(static_cast<void*>(&index), in.data(), in.size());
-    };
+    auto cb = [&index](const auto in) { read_index(in, index); };
     lmdb_.Load(Table::BlockIndex, block.Bytes(), cb);
-    const auto replace = bytes == index.size_;
+    // NOTE a block which compaction is copying must not be overwritten
+    const auto replace =
+        (bytes == index.size_) && (0 == moving_.count(block));
 
     if (replace) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Replacing existing block ")(
@@ -273,27 +696,15 @@ auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
             .Flush();
     } else {
         index.size_ = bytes;
-        index.position_ = next_position_;
-
-        {
-            // NOTE This check prevents writing past end of file
-            const auto start = get_offset(index.position_).first;
-            const auto end =
-                get_offset(index.position_ + (index.size_ - 1)).first;
-
-            if (end != start) {
-                OT_ASSERT(end > start);
-
-                index.position_ = get_start_position(end);
-            }
-        }
+        index.position_ = allocate(next_position_, bytes);
+        index.sequence_ = next_sequence_;
 
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Storing block ")(block.asHex())(
             " at position ")(index.position_)
             .Flush();
     }
 
-    const auto [file, offset] = get_offset(index.position_);
+    const auto [file, offset] = get_offset(index.position_, file_size_);
     check_file(lock, file);
     auto output = BlockWriter{
         WritableView{files_.at(file).data() + offset, bytes},
@@ -323,8 +734,30 @@ auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
         return {};
     }
 
+    const auto nextSequence = index.sequence_ + 1u;
+    result =
+        lmdb_.Store(Table::Config, tsv(sequence_key_), tsv(nextSequence), tx);
+
+    if (false == result.first) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to update next sequence number")
+            .Flush();
+
+        return {};
+    }
+
     if (tx.Finalize(true)) {
         next_position_ = nextPosition;
+        next_sequence_ = nextSequence;
+
+        if (0 < prune_) {
+            {
+                Lock counter(maintenance_lock_);
+                ++stored_;
+            }
+
+            maintenance_cv_.notify_one();
+        }
 
         return output;
     } else {
@@ -333,5 +766,17 @@ auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
         return {};
     }
 }
+
+Blocks::~Blocks()
+{
+    {
+        Lock lock(maintenance_lock_);
+        running_ = false;
+    }
+
+    maintenance_cv_.notify_all();
+
+    if (maintenance_.joinable()) { maintenance_.join(); }
+}
 }  // namespace opentxs::api::client::blockchain::database::implementation
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
@@ -8,11 +8,16 @@
 #if OPENTXS_BLOCK_STORAGE_ENABLED
 
 #include <boost/iostreams/device/mapped_file.hpp>
+#include <condition_variable>
+#include <cstddef>
 #include <iosfwd>
 #include <map>
 #include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "internal/blockchain/client/Client.hpp"
@@ -35,6 +40,15 @@ class LMDB;
 
 namespace opentxs::api::client::blockchain::database::implementation
 {
+// Blocks are appended to a series of fixed size memory mapped files.
+//
+// When pruning is enabled a background thread periodically removes all but
+// the most recently stored blocks from the index, except for blocks which have
+// been pinned. Files which are less than half full of indexed blocks are then
+// compacted by copying their remaining blocks to the end of the newest file
+// and deleting them. The copies are made without holding the lock which
+// serializes Load and Store. If a copied block is in use when the index is
+// updated the copies are kept and the file is reclaimed on a later pass.
 class Blocks
 {
 public:
@@ -43,31 +57,68 @@ public:
 
     auto Exists(const Hash& block) const noexcept -> bool;
     auto Load(const Hash& block) const noexcept -> BlockReader;
+    // Exempt a block from pruning
+    auto Pin(const Hash& block) const noexcept -> bool;
     auto Store(const Hash& block, const std::size_t bytes) const noexcept
         -> BlockWriter;
 
+    // fileSize: size in bytes of each block file, or zero for the default.
+    // This is only used when the database is created.
+    //
+    // prune: the number of blocks to keep in addition to pinned blocks, or
+    // zero to keep every block
     Blocks(
         opentxs::storage::lmdb::LMDB& lmdb,
-        const std::string& path) noexcept(false);
+        const std::string& path,
+        const std::size_t fileSize,
+        const std::size_t prune) noexcept(false);
+
+    ~Blocks();
 
 private:
     using FileCounter = std::size_t;
     using MemoryPosition = std::size_t;
     using BlockSize = std::size_t;
+    using Sequence = std::size_t;
 
     struct IndexData {
         MemoryPosition position_;
         BlockSize size_;
+        // Order in which blocks were stored, which compaction preserves
+        Sequence sequence_;
+    };
+
+    using Entry = std::pair<pHash, IndexData>;
+
+    struct Move {
+        pHash hash_;
+        IndexData from_;
+        IndexData to_;
+        const char* source_;
+        char* destination_;
     };
 
     static const std::size_t address_key_;
+    static const std::size_t file_size_key_;
+    static const std::size_t maintenance_interval_;
+    static const std::size_t sequence_key_;
 
     opentxs::storage::lmdb::LMDB& lmdb_;
     const std::string path_prefix_;
+    const std::size_t file_size_;
+    const std::size_t prune_;
     mutable MemoryPosition next_position_;
+    mutable Sequence next_sequence_;
     mutable std::vector<boost::iostreams::mapped_file> files_;
     mutable std::mutex lock_;
     mutable std::map<pHash, std::shared_mutex> block_locks_;
+    mutable std::set<pHash> moving_;
+    mutable std::map<FileCounter, std::vector<Move>> reserved_;
+    mutable std::mutex maintenance_lock_;
+    mutable std::condition_variable maintenance_cv_;
+    mutable std::size_t stored_;
+    bool running_;
+    std::thread maintenance_;
 
     static auto calculate_file_name(
         const std::string& prefix,
@@ -75,16 +126,56 @@ private:
     static auto create_or_load(
         const std::string& prefix,
         const FileCounter file,
+        const std::size_t fileSize,
         std::vector<boost::iostreams::mapped_file>& output) noexcept -> void;
     static auto init_files(
         const std::string& prefix,
-        const MemoryPosition position) noexcept
+        const MemoryPosition position,
+        const std::size_t fileSize) noexcept
         -> std::vector<boost::iostreams::mapped_file>;
+    static auto load_file_size(
+        opentxs::storage::lmdb::LMDB& db,
+        const std::size_t requested) noexcept -> std::size_t;
     static auto load_position(opentxs::storage::lmdb::LMDB& db) noexcept
         -> MemoryPosition;
+    static auto load_sequence(opentxs::storage::lmdb::LMDB& db) noexcept
+        -> Sequence;
+    // Index entries written before blocks had a sequence number are read as
+    // the oldest blocks
+    static auto read_index(const ReadView in, IndexData& out) noexcept
+        -> bool;
 
+    // Returns the position where a block of the specified size should be
+    // written so that it does not span two files
+    auto allocate(const MemoryPosition next, const BlockSize bytes)
+        const noexcept -> MemoryPosition;
     auto check_file(const Lock& lock, const FileCounter position) const noexcept
         -> void;
+    auto compact() const noexcept -> void;
+    // Returns the files below the head which are at most half full
+    auto compaction_candidates(const Lock& lock) const noexcept
+        -> std::vector<FileCounter>;
+    auto load_index(const Lock& lock) const noexcept -> std::vector<Entry>;
+    auto maintenance() noexcept -> void;
+    auto prune(const Lock& lock) const noexcept -> void;
+    // Updates the index for blocks copied out of the file and deletes it.
+    // The new write position is persisted in the same transaction.
+    auto reclaim(
+        const Lock& lock,
+        const FileCounter file,
+        const std::vector<Move>& moves) const noexcept -> bool;
+    // Allocates space at the head for every block in the file. The space is
+    // not persisted until reclaim succeeds.
+    auto reserve(
+        const Lock& lock,
+        const FileCounter file,
+        std::vector<Move>& moves) const noexcept -> bool;
+
+    Blocks() = delete;
+    Blocks(const Blocks&) = delete;
+    Blocks(Blocks&&) = delete;
+    auto operator=(const Blocks&) -> Blocks& = delete;
+    auto operator=(Blocks &&) -> Blocks& = delete;
 };
 }  // namespace opentxs::api::client::blockchain::database::implementation
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
@@ -14,6 +14,7 @@ extern "C" {
 #include <algorithm>
 #include <cstring>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include "api/client/blockchain/database/Blocks.hpp"
@@ -49,6 +50,7 @@ const opentxs::storage::lmdb::TableNames Database::table_names_{
     {FilterHeadersOpentxs, "block_filter_headers_opentxs"},
     {Config, "config"},
     {BlockIndex, "blocks"},
+    {BlockPins, "block_pins"},
 };
 
 Database::Database(
@@ -82,6 +84,7 @@ Database::Database(
               {FilterHeadersOpentxs, 0},
               {Config, MDB_INTEGERKEY},
               {BlockIndex, 0},
+              {BlockPins, 0},
           })
     , block_policy_(block_storage_level(args, lmdb_))
     , siphash_key_(siphash_key(lmdb_))
@@ -89,7 +92,11 @@ Database::Database(
     , peers_(api, lmdb_)
     , filters_(api, lmdb_)
 #if OPENTXS_BLOCK_STORAGE_ENABLED
-    , blocks_(lmdb_, blocks_path_->Get())
+    , blocks_(
+          lmdb_,
+          blocks_path_->Get(),
+          block_file_size_arg(args),
+          block_prune_arg(args))
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
     , wallet_(api, lmdb_)
 {
@@ -106,6 +113,33 @@ auto Database::AllocateStorageFolder(const std::string& dir) const noexcept
         ->Get();
 }
 
+auto Database::block_file_size_arg(const ArgList& args) noexcept
+    -> std::size_t
+{
+    try {
+        const auto& arg = args.at(OPENTXS_ARG_BLOCK_FILE_SIZE);
+
+        if (0 == arg.size()) { return 0; }
+
+        return std::stoul(*arg.cbegin()) * std::size_t{1024u * 1024u};
+    } catch (...) {
+        return 0;
+    }
+}
+
+auto Database::block_prune_arg(const ArgList& args) noexcept -> std::size_t
+{
+    try {
+        const auto& arg = args.at(OPENTXS_ARG_BLOCK_PRUNE);
+
+        if (0 == arg.size()) { return 0; }
+
+        return std::stoul(*arg.cbegin());
+    } catch (...) {
+        return 0;
+    }
+}
+
 auto Database::block_storage_enabled() noexcept -> bool
 {
     return 1 == OPENTXS_BLOCK_STORAGE_ENABLED;
@@ -210,6 +244,15 @@ auto Database::BlockLoad(const BlockHash& block) const noexcept -> BlockReader
 #endif
 }
 
+auto Database::BlockPin(const BlockHash& block) const noexcept -> bool
+{
+#if OPENTXS_BLOCK_STORAGE_ENABLED
+    return blocks_.Pin(block);
+#else
+    return false;
+#endif
+}
+
 auto Database::BlockStore(const BlockHash& block, const std::size_t bytes)
     const noexcept -> BlockWriter
 {
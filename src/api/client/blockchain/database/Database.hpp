@@ -83,6 +83,8 @@ public:
         BlockStoragePolicy = 0,
         NextBlockAddress = 1,
         SiphashKey = 2,
+        BlockFileSize = 3,
+        NextBlockSequence = 4,
     };
 
     using BlockHash = opentxs::blockchain::block::Hash;
@@ -108,6 +110,8 @@ public:
     }
     auto BlockExists(const BlockHash& block) const noexcept -> bool;
     auto BlockLoad(const BlockHash& block) const noexcept -> BlockReader;
+    // Exempt a block from pruning
+    auto BlockPin(const BlockHash& block) const noexcept -> bool;
     auto BlockPolicy() const noexcept -> BlockStorage { return block_policy_; }
     auto BlockStore(const BlockHash& block, const std::size_t bytes)
         const noexcept -> BlockWriter;
@@ -144,6 +148,13 @@ public:
     {
         return filters_.LoadFilter(type, blockHash);
     }
+    auto LoadFilters(
+        const FilterType type,
+        const std::vector<ReadView>& blockHashes) const noexcept
+        -> std::vector<std::unique_ptr<const opentxs::blockchain::internal::GCS>>
+    {
+        return filters_.LoadFilters(type, blockHashes);
+    }
     auto LoadFilterHash(
         const FilterType type,
         const ReadView blockHash,
@@ -237,6 +248,11 @@ private:
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
     mutable Wallet wallet_;
 
+    // Returns the requested block file size in bytes, or zero if not specified
+    static auto block_file_size_arg(const ArgList& args) noexcept
+        -> std::size_t;
+    // Returns the number of blocks to keep, or zero to keep all blocks
+    static auto block_prune_arg(const ArgList& args) noexcept -> std::size_t;
     static auto block_storage_enabled() noexcept -> bool;
     static auto block_storage_level(
         const ArgList& args,
@@ -7,8 +7,11 @@
 #include "1_Internal.hpp"          // IWYU pragma: associated
 #include "api/server/Manager.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <exception>
 #include <list>
@@ -20,6 +23,7 @@
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "2_Factory.hpp"
 #include "api/Core.hpp"
@@ -53,14 +57,16 @@
 #include "server/MessageProcessor.hpp"
 #include "server/Server.hpp"
 #include "server/ServerSettings.hpp"
+#include "util/Parallel.hpp"
 
 #if OT_CASH
 #define SERIES_DIVIDER "."
 #define PUBLIC_SERIES ".PUBLIC"
-#define MAX_MINT_SERIES 10000
 #define MINT_EXPIRE_MONTHS 6
 #define MINT_VALID_MONTHS 12
 #define MINT_GENERATE_DAYS 7
+#define MINT_RETRY_SECONDS 60
+#define WORKERS_PER_CORE 4
 #endif  // OT_CASH
 
 #define OT_METHOD "opentxs::api::server::implementation::Manager::"
@@ -143,10 +149,10 @@ Manager::Manager(
 #if OT_CASH
     , mint_thread_()
     , mint_lock_()
-    , mint_update_lock_()
     , mint_scan_lock_()
     , mints_()
-    , mints_to_check_()
+    , mint_schedule_(
+          [] { return opentxs::server::ServerSettings::__cmd_get_mint; })
     , mint_key_size_(OT_MINT_KEY_SIZE_DEFAULT)
 #endif  // OT_CASH
 {
@@ -178,15 +184,57 @@ void Manager::DropOutgoing(const int count) const
 }
 
 #if OT_CASH
+auto Manager::check_mint(
+    const std::string& serverID,
+    const std::string& unitID) const -> bool
+{
+    const auto last = last_generated_series(serverID, unitID);
+    const auto next = last + 1;
+
+    if (0 > last) {
+        generate_mint(serverID, unitID, 0);
+
+        return true;
+    }
+
+    auto mint = private_mint(unitID, last, false);
+
+    if (false == bool(mint)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to load existing series.")
+            .Flush();
+
+        return false;
+    }
+
+    const auto now = Clock::now();
+    const auto expires = mint->GetExpiration();
+    const std::chrono::seconds limit(
+        std::chrono::hours(24 * MINT_GENERATE_DAYS));
+    const bool generate = ((now + limit) >= expires);
+
+    if (generate) {
+        generate_mint(serverID, unitID, next);
+    } else {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Existing mint file for ")(
+            unitID)(" is still valid.")
+            .Flush();
+        schedule_mint(unitID, expires);
+    }
+
+    return true;
+}
+
 void Manager::generate_mint(
     const std::string& serverID,
     const std::string& unitID,
     const std::uint32_t series) const
 {
-    auto mint = GetPrivateMint(Factory().UnitID(unitID), series);
+    auto mint = private_mint(unitID, series, false);
 
     if (mint) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Mint already exists.").Flush();
+        mint_schedule_.Record(unitID, series);
+        schedule_mint(unitID, mint->GetExpiration());
 
         return;
     }
@@ -248,13 +296,25 @@ void Manager::generate_mint(
     mint->SetSavePrivateKeys(true);
     mint->SignContract(nym, reason_);
     mint->SaveContract();
-    mint->SaveMint(seriesID.c_str());
+    const auto saved = mint->SaveMint(seriesID.c_str());
     mint->SetSavePrivateKeys(false);
     mint->ReleaseSignatures();
     mint->SignContract(nym, reason_);
     mint->SaveContract();
     mint->SaveMint(PUBLIC_SERIES);
     mint->SaveMint();
+    mintLock.unlock();
+
+    if (false == saved) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to save series ")(series)(
+            " for ")(unitID)
+            .Flush();
+
+        return;
+    }
+
+    mint_schedule_.Record(unitID, series);
+    schedule_mint(unitID, expires);
 }
 #endif  // OT_CASH
 auto Manager::get_arg(const std::string& argName) const -> const std::string
@@ -345,20 +405,7 @@ auto Manager::GetPrivateMint(
     const identifier::UnitDefinition& unitID,
     std::uint32_t index) const -> std::shared_ptr<blind::Mint>
 {
-    opentxs::Lock lock(mint_lock_);
-    const std::string id{unitID.str()};
-    const std::string seriesID =
-        std::string(SERIES_DIVIDER) + std::to_string(index);
-    auto& seriesMap = mints_[id];
-    // Modifying the private version may invalidate the public version
-    seriesMap.erase(PUBLIC_SERIES);
-    auto& output = seriesMap[seriesID];
-
-    if (false == bool(output)) {
-        output = load_private_mint(lock, id, seriesID);
-    }
-
-    return output;
+    return private_mint(unitID.str(), index, true);
 }
 
 auto Manager::GetPublicMint(const identifier::UnitDefinition& unitID) const
@@ -420,29 +467,25 @@ auto Manager::last_generated_series(
     const std::string& serverID,
     const std::string& unitID) const -> std::int32_t
 {
-    std::uint32_t output{0};
-
-    for (output = 0; output < MAX_MINT_SERIES; ++output) {
+    return mint_schedule_.LastSeries(unitID, [&](const std::uint32_t series) {
         const std::string filename =
-            unitID + SERIES_DIVIDER + std::to_string(output);
-        const auto exists = OTDB::Exists(
+            unitID + SERIES_DIVIDER + std::to_string(series);
+
+        return OTDB::Exists(
             *this,
             data_folder_,
             parent_.Legacy().Mint(),
             serverID.c_str(),
             filename.c_str(),
             "");
-
-        if (false == exists) { return output - 1; }
-    }
-
-    return -1;
+    });
 }
 
 auto Manager::load_private_mint(
     const opentxs::Lock& lock,
     const std::string& unitID,
-    const std::string seriesID) const -> std::shared_ptr<blind::Mint>
+    const std::string seriesID,
+    const bool queue) const -> std::shared_ptr<blind::Mint>
 {
     OT_ASSERT(verify_lock(lock, mint_lock_));
 
@@ -453,7 +496,7 @@ auto Manager::load_private_mint(
 
     OT_ASSERT(mint);
 
-    return verify_mint(lock, unitID, seriesID, mint);
+    return verify_mint(lock, unitID, seriesID, mint, queue);
 }
 
 auto Manager::load_public_mint(
@@ -468,13 +511,11 @@ auto Manager::load_public_mint(
 
     OT_ASSERT(mint);
 
-    return verify_mint(lock, unitID, seriesID, mint);
+    return verify_mint(lock, unitID, seriesID, mint, true);
 }
 
 void Manager::mint() const
 {
-    opentxs::Lock updateLock(mint_update_lock_, std::defer_lock);
-
     while (server_.GetServerID().empty()) {
         Sleep(std::chrono::milliseconds(50));
     }
@@ -484,57 +525,45 @@ void Manager::mint() const
     OT_ASSERT(false == serverID.empty());
 
     while (running_) {
-        Sleep(std::chrono::milliseconds(250));
-
-        if (false == opentxs::server::ServerSettings::__cmd_get_mint) {
-            continue;
-        }
-
-        std::string unitID{""};
-        updateLock.lock();
-
-        if (0 < mints_to_check_.size()) {
-            unitID = mints_to_check_.back();
-            mints_to_check_.pop_back();
+        const auto units = mint_schedule_.Wait();
+
+        if (false == running_) { break; }
+
+        // Mint generation is dominated by prime generation for each
+        // denomination key so units are processed concurrently
+        auto checked = std::vector<std::uint8_t>(units.size(), 0);
+        parallel_for(units.size(), [&](const std::size_t i) {
+            checked[i] = check_mint(serverID, units.at(i)) ? 1u : 0u;
+        });
+        const auto retry =
+            Clock::now() + std::chrono::seconds(MINT_RETRY_SECONDS);
+
+        for (auto i = std::size_t{0}; i < units.size(); ++i) {
+            if (0u == checked.at(i)) {
+                mint_schedule_.Schedule(units.at(i), retry);
+            }
         }
+    }
+}
 
-        updateLock.unlock();
-
-        if (unitID.empty()) { continue; }
-
-        const auto last = last_generated_series(serverID, unitID);
-        const auto next = last + 1;
-
-        if (0 > last) {
-            generate_mint(serverID, unitID, 0);
-
-            continue;
-        }
-
-        auto mint = GetPrivateMint(Factory().UnitID(unitID), last);
-
-        if (false == bool(mint)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Failed to load existing series.")
-                .Flush();
-
-            continue;
-        }
+auto Manager::private_mint(
+    const std::string& unitID,
+    const std::uint32_t series,
+    const bool queue) const -> std::shared_ptr<blind::Mint>
+{
+    opentxs::Lock lock(mint_lock_);
+    const std::string seriesID =
+        std::string(SERIES_DIVIDER) + std::to_string(series);
+    auto& seriesMap = mints_[unitID];
+    // Modifying the private version may invalidate the public version
+    seriesMap.erase(PUBLIC_SERIES);
+    auto& output = seriesMap[seriesID];
 
-        const auto now = Clock::now();
-        const auto expires = mint->GetExpiration();
-        const std::chrono::seconds limit(
-            std::chrono::hours(24 * MINT_GENERATE_DAYS));
-        const bool generate = ((now + limit) > expires);
-
-        if (generate) {
-            generate_mint(serverID, unitID, next);
-        } else {
-            LogDetail(OT_METHOD)(__FUNCTION__)(": Existing mint file for ")(
-                unitID)(" is still valid.")
-                .Flush();
-        }
+    if (false == bool(output)) {
+        output = load_private_mint(lock, unitID, seriesID, queue);
     }
+
+    return output;
 }
 #endif  // OT_CASH
 
@@ -547,18 +576,61 @@ auto Manager::NymID() const -> const identifier::Nym&
 void Manager::ScanMints() const
 {
     opentxs::Lock scanLock(mint_scan_lock_);
-    opentxs::Lock updateLock(mint_update_lock_, std::defer_lock);
     const auto units = wallet_->UnitDefinitionList();
 
     for (const auto& it : units) {
         const auto& id = it.first;
-        updateLock.lock();
-        mints_to_check_.push_front(id);
-        updateLock.unlock();
+        mint_schedule_.Queue(id);
     }
 }
+
+void Manager::schedule_mint(const std::string& unitID, const Time expires)
+    const
+{
+    const std::chrono::seconds limit(
+        std::chrono::hours(24 * MINT_GENERATE_DAYS));
+    mint_schedule_.Schedule(unitID, expires - limit);
+}
 #endif  // OT_CASH
 
+auto Manager::workers() const -> std::size_t
+{
+    const auto arg = get_arg(OPENTXS_ARG_WORKERS);
+
+    if (arg.empty()) { return 1; }
+
+    auto value = std::int64_t{0};
+
+    try {
+        auto used = std::size_t{0};
+        value = std::stoll(arg, &used);
+
+        if (arg.size() != used) { value = 0; }
+    } catch (const std::invalid_argument&) {
+    } catch (const std::out_of_range&) {
+    }
+
+    if (1 > value) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid worker count: ")(arg)
+            .Flush();
+
+        return 1;
+    }
+
+    const auto limit = std::size_t{WORKERS_PER_CORE} *
+                       std::max(std::thread::hardware_concurrency(), 1u);
+
+    if (limit < static_cast<std::uint64_t>(value)) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Limiting worker count to ")(
+            limit)
+            .Flush();
+
+        return limit;
+    }
+
+    return static_cast<std::size_t>(value);
+}
+
 void Manager::Start()
 {
     server_.Init();
@@ -573,7 +645,7 @@ void Manager::Start()
     auto pubkey = Data::Factory();
     auto privateKey = server_.TransportKey(pubkey);
     message_processor_.init(
-        (proto::ADDRESSTYPE_INPROC == type), port, privateKey);
+        (proto::ADDRESSTYPE_INPROC == type), port, privateKey, workers());
     message_processor_.Start();
 #if OT_CASH
     ScanMints();
@@ -583,8 +655,7 @@ void Manager::Start()
 #if OT_CASH
 void Manager::UpdateMint(const identifier::UnitDefinition& unitID) const
 {
-    opentxs::Lock updateLock(mint_update_lock_);
-    mints_to_check_.push_front(unitID.str());
+    mint_schedule_.Queue(unitID.str());
 }
 #endif  // OT_CASH
 
@@ -611,12 +682,14 @@ auto Manager::verify_mint(
     const opentxs::Lock& lock,
     const std::string& unitID,
     const std::string seriesID,
-    std::shared_ptr<blind::Mint>& mint) const -> std::shared_ptr<blind::Mint>
+    std::shared_ptr<blind::Mint>& mint,
+    const bool queue) const -> std::shared_ptr<blind::Mint>
 {
     OT_ASSERT(verify_lock(lock, mint_lock_));
 
     if (false == mint->LoadMint(seriesID.c_str())) {
-        UpdateMint(Factory().UnitID(unitID));
+        // The mint thread schedules its own retries
+        if (queue) { UpdateMint(Factory().UnitID(unitID)); }
 
         return {};
     }
@@ -653,6 +726,8 @@ Manager::~Manager()
 {
     running_.Off();
 #if OT_CASH
+    mint_schedule_.Stop();
+
     if (mint_thread_.joinable()) { mint_thread_.join(); }
 #endif  // OT_CASH
 
@@ -10,7 +10,6 @@
 
 #include <atomic>
 #include <cstdint>
-#include <deque>
 #include <iosfwd>
 #include <map>
 #include <memory>
@@ -19,6 +18,7 @@
 #include <thread>
 
 #include "api/Core.hpp"
+#include "api/server/MintSchedule.hpp"
 #include "internal/api/server/Server.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
@@ -126,14 +126,15 @@ private:
 #if OT_CASH
     std::thread mint_thread_;
     mutable std::mutex mint_lock_;
-    mutable std::mutex mint_update_lock_;
     mutable std::mutex mint_scan_lock_;
     mutable std::map<std::string, MintSeries> mints_;
-    mutable std::deque<std::string> mints_to_check_;
+    mutable MintSchedule mint_schedule_;
     mutable std::atomic<std::size_t> mint_key_size_;
 #endif  // OT_CASH
 
 #if OT_CASH
+    auto check_mint(const std::string& serverID, const std::string& unitID)
+        const -> bool;
     void generate_mint(
         const std::string& serverID,
         const std::string& unitID,
@@ -147,12 +148,18 @@ private:
     auto load_private_mint(
         const opentxs::Lock& lock,
         const std::string& unitID,
-        const std::string seriesID) const -> std::shared_ptr<blind::Mint>;
+        const std::string seriesID,
+        const bool queue) const -> std::shared_ptr<blind::Mint>;
     auto load_public_mint(
         const opentxs::Lock& lock,
         const std::string& unitID,
         const std::string seriesID) const -> std::shared_ptr<blind::Mint>;
     void mint() const;
+    auto private_mint(
+        const std::string& unitID,
+        const std::uint32_t series,
+        const bool queue) const -> std::shared_ptr<blind::Mint>;
+    void schedule_mint(const std::string& unitID, const Time expires) const;
 #endif  // OT_CASH
     auto verify_lock(const opentxs::Lock& lock, const std::mutex& mutex) const
         -> bool;
@@ -161,10 +168,12 @@ private:
         const opentxs::Lock& lock,
         const std::string& unitID,
         const std::string seriesID,
-        std::shared_ptr<blind::Mint>& mint) const
-        -> std::shared_ptr<blind::Mint>;
+        std::shared_ptr<blind::Mint>& mint,
+        const bool queue) const -> std::shared_ptr<blind::Mint>;
     auto verify_mint_directory(const std::string& serverID) const -> bool;
 #endif  // OT_CASH
+    // Number of request processing threads, from the workers argument
+    auto workers() const -> std::size_t;
 
     void Cleanup();
     void Init();
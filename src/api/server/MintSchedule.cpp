@@ -0,0 +1,149 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                 // IWYU pragma: associated
+#include "1_Internal.hpp"               // IWYU pragma: associated
+#include "api/server/MintSchedule.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <set>
+#include <utility>
+
+#define MAX_MINT_SERIES 10000
+
+namespace opentxs::api::server::implementation
+{
+MintSchedule::MintSchedule(const Enabled& enabled) noexcept
+    : enabled_(enabled)
+    , lock_()
+    , updated_()
+    , stopped_(false)
+    , queue_()
+    , scheduled_()
+    , series_lock_()
+    , series_()
+{
+}
+
+auto MintSchedule::LastSeries(const std::string& unitID, const Exists& exists)
+    const -> std::int32_t
+{
+    Lock lock(series_lock_);
+
+    if (auto it = series_.find(unitID); series_.end() != it) {
+        return it->second;
+    }
+
+    lock.unlock();
+    // Find the end of the range with an exponential search instead of
+    // checking every series number
+    auto output = std::int32_t{-1};
+
+    if (exists(0)) {
+        auto low = std::uint32_t{0};
+        auto high = std::uint32_t{1};
+
+        while ((high < MAX_MINT_SERIES) && exists(high)) {
+            low = high;
+            high = std::min<std::uint32_t>(2u * high, MAX_MINT_SERIES);
+        }
+
+        while (1u < (high - low)) {
+            const auto middle = low + ((high - low) / 2u);
+
+            if (exists(middle)) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+
+        output = static_cast<std::int32_t>(low);
+    }
+
+    lock.lock();
+    // A newer series may have been recorded while the lock was released
+    auto [it, added] = series_.try_emplace(unitID, output);
+
+    if (false == added) { it->second = std::max(it->second, output); }
+
+    return it->second;
+}
+
+auto MintSchedule::Queue(const std::string& unitID) -> void
+{
+    Lock lock(lock_);
+    queue_.push_back(unitID);
+    lock.unlock();
+    updated_.notify_all();
+}
+
+auto MintSchedule::Record(const std::string& unitID, const std::uint32_t series)
+    -> void
+{
+    Lock lock(series_lock_);
+    auto& last = series_[unitID];
+    last = std::max(last, static_cast<std::int32_t>(series));
+}
+
+auto MintSchedule::Schedule(const std::string& unitID, const Time when) -> void
+{
+    Lock lock(lock_);
+    scheduled_[unitID] = when;
+}
+
+auto MintSchedule::Stop() -> void
+{
+    Lock lock(lock_);
+    stopped_ = true;
+    lock.unlock();
+    updated_.notify_all();
+}
+
+auto MintSchedule::Wait(const Time limit) -> std::vector<std::string>
+{
+    Lock lock(lock_);
+    const auto ready = [&] {
+        return stopped_ || (enabled_() && (false == queue_.empty()));
+    };
+    auto next = limit;
+
+    for (const auto& [unitID, time] : scheduled_) {
+        next = std::min(next, time);
+    }
+
+    if (Time::max() == next) {
+        updated_.wait(lock, ready);
+    } else {
+        updated_.wait_until(lock, next, ready);
+    }
+
+    if (stopped_) { return {}; }
+
+    const auto now = Clock::now();
+
+    for (auto i = scheduled_.begin(); i != scheduled_.end();) {
+        if (now >= i->second) {
+            queue_.push_back(i->first);
+            i = scheduled_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+
+    if (false == enabled_()) { return {}; }
+
+    auto output = std::vector<std::string>{};
+    auto unique = std::set<std::string>{};
+
+    for (const auto& unitID : queue_) {
+        if (unique.emplace(unitID).second) { output.emplace_back(unitID); }
+    }
+
+    queue_.clear();
+
+    return output;
+}
+}  // namespace opentxs::api::server::implementation
@@ -0,0 +1,72 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::api::server::implementation
+{
+// Decides which units the mint thread checks and when. A unit is checked
+// when it is queued, or once the time scheduled for it has passed.
+class MintSchedule
+{
+public:
+    using Enabled = std::function<bool()>;
+    using Exists = std::function<bool(const std::uint32_t series)>;
+
+    // Newest series of the unit, or -1 if it has none. Series are always
+    // generated in order, so only the first lookup for each unit needs to
+    // search for the end of the contiguous range of existing series.
+    OPENTXS_EXPORT auto LastSeries(
+        const std::string& unitID,
+        const Exists& exists) const -> std::int32_t;
+
+    OPENTXS_EXPORT auto Queue(const std::string& unitID) -> void;
+    // Records a newly generated series. Older series numbers are ignored.
+    OPENTXS_EXPORT auto Record(
+        const std::string& unitID,
+        const std::uint32_t series) -> void;
+    // Replaces any time previously scheduled for the unit
+    OPENTXS_EXPORT auto Schedule(const std::string& unitID, const Time when)
+        -> void;
+    OPENTXS_EXPORT auto Stop() -> void;
+    // Blocks until a unit is queued, a scheduled time passes, Stop is called
+    // or the limit is reached. Returns each unit which is ready exactly once.
+    // Nothing is returned while checks are disabled, but scheduled units are
+    // still moved to the queue when their time passes.
+    OPENTXS_EXPORT auto Wait(const Time limit = Time::max())
+        -> std::vector<std::string>;
+
+    OPENTXS_EXPORT MintSchedule(const Enabled& enabled) noexcept;
+
+    ~MintSchedule() = default;
+
+private:
+    const Enabled enabled_;
+    mutable std::mutex lock_;
+    std::condition_variable updated_;
+    bool stopped_;
+    std::deque<std::string> queue_;
+    std::map<std::string, Time> scheduled_;
+    mutable std::mutex series_lock_;
+    mutable std::map<std::string, std::int32_t> series_;
+
+    MintSchedule() = delete;
+    MintSchedule(const MintSchedule&) = delete;
+    MintSchedule(MintSchedule&&) = delete;
+    auto operator=(const MintSchedule&) -> MintSchedule& = delete;
+    auto operator=(MintSchedule &&) -> MintSchedule& = delete;
+};
+}  // namespace opentxs::api::server::implementation
@@ -12,6 +12,7 @@
 #include <ctime>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <string_view>
 #include <thread>
@@ -1184,6 +1185,27 @@ auto Storage::Load(
     return bool(thread);
 }
 
+auto Storage::Load(
+    const std::string& nymId,
+    const std::string& threadId,
+    const std::string& itemId,
+    std::shared_ptr<proto::StorageThreadItem>& item) const -> bool
+{
+    const auto& threads = Root().Tree().Nyms().Nym(nymId).Threads();
+
+    if (false == threads.Exists(threadId)) { return false; }
+
+    auto output = std::make_shared<proto::StorageThreadItem>();
+
+    if (false == threads.Thread(threadId).Item(itemId, *output)) {
+        return false;
+    }
+
+    item = std::move(output);
+
+    return true;
+}
+
 auto Storage::Load(
     std::shared_ptr<proto::Ciphertext>& output,
     const bool checking) const -> bool
@@ -1288,65 +1310,44 @@ auto Storage::MoveThreadItem(
         return false;
     }
 
-    auto& fromThread = mutable_Root()
-                           .get()
-                           .mutable_Tree()
-                           .get()
-                           .mutable_Nyms()
-                           .get()
-                           .mutable_Nym(nymId)
-                           .get()
-                           .mutable_Threads()
-                           .get()
-                           .mutable_Thread(fromThreadID)
-                           .get();
-    const auto thread = fromThread.Items();
-    auto found{false};
-    auto time = std::uint64_t{};
-    auto box = StorageBox{};
-    const auto alias = std::string{};
-    const auto contents = std::string{};
-    auto index = std::uint64_t{};
-    auto account = std::string{};
-
-    for (const auto& item : thread.item()) {
-        if (item.id() == itemID) {
-            found = true;
-            time = item.time();
-            box = static_cast<StorageBox>(item.box());
-            index = item.index();
-            account = item.account();
-
-            break;
-        }
-    }
+    // Both threads are modified while holding the same editors so the nym
+    // and every node above it is written once
+    auto rootNode = mutable_Root();
+    auto treeNode = rootNode.get().mutable_Tree();
+    auto nymsNode = treeNode.get().mutable_Nyms();
+    auto nymNode = nymsNode.get().mutable_Nym(nymId);
+    auto threadsNode = nymNode.get().mutable_Threads();
+    auto item = proto::StorageThreadItem{};
 
-    if (false == found) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Item does not exist.").Flush();
+    {
+        auto fromThread = threadsNode.get().mutable_Thread(fromThreadID);
 
-        return false;
-    }
+        if (false == fromThread.get().Item(itemID, item)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Item does not exist.")
+                .Flush();
 
-    if (false == fromThread.Remove(itemID)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to remove item.").Flush();
+            return false;
+        }
 
-        return false;
+        if (false == fromThread.get().Remove(itemID)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to remove item.")
+                .Flush();
+
+            return false;
+        }
     }
 
-    auto& toThread = mutable_Root()
-                         .get()
-                         .mutable_Tree()
-                         .get()
-                         .mutable_Nyms()
-                         .get()
-                         .mutable_Nym(nymId)
-                         .get()
-                         .mutable_Threads()
-                         .get()
-                         .mutable_Thread(toThreadID)
-                         .get();
-    const auto added =
-        toThread.Add(itemID, time, box, alias, contents, index, account);
+    const auto alias = std::string{};
+    const auto contents = std::string{};
+    auto toThread = threadsNode.get().mutable_Thread(toThreadID);
+    const auto added = toThread.get().Add(
+        itemID,
+        item.time(),
+        static_cast<StorageBox>(item.box()),
+        alias,
+        contents,
+        item.index(),
+        item.account());
 
     if (false == added) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to insert item.").Flush();
@@ -1539,37 +1540,21 @@ auto Storage::RemoveBlockchainThreadItem(
         return false;
     }
 
-    auto& fromThread = mutable_Root()
-                           .get()
-                           .mutable_Tree()
-                           .get()
-                           .mutable_Nyms()
-                           .get()
-                           .mutable_Nym(nym.str())
-                           .get()
-                           .mutable_Threads(txid, threadID, false)
-                           .get()
-                           .mutable_Thread(threadID.str())
-                           .get();
-    const auto thread = fromThread.Items();
-    auto found{false};
     const auto id = blockchain_thread_item_id(chain, txid);
-
-    for (const auto& item : thread.item()) {
-        if (item.id() == id) {
-            found = true;
-
-            break;
-        }
-    }
-
-    if (false == found) {
+    auto rootNode = mutable_Root();
+    auto treeNode = rootNode.get().mutable_Tree();
+    auto nymsNode = treeNode.get().mutable_Nyms();
+    auto nymNode = nymsNode.get().mutable_Nym(nym.str());
+    auto threadsNode = nymNode.get().mutable_Threads(txid, threadID, false);
+    auto fromThread = threadsNode.get().mutable_Thread(threadID.str());
+
+    if (false == fromThread.get().Check(id)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Item does not exist.").Flush();
 
         return false;
     }
 
-    if (false == fromThread.Remove(id)) {
+    if (false == fromThread.get().Remove(id)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to remove item.").Flush();
 
         return false;
@@ -1789,36 +1774,20 @@ auto Storage::RemoveThreadItem(
         return false;
     }
 
-    auto& fromThread = mutable_Root()
-                           .get()
-                           .mutable_Tree()
-                           .get()
-                           .mutable_Nyms()
-                           .get()
-                           .mutable_Nym(nym.str())
-                           .get()
-                           .mutable_Threads()
-                           .get()
-                           .mutable_Thread(threadID.str())
-                           .get();
-    const auto thread = fromThread.Items();
-    auto found{false};
-
-    for (const auto& item : thread.item()) {
-        if (item.id() == id) {
-            found = true;
-
-            break;
-        }
-    }
+    auto rootNode = mutable_Root();
+    auto treeNode = rootNode.get().mutable_Tree();
+    auto nymsNode = treeNode.get().mutable_Nyms();
+    auto nymNode = nymsNode.get().mutable_Nym(nym.str());
+    auto threadsNode = nymNode.get().mutable_Threads();
+    auto fromThread = threadsNode.get().mutable_Thread(threadID.str());
 
-    if (false == found) {
+    if (false == fromThread.get().Check(id)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Item does not exist.").Flush();
 
         return false;
     }
 
-    if (false == fromThread.Remove(id)) {
+    if (false == fromThread.get().Remove(id)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to remove item.").Flush();
 
         return false;
@@ -1901,7 +1870,7 @@ void Storage::save(opentxs::storage::Root* in, const Lock& lock) const
     OT_ASSERT(verify_write_lock(lock));
     OT_ASSERT(nullptr != in);
 
-    multiplex_.StoreRoot(true, in->root_);
+    if (in->commit()) { multiplex_.StoreRoot(true, in->root_); }
 }
 
 auto Storage::SeedList() const -> ObjectList
@@ -1909,6 +1878,11 @@ auto Storage::SeedList() const -> ObjectList
     return Root().Tree().Seeds().List();
 }
 
+auto Storage::Sequence() const noexcept -> std::uint64_t
+{
+    return Root().Sequence();
+}
+
 auto Storage::SetAccountAlias(const std::string& id, const std::string& alias)
     const -> bool
 {
@@ -75,6 +75,7 @@ class Purse;
 class Seed;
 class ServerContract;
 class StorageThread;
+class StorageThreadItem;
 class UnitDefinition;
 }  // namespace proto
 
@@ -295,6 +296,11 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         std::shared_ptr<proto::StorageThread>& thread) const -> bool final;
+    auto Load(
+        const std::string& nymId,
+        const std::string& threadId,
+        const std::string& itemId,
+        std::shared_ptr<proto::StorageThreadItem>& item) const -> bool final;
     auto Load(
         std::shared_ptr<proto::Ciphertext>& output,
         const bool checking = false) const -> bool final;
@@ -369,6 +375,7 @@ public:
         const std::string& newID) const -> bool final;
     void RunGC() const final;
     auto SeedList() const -> ObjectList final;
+    auto Sequence() const noexcept -> std::uint64_t final;
     auto ServerAlias(const std::string& id) const -> std::string final;
     auto ServerList() const -> ObjectList final;
     auto SetAccountAlias(const std::string& id, const std::string& alias) const
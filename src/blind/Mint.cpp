@@ -9,10 +9,12 @@
 
 #include <irrxml/irrXML.hpp>
 #include <chrono>
+#include <cstddef>
 #include <cstdlib>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "internal/api/Api.hpp"
 #include "opentxs/Exclusive.hpp"
@@ -31,6 +33,7 @@
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/util/Tag.hpp"
 #include "opentxs/identity/Nym.hpp"
+#include "util/Parallel.hpp"
 
 #define OT_METHOD "opentxs::blind::mint::implementation::Mint::"
 
@@ -53,6 +56,7 @@ Mint::Mint(
     , m_VALID_TO(Time::min())
     , m_EXPIRATION(Time::min())
     , m_CashAccountID(api_.Factory().Identifier())
+    , denomination_lock_()
 {
     m_strFoldername->Set(api_.Legacy().Mint());
     m_strFilename->Format(
@@ -80,6 +84,7 @@ Mint::Mint(
     , m_VALID_TO(Time::min())
     , m_EXPIRATION(Time::min())
     , m_CashAccountID(api_.Factory().Identifier())
+    , denomination_lock_()
 {
     m_strFoldername->Set(api_.Legacy().Mint());
     m_strFilename->Format(
@@ -104,6 +109,7 @@ Mint::Mint(const api::internal::Core& core)
     , m_VALID_TO(Time::min())
     , m_EXPIRATION(Time::min())
     , m_CashAccountID(api_.Factory().Identifier())
+    , denomination_lock_()
 {
     InitMint();
 }
@@ -708,19 +714,27 @@ void Mint::GenerateNewMint(
     }
 
     account.Release();
-
-    if (0 != nDenom1) { AddDenomination(theNotary, nDenom1, keySize, reason); }
-    if (0 != nDenom2) { AddDenomination(theNotary, nDenom2, keySize, reason); }
-    if (0 != nDenom3) { AddDenomination(theNotary, nDenom3, keySize, reason); }
-    if (0 != nDenom4) { AddDenomination(theNotary, nDenom4, keySize, reason); }
-    if (0 != nDenom5) { AddDenomination(theNotary, nDenom5, keySize, reason); }
-    if (0 != nDenom6) { AddDenomination(theNotary, nDenom6, keySize, reason); }
-    if (0 != nDenom7) { AddDenomination(theNotary, nDenom7, keySize, reason); }
-    if (0 != nDenom8) { AddDenomination(theNotary, nDenom8, keySize, reason); }
-    if (0 != nDenom9) { AddDenomination(theNotary, nDenom9, keySize, reason); }
-    if (0 != nDenom10) {
-        AddDenomination(theNotary, nDenom10, keySize, reason);
+    auto denominations = std::vector<std::int64_t>{};
+
+    for (const auto denomination :
+         {nDenom1,
+          nDenom2,
+          nDenom3,
+          nDenom4,
+          nDenom5,
+          nDenom6,
+          nDenom7,
+          nDenom8,
+          nDenom9,
+          nDenom10}) {
+        if (0 != denomination) { denominations.emplace_back(denomination); }
     }
+
+    // Generating the key for each denomination is independent and slow, so
+    // the keys are generated concurrently
+    parallel_for(denominations.size(), [&](const std::size_t i) {
+        AddDenomination(theNotary, denominations.at(i), keySize, reason);
+    });
 }
 
 Mint::~Mint() { Release_Mint(); }
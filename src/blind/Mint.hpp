@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <map>
+#include <mutex>
 
 #include "opentxs/Types.hpp"
 #include "opentxs/blind/Mint.hpp"
@@ -130,6 +131,8 @@ protected:
     Time m_VALID_TO;
     Time m_EXPIRATION;
     OTIdentifier m_CashAccountID;
+    // Protects the denomination maps while keys are generated concurrently
+    std::mutex denomination_lock_;
 
     Mint(const api::internal::Core& core);
     Mint(
@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <map>
 #include <set>
 #include <stdexcept>
 #include <type_traits>
@@ -931,4 +933,46 @@ auto Purse::Verify(const api::server::internal::Manager& server) const -> bool
 
     return true;
 }
+
+auto Purse::VerifyTokens(
+    const api::server::internal::Manager& server,
+    const identity::Nym& notary,
+    const PasswordPrompt& reason) const -> std::vector<bool>
+{
+    auto output = std::vector<bool>(tokens_.size(), false);
+    auto series = std::map<Token::MintSeries, std::vector<std::size_t>>{};
+
+    for (auto i = std::size_t{0}; i < tokens_.size(); ++i) {
+        series[tokens_.at(i)->Series()].emplace_back(i);
+    }
+
+    for (const auto& [number, indices] : series) {
+        auto pMint = server.GetPrivateMint(unit_, number);
+
+        if (false == bool(pMint)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Missing mint for series ")(
+                number)
+                .Flush();
+
+            continue;
+        }
+
+        auto batch = std::vector<const blind::Token*>{};
+        batch.reserve(indices.size());
+
+        for (const auto i : indices) {
+            batch.emplace_back(&tokens_.at(i).get());
+        }
+
+        const auto results = pMint->VerifyTokens(notary, batch, reason);
+
+        OT_ASSERT(results.size() == indices.size());
+
+        for (auto i = std::size_t{0}; i < indices.size(); ++i) {
+            output.at(indices.at(i)) = results.at(i);
+        }
+    }
+
+    return output;
+}
 }  // namespace opentxs::blind::implementation
@@ -103,6 +103,10 @@ public:
         -> bool final;
     auto Verify(const api::server::internal::Manager& server) const
         -> bool final;
+    auto VerifyTokens(
+        const api::server::internal::Manager& server,
+        const identity::Nym& notary,
+        const PasswordPrompt& reason) const -> std::vector<bool> final;
     auto Value() const -> Amount final { return total_value_; }
 
     auto AddNym(const identity::Nym& nym, const PasswordPrompt& reason)
@@ -13,6 +13,9 @@ extern "C" {
 #include <openssl/ossl_typ.h>
 }
 
+#include <algorithm>
+#include <map>
+#include <memory>
 #include <utility>
 
 #include "2_Factory.hpp"
@@ -33,6 +36,7 @@ extern "C" {
 #include "opentxs/crypto/Envelope.hpp"
 #include "opentxs/identity/Nym.hpp"
 #include "opentxs/protobuf/CashEnums.pb.h"
+#include "util/Parallel.hpp"
 
 #ifdef __APPLE__
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -103,6 +107,9 @@ auto Lucre::AddDenomination(
     const PasswordPrompt& reason) -> bool
 {
     bool bReturnValue = false;
+    // Only the key generation runs without the lock, so several denominations
+    // may be added concurrently
+    Lock lock(denomination_lock_);
 
     // Let's make sure it doesn't already exist
     auto theArmor = Armored::Factory();
@@ -120,6 +127,8 @@ auto Lucre::AddDenomination(
         return false;
     }
 
+    lock.unlock();
+
     if ((keySize / 8) < (MIN_COIN_LENGTH + DIGEST_LENGTH)) {
 
         LogOutput(OT_METHOD)(__FUNCTION__)(": Prime must be at least ")(
@@ -174,6 +183,7 @@ auto Lucre::AddDenomination(
 
     auto pPublic = Armored::Factory();
     auto pPrivate = Armored::Factory();
+    lock.lock();
 
     // Set the public bank info onto pPublic
     pPublic->SetString(strPublicBank, true);  // linebreaks = true
@@ -186,7 +196,14 @@ auto Lucre::AddDenomination(
     envelope->Armored(pPrivate);
 
     // Add the new key pair to the maps, using denomination as the key
-    m_mapPublic.emplace(denomination, std::move(pPublic));
+    if (false == m_mapPublic.emplace(denomination, std::move(pPublic)).second) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Error: Denomination was added concurrently.")
+            .Flush();
+
+        return false;
+    }
+
     m_mapPrivate.emplace(denomination, std::move(pPrivate));
 
     // Grab the Server Nym ID and save it with this Mint
@@ -201,6 +218,36 @@ auto Lucre::AddDenomination(
 }
 
 #if OT_CRYPTO_USING_OPENSSL
+auto Lucre::private_key(
+    const identity::Nym& notary,
+    const std::int64_t denomination,
+    const PasswordPrompt& reason,
+    String& output) const -> bool
+{
+    auto armoredPrivate = Armored::Factory();
+    GetPrivate(armoredPrivate, denomination);
+
+    try {
+        auto envelope = api_.Factory().Envelope(armoredPrivate);
+
+        if (false == envelope->Open(notary, output.WriteInto(), reason)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to decrypt private mint key")
+                .Flush();
+
+            return false;
+        }
+    } catch (...) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to decode private mint key")
+            .Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
 
 // Lucre step 3: the mint signs the token
 //
@@ -344,25 +391,9 @@ auto Lucre::VerifyToken(
     }
 
     BIO_puts(bioCoin, spendable->Get());
-    auto armoredPrivate = Armored::Factory();
-    GetPrivate(armoredPrivate, token.Value());
     auto privateKey = String::Factory();
 
-    try {
-        auto envelope = api_.Factory().Envelope(armoredPrivate);
-
-        if (false == envelope->Open(notary, privateKey->WriteInto(), reason)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Failed to decrypt private mint key")
-                .Flush();
-
-            return false;
-        }
-    } catch (...) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(
-            ": Failed to decode private mint key")
-            .Flush();
-
+    if (false == private_key(notary, token.Value(), reason, privateKey)) {
         return false;
     }
 
@@ -373,5 +404,99 @@ auto Lucre::VerifyToken(
     return bank.Verify(coin);
 }
 
+auto Lucre::VerifyTokens(
+    const identity::Nym& notary,
+    const std::vector<const blind::Token*>& tokens,
+    const PasswordPrompt& reason) -> std::vector<bool>
+{
+    const auto count = tokens.size();
+
+    if (0 == count) { return {}; }
+
+#if OT_LUCRE_DEBUG
+    LucreDumper setDumper;
+#endif
+
+    // Decrypting the spendable tokens and the private mint keys requires the
+    // password prompt so it is done on the calling thread. Each private key is
+    // only decrypted once no matter how many tokens use that denomination.
+    auto spendable = std::vector<OTString>{};
+    auto keys = std::map<std::int64_t, OTString>{};
+    spendable.reserve(count);
+
+    for (const auto* pToken : tokens) {
+        auto& coin = spendable.emplace_back(String::Factory());
+
+        if (nullptr == pToken) { continue; }
+
+        const auto& token = *pToken;
+
+        if (proto::CASHTYPE_LUCRE != token.Type()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Incorrect token type")
+                .Flush();
+
+            continue;
+        }
+
+        const auto& lucreToken =
+            dynamic_cast<const blind::token::implementation::Lucre&>(token);
+
+        if (false == lucreToken.GetSpendable(coin, reason)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to extract").Flush();
+            coin->Release();
+
+            continue;
+        }
+
+        const auto value = token.Value();
+
+        if (0 == keys.count(value)) {
+            auto& key = keys.emplace(value, String::Factory()).first->second;
+
+            if (false == private_key(notary, value, reason, key)) {
+                key->Release();
+            }
+        }
+    }
+
+    // std::vector<bool> can not be written concurrently
+    auto valid = std::vector<std::uint8_t>(count, 0);
+    parallel_batch(
+        count,
+        [&](const std::size_t first, const std::size_t last) {
+            // Every Bank owns a bignum context so reusing one per denomination
+            // avoids reallocating the context and reparsing the key per token
+            auto banks = std::map<std::int64_t, std::unique_ptr<Bank>>{};
+
+            for (auto i{first}; i < last; ++i) {
+                const auto& coin = spendable.at(i);
+
+                if (false == coin->Exists()) { continue; }
+
+                const auto value = tokens.at(i)->Value();
+                const auto& key = keys.at(value);
+
+                if (false == key->Exists()) { continue; }
+
+                auto& bank = banks[value];
+
+                if (false == bool(bank)) {
+                    crypto::implementation::OpenSSL_BIO bioBank =
+                        BIO_new(BIO_s_mem());
+                    BIO_puts(bioBank, key->Get());
+                    bank = std::make_unique<Bank>(bioBank);
+                }
+
+                crypto::implementation::OpenSSL_BIO bioCoin =
+                    BIO_new(BIO_s_mem());
+                BIO_puts(bioCoin, coin->Get());
+                Coin lucre(bioCoin);
+                valid[i] = bank->Verify(lucre) ? 1u : 0u;
+            }
+        });
+
+    return {valid.begin(), valid.end()};
+}
+
 #endif  // OT_CRYPTO_USING_OPENSSL
 }  // namespace opentxs::blind::mint::implementation
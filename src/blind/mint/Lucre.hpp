@@ -10,6 +10,7 @@
 
 #include <cstdint>
 #include <iosfwd>
+#include <vector>
 
 #include "blind/Mint.hpp"
 
@@ -58,12 +59,22 @@ public:
         const identity::Nym& notary,
         const blind::Token& token,
         const PasswordPrompt& reason) -> bool final;
+    auto VerifyTokens(
+        const identity::Nym& notary,
+        const std::vector<const blind::Token*>& tokens,
+        const PasswordPrompt& reason) -> std::vector<bool> final;
 
     ~Lucre() final = default;
 
 private:
     friend opentxs::Factory;
 
+    auto private_key(
+        const identity::Nym& notary,
+        const std::int64_t denomination,
+        const PasswordPrompt& reason,
+        String& output) const -> bool;
+
     Lucre(const api::internal::Core& core);
     Lucre(
         const api::internal::Core& core,
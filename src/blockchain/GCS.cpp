@@ -10,48 +10,37 @@
 #include <boost/core/enable_if.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/endian/buffers.hpp>
-#include <boost/multiprecision/cpp_int.hpp>
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <limits>
-#include <map>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "blockchain/Golomb.hpp"
+#include "blockchain/SipHash.hpp"
 #include "blockchain/bitcoin/CompactSize.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
-#include "opentxs/api/crypto/Crypto.hpp"
-#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/block/Block.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
-#include "opentxs/protobuf/Enums.pb.h"
 #include "opentxs/protobuf/GCS.pb.h"
 #include "util/Container.hpp"
 
 //#define OT_METHOD "opentxs::blockchain::implementation::GCS::"
 
 namespace be = boost::endian;
-namespace mp = boost::multiprecision;
-
-namespace opentxs
-{
-constexpr auto bitmask(const std::uint64_t n) -> std::uint64_t
-{
-    return (1u << n) - 1u;
-}
-}  // namespace opentxs
 
 namespace opentxs::factory
 {
@@ -160,47 +149,30 @@ auto GCS(
 
 namespace opentxs::gcs
 {
-using BitReader = blockchain::internal::BitReader;
-using BitWriter = blockchain::internal::BitWriter;
-
-auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(false)
-    -> std::uint64_t;
-auto golomb_encode(
+auto golomb_decode(
+    const std::uint32_t N,
     const std::uint8_t P,
-    const std::uint64_t value,
-    BitWriter& stream) noexcept -> void;
-auto siphash(
-    const api::Core& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> std::uint64_t;
-
-auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(false)
-    -> std::uint64_t
-{
-    auto quotient = std::uint64_t{0};
-
-    while (1 == stream.read(1)) { quotient++; }
-
-    auto remainder = stream.read(P);
-
-    return std::uint64_t{(quotient << P) + remainder};
-}
+    const ReadView encoded,
+    std::vector<std::uint64_t>& output) noexcept -> void;
+auto hashed_set_construct(
+    const SipKey& key,
+    const std::uint64_t range,
+    const std::vector<ReadView>& items) noexcept -> std::vector<std::uint64_t>;
 
-auto golomb_encode(
+auto golomb_decode(
+    const std::uint32_t N,
     const std::uint8_t P,
-    const std::uint64_t value,
-    BitWriter& stream) noexcept -> void
+    const ReadView encoded,
+    std::vector<std::uint64_t>& output) noexcept -> void
 {
-    auto remainder = std::uint64_t{value & bitmask(P)};
-    auto quotient = std::uint64_t{value >> P};
+    output.resize(N);
+    auto stream = GolombReader{P, encoded};
+    auto last = std::uint64_t{0};
 
-    while (quotient > 0) {
-        stream.write(1, 1);
-        --quotient;
+    for (auto& value : output) {
+        value = last + stream.Next();
+        last = value;
     }
-
-    stream.write(1, 0);
-    stream.write(P, remainder);
 }
 
 auto GolombDecode(
@@ -209,15 +181,7 @@ auto GolombDecode(
     const Space& encoded) noexcept(false) -> std::vector<std::uint64_t>
 {
     auto output = std::vector<std::uint64_t>{};
-    auto stream = BitReader(encoded);
-    auto last = std::uint64_t{0};
-
-    for (auto i = std::size_t{0}; i < N; ++i) {
-        auto delta = golomb_decode(P, stream);
-        auto value = last + delta;
-        output.emplace_back(value);
-        last = value;
-    }
+    golomb_decode(N, P, reader(encoded), output);
 
     return output;
 }
@@ -227,71 +191,51 @@ auto GolombEncode(
     const std::vector<std::uint64_t>& hashedSet) noexcept(false) -> Space
 {
     auto output = Space{};
-    output.reserve(hashedSet.size() * P * 2u);
-    auto stream = BitWriter{output};
+    output.reserve(((hashedSet.size() * (P + 2u)) / 8u) + 1u);
+    auto stream = GolombWriter{P, output};
     auto last = std::uint64_t{0};
 
     for (const auto& item : hashedSet) {
         auto delta = std::uint64_t{item - last};
 
-        if (delta != 0) { golomb_encode(P, delta, stream); }
+        if (delta != 0) { stream.Put(delta); }
 
         last = item;
     }
 
-    stream.flush();
-
-    return output;
-}
-
-auto siphash(
-    const api::Core& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> std::uint64_t
-{
-    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
-
-    auto output = std::uint64_t{};
-    auto writer = [&output](const auto size) -> WritableView {
-        if (sizeof(output) != size) { throw std::out_of_range("wrong size"); }
-
-        return {&output, sizeof(output)};
-    };
-
-    if (false == api.Crypto().Hash().HMAC(
-                     proto::HASHTYPE_SIPHASH24, key, item, writer)) {
-        throw std::runtime_error("siphash failed");
-    }
+    stream.Finish();
 
     return output;
 }
 
 auto HashToRange(
-    const api::Core& api,
+    const api::Core&,
     const ReadView key,
     const std::uint64_t range,
     const ReadView item) noexcept(false) -> std::uint64_t
 {
-    return ((mp::uint128_t{siphash(api, key, item)} * mp::uint128_t{range}) >>
-            64u)
-        .convert_to<std::uint64_t>();
+    return FastRange(SipHash24(SipKey{key}, item), range);
 }
 
 auto HashedSetConstruct(
-    const api::Core& api,
+    const api::Core&,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
     const std::vector<ReadView> items) noexcept(false)
     -> std::vector<std::uint64_t>
+{
+    return hashed_set_construct(
+        SipKey{key}, std::uint64_t{N} * std::uint64_t{M}, items);
+}
+
+auto hashed_set_construct(
+    const SipKey& key,
+    const std::uint64_t range,
+    const std::vector<ReadView>& items) noexcept -> std::vector<std::uint64_t>
 {
     auto output = std::vector<std::uint64_t>{};
-    const auto range = std::uint64_t{N} * std::uint64_t{M};
-    std::transform(
-        std::begin(items),
-        std::end(items),
-        std::back_inserter(output),
-        [&](const auto& item) { return HashToRange(api, key, range, item); });
+    HashToRangeBatch(key, range, items, output);
     std::sort(output.begin(), output.end());
 
     return output;
@@ -312,6 +256,8 @@ GCS::GCS(
     , bits_(bits)
     , false_positive_rate_(fpRate)
     , count_(filterElementCount)
+    , range_(std::uint64_t{count_} * std::uint64_t{false_positive_rate_})
+    , sip_key_(key)
     , elements_()
     , compressed_(api_.Factory().Data(encoded))
     , key_(api_.Factory().Data(key))
@@ -333,12 +279,9 @@ GCS::GCS(
     , bits_(bits)
     , false_positive_rate_(fpRate)
     , count_(elements.size())
-    , elements_(gcs::HashedSetConstruct(
-          api_,
-          key,
-          static_cast<std::uint32_t>(elements.size()),
-          false_positive_rate_,
-          elements))
+    , range_(std::uint64_t{count_} * std::uint64_t{false_positive_rate_})
+    , sip_key_(key)
+    , elements_(gcs::hashed_set_construct(sip_key_, range_, elements))
     , compressed_(
           api_.Factory().Data(reader(gcs::GolombEncode(bits_, *elements_))))
     , key_(api_.Factory().Data(key))
@@ -366,23 +309,6 @@ auto GCS::Compressed() const noexcept -> Space
             compressed_->size()};
 }
 
-auto GCS::decompress() const noexcept -> const Elements&
-{
-    if (false == elements_.has_value()) {
-        auto& set = const_cast<std::optional<Elements>&>(elements_);
-        set = gcs::GolombDecode(
-            count_,
-            bits_,
-            Space{
-                reinterpret_cast<const std::byte*>(compressed_->data()),
-                reinterpret_cast<const std::byte*>(compressed_->data()) +
-                    compressed_->size()});
-        std::sort(set.value().begin(), set.value().end());
-    }
-
-    return elements_.value();
-}
-
 auto GCS::Encode() const noexcept -> OTData
 {
     const auto bytes = bitcoin::CompactSize(count_).Encode();
@@ -412,45 +338,84 @@ auto GCS::hashed_set_construct(const std::vector<Space>& elements)
 auto GCS::hashed_set_construct(const std::vector<ReadView>& elements)
     const noexcept -> std::vector<std::uint64_t>
 {
-    return gcs::HashedSetConstruct(
-        api_, key_->Bytes(), count_, false_positive_rate_, elements);
+    return gcs::hashed_set_construct(sip_key_, range_, elements);
 }
 
 auto GCS::hash_to_range(const ReadView in) const noexcept -> std::uint64_t
 {
-    return gcs::HashToRange(
-        api_, key_->Bytes(), count_ * false_positive_rate_, in);
+    return gcs::FastRange(gcs::SipHash24(sip_key_, in), range_);
 }
 
 auto GCS::Match(const Targets& targets) const noexcept -> Matches
 {
     auto output = Matches{};
     auto hashed = std::vector<std::uint64_t>{};
-    auto matches = std::vector<std::uint64_t>{};
-    auto map = std::map<std::uint64_t, Targets::const_iterator>{};
-    const auto& set = decompress();
-
-    for (auto i = targets.cbegin(); i != targets.cend(); ++i) {
-        const auto& hash = hashed.emplace_back(hash_to_range(*i));
-        map.emplace(hash, i);
-    }
-
-    std::sort(std::begin(hashed), std::end(hashed));
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    gcs::HashToRangeBatch(sip_key_, range_, targets, hashed);
+    auto order = std::vector<std::size_t>(hashed.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&](const auto lhs, const auto rhs) {
+        return hashed[lhs] < hashed[rhs];
+    });
+    auto sorted = std::vector<std::uint64_t>{};
+    sorted.reserve(order.size());
     std::transform(
-        std::begin(matches),
-        std::end(matches),
-        std::back_inserter(output),
-        [&](const auto& in) { return map.at(in); });
+        std::begin(order),
+        std::end(order),
+        std::back_inserter(sorted),
+        [&](const auto i) { return hashed[i]; });
+    merge(sorted, [&](const auto position) {
+        output.emplace_back(std::next(targets.cbegin(), order[position]));
+
+        return true;
+    });
 
     return output;
 }
 
+auto GCS::MatchAny(const Targets& targets) const noexcept -> bool
+{
+    return test(hashed_set_construct(targets));
+}
+
+template <typename Visitor>
+auto GCS::merge(const std::vector<std::uint64_t>& targets, Visitor&& visitor)
+    const noexcept -> void
+{
+    if (targets.empty()) { return; }
+
+    auto target = targets.cbegin();
+    const auto end = targets.cend();
+    // Returns false once there is nothing left to compare
+    auto check = [&](const std::uint64_t value) -> bool {
+        while ((end != target) && (*target < value)) { ++target; }
+
+        while ((end != target) && (*target == value)) {
+            if (false == visitor(std::distance(targets.cbegin(), target))) {
+                return false;
+            }
+
+            ++target;
+        }
+
+        return end != target;
+    };
+
+    if (elements_.has_value()) {
+        for (const auto& value : elements_.value()) {
+            if (false == check(value)) { return; }
+        }
+    } else {
+        auto stream = gcs::GolombReader{bits_, compressed_->Bytes()};
+        auto value = std::uint64_t{0};
+
+        for (auto i = std::uint32_t{0}; i < count_; ++i) {
+            value += stream.Next();
+
+            if (false == check(value)) { return; }
+        }
+    }
+}
+
 auto GCS::Serialize() const noexcept -> proto::GCS
 {
     const auto encoded = Compressed();
@@ -488,16 +453,14 @@ auto GCS::Test(const std::vector<Space>& targets) const noexcept -> bool
 
 auto GCS::test(const std::vector<std::uint64_t>& targets) const noexcept -> bool
 {
-    const auto& set = decompress();
-    auto matches = std::vector<std::uint64_t>{};
-    std::set_intersection(
-        std::begin(targets),
-        std::end(targets),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    auto output{false};
+    merge(targets, [&](const auto) {
+        output = true;
 
-    return 0 < matches.size();
+        return false;
+    });
+
+    return output;
 }
 
 auto GCS::transform(const std::vector<OTData>& in) noexcept
@@ -12,6 +12,7 @@
 #include <optional>
 #include <vector>
 
+#include "blockchain/SipHash.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
@@ -37,6 +38,7 @@ public:
     auto Encode() const noexcept -> OTData final;
     auto Hash() const noexcept -> OTData final;
     auto Match(const Targets&) const noexcept -> Matches final;
+    auto MatchAny(const Targets&) const noexcept -> bool final;
     auto Serialize() const noexcept -> proto::GCS final;
     auto Test(const Data& target) const noexcept -> bool final;
     auto Test(const ReadView target) const noexcept -> bool final;
@@ -67,6 +69,8 @@ private:
     const std::uint8_t bits_;
     const std::uint32_t false_positive_rate_;
     const std::uint32_t count_;
+    const std::uint64_t range_;
+    const gcs::SipKey sip_key_;
     const std::optional<Elements> elements_;
     const OTData compressed_;
     const OTData key_;
@@ -76,7 +80,6 @@ private:
     static auto transform(const std::vector<Space>& in) noexcept
         -> std::vector<ReadView>;
 
-    auto decompress() const noexcept -> const Elements&;
     auto hashed_set_construct(const std::vector<OTData>& elements)
         const noexcept -> std::vector<std::uint64_t>;
     auto hashed_set_construct(const std::vector<Space>& elements) const noexcept
@@ -86,6 +89,12 @@ private:
     auto test(const std::vector<std::uint64_t>& targetHashes) const noexcept
         -> bool;
     auto hash_to_range(const ReadView in) const noexcept -> std::uint64_t;
+    // Walks the filter in order without decompressing it and calls visitor
+    // with the position of every element of the sorted targets which is
+    // present. Stops early if visitor returns false.
+    template <typename Visitor>
+    auto merge(const std::vector<std::uint64_t>& targets, Visitor&& visitor)
+        const noexcept -> void;
 
     GCS() = delete;
     GCS(const GCS&) = delete;
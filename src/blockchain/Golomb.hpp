@@ -0,0 +1,187 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "opentxs/Bytes.hpp"
+
+namespace opentxs::gcs
+{
+// Number of consecutive set bits starting from the most significant bit
+inline auto leading_ones(const std::uint64_t word) noexcept -> unsigned int
+{
+    const auto inverted = ~word;
+
+    if (0u == inverted) { return 64u; }
+
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned int>(__builtin_clzll(inverted));
+#else
+    auto output = 0u;
+
+    for (auto mask = std::uint64_t{1} << 63u; 0u != (word & mask); mask >>= 1u) {
+        ++output;
+    }
+
+    return output;
+#endif
+}
+
+// Reads Golomb-Rice coded values from a big endian bit stream
+//
+// Bits are buffered in a left aligned 64 bit window which is refilled a whole
+// word at a time. Bits past the end of the input read as zero, which matches
+// the behavior of blockchain::internal::BitReader for truncated input.
+class GolombReader
+{
+public:
+    auto Next() noexcept -> std::uint64_t
+    {
+        auto quotient = std::uint64_t{0};
+
+        while (true) {
+            refill();
+            const auto ones = leading_ones(window_);
+
+            if ((ones < available_) || (end_ == it_)) {
+                quotient += std::min(ones, available_);
+                consume(ones + 1u);
+
+                break;
+            }
+
+            quotient += available_;
+            consume(available_);
+        }
+
+        refill();
+        const auto remainder =
+            (0u == P_) ? std::uint64_t{0} : (window_ >> (64u - P_));
+        consume(P_);
+
+        return (quotient << P_) + remainder;
+    }
+
+    GolombReader(const std::uint8_t P, const ReadView encoded) noexcept
+        : P_(P)
+        , it_(reinterpret_cast<const std::uint8_t*>(encoded.data()))
+        , end_(it_ + encoded.size())
+        , window_(0)
+        , available_(0)
+    {
+    }
+
+private:
+    const unsigned int P_;
+    const std::uint8_t* it_;
+    const std::uint8_t* const end_;
+    std::uint64_t window_;
+    unsigned int available_;
+
+    auto consume(const unsigned int bits) noexcept -> void
+    {
+        window_ = (bits < 64u) ? (window_ << bits) : 0u;
+        available_ = (bits < available_) ? (available_ - bits) : 0u;
+    }
+    auto refill() noexcept -> void
+    {
+        if (available_ > 56u) { return; }
+
+        if (8 <= (end_ - it_)) {
+            // Any bits loaded past the accounted bytes are the correct values
+            // of the following input bytes so loading them again later is
+            // harmless.
+            auto word = std::uint64_t{};
+            std::memcpy(&word, it_, sizeof(word));
+            window_ |= boost::endian::big_to_native(word) >> available_;
+            const auto bytes = (63u - available_) / 8u;
+            it_ += bytes;
+            available_ += 8u * bytes;
+        } else {
+            while ((available_ <= 56u) && (end_ != it_)) {
+                window_ |= std::uint64_t{*it_++} << (56u - available_);
+                available_ += 8u;
+            }
+        }
+    }
+
+    GolombReader() = delete;
+    GolombReader(const GolombReader&) = delete;
+    GolombReader(GolombReader&&) = delete;
+    auto operator=(const GolombReader&) -> GolombReader& = delete;
+    auto operator=(GolombReader &&) -> GolombReader& = delete;
+};
+
+// Writes Golomb-Rice coded values to a big endian bit stream
+class GolombWriter
+{
+public:
+    auto Finish() noexcept -> void
+    {
+        if (0u < pending_) {
+            output_.emplace_back(
+                std::byte{static_cast<std::uint8_t>(accum_ << (8u - pending_))});
+            pending_ = 0;
+        }
+    }
+    auto Put(const std::uint64_t value) noexcept -> void
+    {
+        constexpr auto chunk = 56u;
+        constexpr auto ones = (std::uint64_t{1} << chunk) - 1u;
+        auto quotient = value >> P_;
+
+        while (quotient >= chunk) {
+            write(chunk, ones);
+            quotient -= chunk;
+        }
+
+        write(
+            static_cast<unsigned int>(quotient) + 1u,
+            ((std::uint64_t{1} << quotient) - 1u) << 1u);
+
+        if (0u < P_) { write(P_, value & ((std::uint64_t{1} << P_) - 1u)); }
+    }
+
+    GolombWriter(const std::uint8_t P, Space& output) noexcept
+        : P_(P)
+        , output_(output)
+        , accum_(0)
+        , pending_(0)
+    {
+    }
+
+private:
+    const unsigned int P_;
+    Space& output_;
+    std::uint64_t accum_;
+    unsigned int pending_;
+
+    // bits must not exceed 56
+    auto write(const unsigned int bits, const std::uint64_t value) noexcept
+        -> void
+    {
+        accum_ = (accum_ << bits) | value;
+        pending_ += bits;
+
+        while (8u <= pending_) {
+            pending_ -= 8u;
+            output_.emplace_back(
+                std::byte{static_cast<std::uint8_t>(accum_ >> pending_)});
+        }
+    }
+
+    GolombWriter() = delete;
+    GolombWriter(const GolombWriter&) = delete;
+    GolombWriter(GolombWriter&&) = delete;
+    auto operator=(const GolombWriter&) -> GolombWriter& = delete;
+    auto operator=(GolombWriter &&) -> GolombWriter& = delete;
+};
+}  // namespace opentxs::gcs
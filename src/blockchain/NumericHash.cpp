@@ -7,11 +7,8 @@
 #include "1_Internal.hpp"              // IWYU pragma: associated
 #include "blockchain/NumericHash.hpp"  // IWYU pragma: associated
 
-#include <boost/endian/buffers.hpp>
-#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <vector>
 
 #include "internal/blockchain/Blockchain.hpp"
@@ -21,11 +18,8 @@
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
-#include "opentxs/iterator/Bidirectional.hpp"
 
-#define OT_METHOD "opentxs::blockchain::implementation::NumericHash::"
-
-namespace be = boost::endian;
+// #define OT_METHOD "opentxs::blockchain::implementation::NumericHash::"
 
 namespace opentxs::factory
 {
@@ -33,23 +27,19 @@ auto NumericHashNBits(const std::int32_t input) -> blockchain::NumericHash*
 {
     using ReturnType = blockchain::implementation::NumericHash;
     using ArgumentType = ReturnType::Type;
-    using MantissaType = mp::checked_cpp_int;
 
-    const be::big_int32_buf_t big{input};
-    const auto nBits = Data::Factory(&big, sizeof(big));
-    auto exponent{std::to_integer<std::uint8_t>(nBits->at(0))};
-    MantissaType mantissa{};
-    auto it = nBits->begin();
-    ++it;
-    mp::import_bits(mantissa, it, nBits->end(), 8, true);
+    const auto nBits = static_cast<std::uint32_t>(input);
+    const auto exponent = std::size_t{nBits >> 24u};
+    const auto mantissa = ArgumentType{nBits & 0x00ffffffu};
+
+    if (3u > exponent) {
 
-    if (mantissa < 0) { return new ReturnType(); }
+        return new ReturnType(mantissa >> (8u * (3u - exponent)));
+    }
 
-    ArgumentType value{};
+    const auto shift = 8u * (exponent - 3u);
 
-    try {
-        value = ArgumentType{mantissa << (8 * (exponent - 3))};
-    } catch (...) {
+    if ((mantissa.Bits() + shift) > ArgumentType::bits_) {
         LogOutput("opentxs::factory::")(__FUNCTION__)(
             ": Failed to calculate target")
             .Flush();
@@ -57,7 +47,7 @@ auto NumericHashNBits(const std::int32_t input) -> blockchain::NumericHash*
         return new ReturnType();
     }
 
-    return new ReturnType(value);
+    return new ReturnType(mantissa << shift);
 }
 
 auto NumericHash(const blockchain::block::Hash& hash)
@@ -68,10 +58,8 @@ auto NumericHash(const blockchain::block::Hash& hash)
 
     if (hash.empty()) { return new ReturnType(); }
 
-    try {
-        // Interpret hash as little endian
-        mp::import_bits(value, hash.begin(), hash.end(), 8, false);
-    } catch (...) {
+    // Interpret hash as little endian
+    if (false == ReturnType::Type::FromLittleEndian(hash.Bytes(), value)) {
         LogOutput("opentxs::factory::")(__FUNCTION__)(": Failed to decode hash")
             .Flush();
 
@@ -171,19 +159,12 @@ auto NumericHash::operator<=(const blockchain::NumericHash& rhs) const noexcept
 auto NumericHash::asHex(const std::size_t minimumBytes) const noexcept
     -> std::string
 {
-    std::vector<unsigned char> bytes;
-
-    try {
-        // Export as big endian
-        mp::export_bits(data_, std::back_inserter(bytes), 8, true);
-    } catch (...) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to encode number").Flush();
+    auto bytes = data_.BigEndian();
 
-        return {};
+    if (minimumBytes > bytes.size()) {
+        bytes.insert(bytes.begin(), minimumBytes - bytes.size(), 0x0);
     }
 
-    while (minimumBytes > bytes.size()) { bytes.insert(bytes.begin(), 0x0); }
-
     return opentxs::Data::Factory(bytes.data(), bytes.size())->asHex();
 }
 }  // namespace opentxs::blockchain::implementation
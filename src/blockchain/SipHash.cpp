@@ -0,0 +1,319 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"            // IWYU pragma: associated
+#include "1_Internal.hpp"          // IWYU pragma: associated
+#include "blockchain/SipHash.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define OT_SIPHASH_AVX2 1
+#include <immintrin.h>
+#else
+#define OT_SIPHASH_AVX2 0
+#endif
+
+#if !defined(__SIZEOF_INT128__)
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+
+namespace be = boost::endian;
+
+namespace opentxs::gcs
+{
+using BatchFunction = void (*)(
+    const SipKey& key,
+    const std::uint64_t range,
+    const ReadView* items,
+    const std::size_t count,
+    std::uint64_t* output) noexcept;
+
+constexpr auto c0_ = std::uint64_t{0x736f6d6570736575};
+constexpr auto c1_ = std::uint64_t{0x646f72616e646f6d};
+constexpr auto c2_ = std::uint64_t{0x6c7967656e657261};
+constexpr auto c3_ = std::uint64_t{0x7465646279746573};
+
+static inline auto load_word(const char* in) noexcept -> std::uint64_t
+{
+    auto output = std::uint64_t{};
+    std::memcpy(&output, in, sizeof(output));
+
+    return be::little_to_native(output);
+}
+
+// Message word which contains the length byte and the trailing bytes which
+// do not fill a complete word
+static inline auto final_word(const ReadView item) noexcept -> std::uint64_t
+{
+    const auto size = item.size();
+    const auto tail = size & 7u;
+    const auto* it = item.data() + (size - tail);
+    auto output = std::uint64_t{size & 0xff} << 56u;
+
+    for (auto i = std::size_t{0}; i < tail; ++i) {
+        output |= std::uint64_t{static_cast<std::uint8_t>(it[i])} << (8u * i);
+    }
+
+    return output;
+}
+
+static inline auto rotl(const std::uint64_t x, const unsigned int b) noexcept
+    -> std::uint64_t
+{
+    return (x << b) | (x >> (64u - b));
+}
+
+static inline auto sip_round(
+    std::uint64_t& v0,
+    std::uint64_t& v1,
+    std::uint64_t& v2,
+    std::uint64_t& v3) noexcept -> void
+{
+    v0 += v1;
+    v1 = rotl(v1, 13);
+    v1 ^= v0;
+    v0 = rotl(v0, 32);
+    v2 += v3;
+    v3 = rotl(v3, 16);
+    v3 ^= v2;
+    v0 += v3;
+    v3 = rotl(v3, 21);
+    v3 ^= v0;
+    v2 += v1;
+    v1 = rotl(v1, 17);
+    v1 ^= v2;
+    v2 = rotl(v2, 32);
+}
+
+static auto batch_scalar(
+    const SipKey& key,
+    const std::uint64_t range,
+    const ReadView* items,
+    const std::size_t count,
+    std::uint64_t* output) noexcept -> void
+{
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        output[i] = FastRange(SipHash24(key, items[i]), range);
+    }
+}
+
+#if OT_SIPHASH_AVX2
+template <int B>
+__attribute__((target("avx2"))) static inline auto rotl(const __m256i x) noexcept
+    -> __m256i
+{
+    return _mm256_or_si256(
+        _mm256_slli_epi64(x, B), _mm256_srli_epi64(x, 64 - B));
+}
+
+__attribute__((target("avx2"))) static inline auto rotl32(
+    const __m256i x) noexcept -> __m256i
+{
+    return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+__attribute__((target("avx2"))) static inline auto sip_round(
+    __m256i& v0,
+    __m256i& v1,
+    __m256i& v2,
+    __m256i& v3) noexcept -> void
+{
+    v0 = _mm256_add_epi64(v0, v1);
+    v1 = rotl<13>(v1);
+    v1 = _mm256_xor_si256(v1, v0);
+    v0 = rotl32(v0);
+    v2 = _mm256_add_epi64(v2, v3);
+    v3 = rotl<16>(v3);
+    v3 = _mm256_xor_si256(v3, v2);
+    v0 = _mm256_add_epi64(v0, v3);
+    v3 = rotl<21>(v3);
+    v3 = _mm256_xor_si256(v3, v0);
+    v2 = _mm256_add_epi64(v2, v1);
+    v1 = rotl<17>(v1);
+    v1 = _mm256_xor_si256(v1, v2);
+    v2 = rotl32(v2);
+}
+
+// Hashes four items at once, one per 64 bit lane. Items of different lengths
+// are handled by masking: a lane stops absorbing once its final word has been
+// compressed and its state is carried unchanged until every lane is finished.
+__attribute__((target("avx2"))) static auto hash_four(
+    const SipKey& key,
+    const ReadView* items,
+    std::uint64_t* output) noexcept -> void
+{
+    std::uint64_t blocks[4]{};
+    auto most = std::size_t{0};
+
+    for (auto lane = 0; lane < 4; ++lane) {
+        blocks[lane] = items[lane].size() / 8u;
+        most = std::max<std::size_t>(most, blocks[lane]);
+    }
+
+    auto v0 = _mm256_set1_epi64x(static_cast<long long>(key.k0_ ^ c0_));
+    auto v1 = _mm256_set1_epi64x(static_cast<long long>(key.k1_ ^ c1_));
+    auto v2 = _mm256_set1_epi64x(static_cast<long long>(key.k0_ ^ c2_));
+    auto v3 = _mm256_set1_epi64x(static_cast<long long>(key.k1_ ^ c3_));
+
+    for (auto step = std::size_t{0}; step <= most; ++step) {
+        std::uint64_t word[4]{};
+        std::uint64_t active[4]{};
+
+        for (auto lane = 0; lane < 4; ++lane) {
+            const auto& item = items[lane];
+
+            if (step < blocks[lane]) {
+                word[lane] = load_word(item.data() + (8u * step));
+                active[lane] = ~std::uint64_t{0};
+            } else if (step == blocks[lane]) {
+                word[lane] = final_word(item);
+                active[lane] = ~std::uint64_t{0};
+            }
+        }
+
+        const auto m =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(word));
+        const auto mask =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(active));
+        auto n0 = v0;
+        auto n1 = v1;
+        auto n2 = v2;
+        auto n3 = _mm256_xor_si256(v3, m);
+        sip_round(n0, n1, n2, n3);
+        sip_round(n0, n1, n2, n3);
+        n0 = _mm256_xor_si256(n0, m);
+        v0 = _mm256_blendv_epi8(v0, n0, mask);
+        v1 = _mm256_blendv_epi8(v1, n1, mask);
+        v2 = _mm256_blendv_epi8(v2, n2, mask);
+        v3 = _mm256_blendv_epi8(v3, n3, mask);
+    }
+
+    v2 = _mm256_xor_si256(v2, _mm256_set1_epi64x(0xff));
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    const auto out =
+        _mm256_xor_si256(_mm256_xor_si256(v0, v1), _mm256_xor_si256(v2, v3));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), out);
+}
+
+__attribute__((target("avx2"))) static auto batch_avx2(
+    const SipKey& key,
+    const std::uint64_t range,
+    const ReadView* items,
+    const std::size_t count,
+    std::uint64_t* output) noexcept -> void
+{
+    auto i = std::size_t{0};
+
+    for (; (i + 4u) <= count; i += 4u) {
+        hash_four(key, items + i, output + i);
+
+        for (auto lane = std::size_t{0}; lane < 4u; ++lane) {
+            output[i + lane] = FastRange(output[i + lane], range);
+        }
+    }
+
+    batch_scalar(key, range, items + i, count - i, output + i);
+}
+#endif  // OT_SIPHASH_AVX2
+
+static auto select_batch() noexcept -> BatchFunction
+{
+#if OT_SIPHASH_AVX2
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) { return batch_avx2; }
+#endif  // OT_SIPHASH_AVX2
+
+    return batch_scalar;
+}
+
+SipKey::SipKey(const ReadView key) noexcept(false)
+    : k0_()
+    , k1_()
+{
+    if (16u != key.size()) {
+        throw std::runtime_error(
+            "Invalid key size: " + std::to_string(key.size()));
+    }
+
+    k0_ = load_word(key.data());
+    k1_ = load_word(key.data() + 8u);
+}
+
+SipKey::SipKey() noexcept
+    : k0_(0)
+    , k1_(0)
+{
+}
+
+auto FastRange(const std::uint64_t hash, const std::uint64_t range) noexcept
+    -> std::uint64_t
+{
+#if defined(__SIZEOF_INT128__)
+    using Wide = unsigned __int128;
+
+    return static_cast<std::uint64_t>((Wide{hash} * Wide{range}) >> 64u);
+#else
+    namespace mp = boost::multiprecision;
+
+    return ((mp::uint128_t{hash} * mp::uint128_t{range}) >> 64u)
+        .convert_to<std::uint64_t>();
+#endif
+}
+
+auto HashToRangeBatch(
+    const SipKey& key,
+    const std::uint64_t range,
+    const std::vector<ReadView>& items,
+    std::vector<std::uint64_t>& output) noexcept -> void
+{
+    static const auto batch = select_batch();
+    output.resize(items.size());
+
+    if (items.empty()) { return; }
+
+    batch(key, range, items.data(), items.size(), output.data());
+}
+
+auto SipHash24(const SipKey& key, const ReadView item) noexcept
+    -> std::uint64_t
+{
+    auto v0 = key.k0_ ^ c0_;
+    auto v1 = key.k1_ ^ c1_;
+    auto v2 = key.k0_ ^ c2_;
+    auto v3 = key.k1_ ^ c3_;
+    const auto blocks = item.size() / 8u;
+    const auto* it = item.data();
+
+    for (auto i = std::size_t{0}; i < blocks; ++i, it += 8u) {
+        const auto m = load_word(it);
+        v3 ^= m;
+        sip_round(v0, v1, v2, v3);
+        sip_round(v0, v1, v2, v3);
+        v0 ^= m;
+    }
+
+    const auto b = final_word(item);
+    v3 ^= b;
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    v0 ^= b;
+    v2 ^= 0xff;
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+}  // namespace opentxs::gcs
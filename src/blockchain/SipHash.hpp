@@ -0,0 +1,42 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+
+namespace opentxs::gcs
+{
+// SipHash-2-4 key, split into the two little endian words defined by the
+// reference implementation
+struct SipKey {
+    std::uint64_t k0_;
+    std::uint64_t k1_;
+
+    // Throws if the key is not exactly 16 bytes
+    SipKey(const ReadView key) noexcept(false);
+    SipKey() noexcept;
+};
+
+// Computes (hash * range) >> 64
+auto FastRange(const std::uint64_t hash, const std::uint64_t range) noexcept
+    -> std::uint64_t;
+// Hashes every item and reduces it to [0, range). The output vector is
+// resized to match the number of items and is not sorted.
+//
+// On x86-64 processors which support AVX2 four items are hashed in parallel.
+// All other processors use the scalar implementation.
+auto HashToRangeBatch(
+    const SipKey& key,
+    const std::uint64_t range,
+    const std::vector<ReadView>& items,
+    std::vector<std::uint64_t>& output) noexcept -> void;
+auto SipHash24(const SipKey& key, const ReadView item) noexcept
+    -> std::uint64_t;
+}  // namespace opentxs::gcs
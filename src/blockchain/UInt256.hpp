@@ -0,0 +1,433 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+
+namespace opentxs::blockchain
+{
+// Unsigned 256 bit integer
+//
+// The value is held in four 64 bit limbs, least significant limb first, so
+// no operation allocates. Arithmetic wraps modulo 2^256 like the built in
+// unsigned types.
+class UInt256
+{
+public:
+    using Limbs = std::array<std::uint64_t, 4>;
+
+    static constexpr std::size_t bits_{256};
+    static constexpr std::size_t bytes_{32};
+
+    // Returns false if the value does not fit in 256 bits
+    static auto FromBigEndian(const ReadView bytes, UInt256& output) noexcept
+        -> bool
+    {
+        return from_bytes(bytes, output, true);
+    }
+    // Returns false if the value does not fit in 256 bits
+    static auto FromLittleEndian(const ReadView bytes, UInt256& output) noexcept
+        -> bool
+    {
+        return from_bytes(bytes, output, false);
+    }
+
+    constexpr auto operator==(const UInt256& rhs) const noexcept -> bool
+    {
+        for (auto i = std::size_t{0}; i < limbs_.size(); ++i) {
+            if (limbs_[i] != rhs.limbs_[i]) { return false; }
+        }
+
+        return true;
+    }
+    constexpr auto operator!=(const UInt256& rhs) const noexcept -> bool
+    {
+        return false == (*this == rhs);
+    }
+    constexpr auto operator<(const UInt256& rhs) const noexcept -> bool
+    {
+        for (auto i = limbs_.size(); i > 0u; --i) {
+            const auto& l = limbs_[i - 1u];
+            const auto& r = rhs.limbs_[i - 1u];
+
+            if (l != r) { return l < r; }
+        }
+
+        return false;
+    }
+    constexpr auto operator<=(const UInt256& rhs) const noexcept -> bool
+    {
+        return false == (rhs < *this);
+    }
+    constexpr auto operator>(const UInt256& rhs) const noexcept -> bool
+    {
+        return rhs < *this;
+    }
+    constexpr auto operator>=(const UInt256& rhs) const noexcept -> bool
+    {
+        return false == (*this < rhs);
+    }
+    constexpr auto operator+(const UInt256& rhs) const noexcept -> UInt256
+    {
+        auto output = UInt256{};
+        auto carry = std::uint64_t{0};
+
+        for (auto i = std::size_t{0}; i < limbs_.size(); ++i) {
+            const auto sum = limbs_[i] + rhs.limbs_[i];
+            const auto total = sum + carry;
+            output.limbs_[i] = total;
+            carry = ((sum < limbs_[i]) || (total < sum)) ? 1u : 0u;
+        }
+
+        return output;
+    }
+    constexpr auto operator-(const UInt256& rhs) const noexcept -> UInt256
+    {
+        auto output = UInt256{};
+        auto borrow = std::uint64_t{0};
+
+        for (auto i = std::size_t{0}; i < limbs_.size(); ++i) {
+            const auto& l = limbs_[i];
+            const auto& r = rhs.limbs_[i];
+            const auto difference = l - r;
+            output.limbs_[i] = difference - borrow;
+            borrow = ((l < r) || (difference < borrow)) ? 1u : 0u;
+        }
+
+        return output;
+    }
+    constexpr auto operator|(const UInt256& rhs) const noexcept -> UInt256
+    {
+        auto output = UInt256{};
+
+        for (auto i = std::size_t{0}; i < limbs_.size(); ++i) {
+            output.limbs_[i] = limbs_[i] | rhs.limbs_[i];
+        }
+
+        return output;
+    }
+    constexpr auto operator<<(const std::size_t shift) const noexcept
+        -> UInt256
+    {
+        auto output = UInt256{};
+
+        if (shift >= bits_) { return output; }
+
+        const auto words = shift / 64u;
+        const auto bits = shift % 64u;
+
+        for (auto i = limbs_.size(); i > words; --i) {
+            const auto to = i - 1u;
+            const auto from = to - words;
+            output.limbs_[to] = limbs_[from] << bits;
+
+            if ((0u < bits) && (0u < from)) {
+                output.limbs_[to] |= limbs_[from - 1u] >> (64u - bits);
+            }
+        }
+
+        return output;
+    }
+    constexpr auto operator>>(const std::size_t shift) const noexcept
+        -> UInt256
+    {
+        auto output = UInt256{};
+
+        if (shift >= bits_) { return output; }
+
+        const auto words = shift / 64u;
+        const auto bits = shift % 64u;
+
+        for (auto to = std::size_t{0}; to + words < limbs_.size(); ++to) {
+            const auto from = to + words;
+            output.limbs_[to] = limbs_[from] >> bits;
+
+            if ((0u < bits) && (from + 1u < limbs_.size())) {
+                output.limbs_[to] |= limbs_[from + 1u] << (64u - bits);
+            }
+        }
+
+        return output;
+    }
+
+    // Minimal big endian encoding. Zero encodes as a single byte.
+    auto BigEndian() const noexcept -> std::vector<std::uint8_t>
+    {
+        auto output = std::vector<std::uint8_t>{};
+        output.reserve(bytes_);
+
+        for (auto i = bytes_; i > 0u; --i) {
+            const auto byte = Byte(i - 1u);
+
+            if (output.empty() && (0u == byte) && (1u < i)) { continue; }
+
+            output.emplace_back(byte);
+        }
+
+        return output;
+    }
+    constexpr auto Bit(const std::size_t index) const noexcept -> bool
+    {
+        return 0u != ((limbs_[index / 64u] >> (index % 64u)) & 1u);
+    }
+    // Number of bits required to represent the value
+    constexpr auto Bits() const noexcept -> std::size_t
+    {
+        for (auto i = limbs_.size(); i > 0u; --i) {
+            auto limb = limbs_[i - 1u];
+
+            if (0u == limb) { continue; }
+
+            auto output = (i - 1u) * 64u;
+
+            while (0u != limb) {
+                ++output;
+                limb >>= 1u;
+            }
+
+            return output;
+        }
+
+        return 0u;
+    }
+    // Byte 0 is the least significant byte
+    constexpr auto Byte(const std::size_t index) const noexcept
+        -> std::uint8_t
+    {
+        return static_cast<std::uint8_t>(
+            limbs_[index / 8u] >> (8u * (index % 8u)));
+    }
+    auto Decimal() const noexcept -> std::string
+    {
+        // Largest power of ten which fits in 32 bits
+        constexpr auto chunk = std::uint32_t{1000000000u};
+        constexpr auto digits = std::size_t{9};
+        auto chunks = std::vector<std::uint32_t>{};
+        auto value{*this};
+
+        do {
+            const auto [quotient, remainder] = value.DivMod(chunk);
+            chunks.emplace_back(remainder);
+            value = quotient;
+        } while (false == value.IsZero());
+
+        auto output = std::to_string(chunks.back());
+
+        for (auto i = chunks.size() - 1u; i > 0u; --i) {
+            const auto part = std::to_string(chunks[i - 1u]);
+            output.append(digits - part.size(), '0');
+            output.append(part);
+        }
+
+        return output;
+    }
+    // Divides by a 32 bit value. The divisor must not be zero.
+    constexpr auto DivMod(const std::uint32_t divisor) const noexcept
+        -> std::pair<UInt256, std::uint32_t>
+    {
+        auto output = std::pair<UInt256, std::uint32_t>{};
+        auto& [quotient, remainder] = output;
+        auto carry = std::uint64_t{0};
+
+        for (auto i = limbs_.size(); i > 0u; --i) {
+            const auto limb = limbs_[i - 1u];
+            const auto high = (carry << 32u) | (limb >> 32u);
+            const auto hq = high / divisor;
+            carry = high % divisor;
+            const auto low = (carry << 32u) | (limb & 0xffffffffu);
+            const auto lq = low / divisor;
+            carry = low % divisor;
+            quotient.limbs_[i - 1u] = (hq << 32u) | lq;
+        }
+
+        remainder = static_cast<std::uint32_t>(carry);
+
+        return output;
+    }
+    // Long division on 32 bit digits (Knuth, TAOCP vol. 2, algorithm D).
+    // The divisor must not be zero.
+    constexpr auto DivMod(const UInt256& divisor) const noexcept
+        -> std::pair<UInt256, UInt256>
+    {
+        auto output = std::pair<UInt256, UInt256>{};
+        auto& [quotient, remainder] = output;
+
+        if (*this < divisor) {
+            remainder = *this;
+
+            return output;
+        }
+
+        const auto n = (divisor.Bits() + 31u) / 32u;
+
+        if (1u == n) {
+            const auto small = static_cast<std::uint32_t>(divisor.Limb(0));
+            const auto [value, rest] = DivMod(small);
+            quotient = value;
+            remainder = UInt256{rest};
+
+            return output;
+        }
+
+        const auto m = (Bits() + 31u) / 32u;
+        // Normalize so the most significant divisor digit has its high bit set
+        const auto shift = (32u - (divisor.Bits() % 32u)) % 32u;
+        const auto v = (divisor << shift).digits();
+        auto u = (*this << shift).digits();
+        // The normalized dividend may need one more digit than the original
+        u[m] = (0u == shift) ? 0u : digit(m - 1u) >> (32u - shift);
+        auto q = Digits{};
+        constexpr auto base = std::uint64_t{1} << 32u;
+
+        for (auto j = m - n + 1u; j > 0u; --j) {
+            const auto k = j - 1u;
+            const auto top = (std::uint64_t{u[k + n]} << 32u) | u[k + n - 1u];
+            auto qhat = top / v[n - 1u];
+            auto rhat = top % v[n - 1u];
+
+            while ((qhat >= base) ||
+                   ((qhat * v[n - 2u]) > ((rhat << 32u) | u[k + n - 2u]))) {
+                --qhat;
+                rhat += v[n - 1u];
+
+                if (rhat >= base) { break; }
+            }
+
+            // Multiply and subtract
+            auto borrow = std::int64_t{0};
+
+            for (auto i = std::size_t{0}; i < n; ++i) {
+                const auto product = qhat * v[i];
+                const auto t = std::int64_t{u[i + k]} - borrow -
+                               static_cast<std::int64_t>(product & 0xffffffffu);
+                u[i + k] = static_cast<std::uint32_t>(t);
+                borrow = static_cast<std::int64_t>(product >> 32u) - (t >> 32);
+            }
+
+            const auto t = std::int64_t{u[k + n]} - borrow;
+            u[k + n] = static_cast<std::uint32_t>(t);
+            q[k] = static_cast<std::uint32_t>(qhat);
+
+            // The estimate was one too large so add the divisor back
+            if (0 > t) {
+                --q[k];
+                auto carry = std::uint64_t{0};
+
+                for (auto i = std::size_t{0}; i < n; ++i) {
+                    const auto sum = std::uint64_t{u[i + k]} + v[i] + carry;
+                    u[i + k] = static_cast<std::uint32_t>(sum);
+                    carry = sum >> 32u;
+                }
+
+                u[k + n] += static_cast<std::uint32_t>(carry);
+            }
+        }
+
+        quotient = from_digits(q);
+        remainder = from_digits(u) >> shift;
+
+        return output;
+    }
+    constexpr auto IsZero() const noexcept -> bool
+    {
+        for (const auto& limb : limbs_) {
+            if (0u != limb) { return false; }
+        }
+
+        return true;
+    }
+    constexpr auto Limb(const std::size_t index) const noexcept
+        -> std::uint64_t
+    {
+        return limbs_[index];
+    }
+
+    constexpr UInt256(const std::uint64_t value) noexcept
+        : limbs_{value, 0u, 0u, 0u}
+    {
+    }
+    constexpr UInt256(const Limbs& limbs) noexcept
+        : limbs_(limbs)
+    {
+    }
+    constexpr UInt256() noexcept
+        : limbs_{0u, 0u, 0u, 0u}
+    {
+    }
+
+private:
+    // 32 bit digits, least significant first, with room for one extra digit
+    using Digits = std::array<std::uint32_t, 9>;
+
+    Limbs limbs_;
+
+    static constexpr auto from_digits(const Digits& digits) noexcept
+        -> UInt256
+    {
+        auto output = UInt256{};
+
+        for (auto i = std::size_t{0}; i < output.limbs_.size(); ++i) {
+            output.limbs_[i] = (std::uint64_t{digits[2u * i + 1u]} << 32u) |
+                               digits[2u * i];
+        }
+
+        return output;
+    }
+
+    static auto from_bytes(
+        const ReadView bytes,
+        UInt256& output,
+        const bool bigEndian) noexcept -> bool
+    {
+        auto value = UInt256{};
+        const auto* data = reinterpret_cast<const std::uint8_t*>(bytes.data());
+        const auto size = bytes.size();
+
+        for (auto i = std::size_t{0}; i < size; ++i) {
+            // Significance of the byte, 0 for the least significant byte
+            const auto position = bigEndian ? (size - 1u - i) : i;
+            const auto byte = std::uint64_t{data[i]};
+
+            if (position >= bytes_) {
+                if (0u != byte) { return false; }
+
+                continue;
+            }
+
+            value.limbs_[position / 8u] |= byte << (8u * (position % 8u));
+        }
+
+        output = value;
+
+        return true;
+    }
+
+    constexpr auto digit(const std::size_t index) const noexcept
+        -> std::uint32_t
+    {
+        return static_cast<std::uint32_t>(
+            limbs_[index / 2u] >> (32u * (index % 2u)));
+    }
+    constexpr auto digits() const noexcept -> Digits
+    {
+        auto output = Digits{};
+
+        for (auto i = std::size_t{0}; i < (2u * limbs_.size()); ++i) {
+            output[i] = digit(i);
+        }
+
+        return output;
+    }
+};
+}  // namespace opentxs::blockchain
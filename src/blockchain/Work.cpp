@@ -7,11 +7,11 @@
 #include "1_Internal.hpp"       // IWYU pragma: associated
 #include "blockchain/Work.hpp"  // IWYU pragma: associated
 
-#include <boost/exception/exception.hpp>
-#include <iterator>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
+#include "blockchain/NumericHash.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/blockchain/NumericHash.hpp"
@@ -20,7 +20,7 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 
-#define OT_METHOD "opentxs::blockchain::implementation::Work::"
+// #define OT_METHOD "opentxs::blockchain::implementation::Work::"
 
 namespace opentxs::factory
 {
@@ -34,36 +34,41 @@ auto Work(const std::string& hex) -> blockchain::Work*
     if (bytes->empty()) { return new ReturnType(); }
 
     ValueType value{};
-    mp::cpp_int i;
 
-    try {
-        // Interpret bytes as big endian
-        mp::import_bits(i, bytes->begin(), bytes->end(), 8, true);
-        value = ValueType{i};
-    } catch (...) {
+    // Interpret bytes as big endian. Only the integer part is serialized.
+    if ((false == ValueType::FromBigEndian(bytes->Bytes(), value)) ||
+        (value.Bits() > (ValueType::bits_ - ReturnType::fraction_bits_))) {
         LogOutput("opentxs::factory::")(__FUNCTION__)(": Failed to decode work")
             .Flush();
 
         return new ReturnType();
     }
 
-    return new ReturnType(std::move(value));
+    return new ReturnType(value << ReturnType::fraction_bits_);
 }
 
 auto Work(const blockchain::NumericHash& input) -> blockchain::Work*
 {
     using ReturnType = blockchain::implementation::Work;
-    using TargetType = mp::checked_cpp_int;
     using ValueType = ReturnType::Type;
-    ValueType value{};
 
-    try {
-        const auto maxTarget =
-            factory::NumericHashNBits(blockchain::NumericHash::MaxTarget);
-        const TargetType targetOne{maxTarget->Decimal()};
-        const TargetType target{input.Decimal()};
-        value = ValueType{targetOne} / ValueType{target};
-    } catch (...) {
+    // Decoded value of blockchain::NumericHash::MaxTarget (0x1d00ffff)
+    static constexpr auto targetOne = ValueType{0xffff} << 208u;
+    const auto& target =
+        dynamic_cast<const blockchain::implementation::NumericHash&>(input)
+            .Value();
+
+    if (target.IsZero()) {
+        LogOutput("opentxs::factory::")(__FUNCTION__)(
+            ": Failed to calculate difficulty")
+            .Flush();
+
+        return new ReturnType();
+    }
+
+    auto [quotient, remainder] = targetOne.DivMod(target);
+
+    if (quotient.Bits() > (ValueType::bits_ - ReturnType::fraction_bits_)) {
         LogOutput("opentxs::factory::")(__FUNCTION__)(
             ": Failed to calculate difficulty")
             .Flush();
@@ -71,6 +76,19 @@ auto Work(const blockchain::NumericHash& input) -> blockchain::Work*
         return new ReturnType();
     }
 
+    // Continue the long division into the fractional bits
+    auto value = quotient << ReturnType::fraction_bits_;
+
+    for (auto i = ReturnType::fraction_bits_; i > 0u; --i) {
+        const auto carry = remainder.Bit(ValueType::bits_ - 1u);
+        remainder = remainder << 1u;
+
+        if (carry || (remainder >= target)) {
+            remainder = remainder - target;
+            value = value | (ValueType{1} << (i - 1u));
+        }
+    }
+
     return new ReturnType(std::move(value));
 }
 }  // namespace opentxs::factory
@@ -183,17 +201,31 @@ auto Work::operator+(const blockchain::Work& rhs) const noexcept -> OTWork
 
 auto Work::asHex() const noexcept -> std::string
 {
-    std::vector<unsigned char> bytes;
+    // Export the integer part as big endian
+    const auto bytes = (data_ >> fraction_bits_).BigEndian();
 
-    try {
-        // Export as big endian
-        mp::export_bits(mp::cpp_int(data_), std::back_inserter(bytes), 8, true);
-    } catch (...) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to encode number").Flush();
+    return opentxs::Data::Factory(bytes.data(), bytes.size())->asHex();
+}
 
-        return {};
+auto Work::Decimal() const noexcept -> std::string
+{
+    static constexpr auto digits = std::size_t{17};
+    auto output = (data_ >> fraction_bits_).Decimal();
+    auto fraction = (data_ << (Type::bits_ - fraction_bits_)) >>
+                    (Type::bits_ - fraction_bits_);
+
+    if (fraction.IsZero()) { return output; }
+
+    output += '.';
+
+    for (auto i = std::size_t{0}; (i < digits) && (false == fraction.IsZero());
+         ++i) {
+        const auto scaled = (fraction << 3u) + (fraction << 1u);
+        output += static_cast<char>('0' + scaled.Limb(1));
+        fraction = (scaled << (Type::bits_ - fraction_bits_)) >>
+                   (Type::bits_ - fraction_bits_);
     }
 
-    return opentxs::Data::Factory(bytes.data(), bytes.size())->asHex();
+    return output;
 }
 }  // namespace opentxs::blockchain::implementation
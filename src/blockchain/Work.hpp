@@ -8,10 +8,10 @@
 
 #pragma once
 
-#include <boost/multiprecision/cpp_bin_float.hpp>
-#include <boost/multiprecision/cpp_int.hpp>
+#include <cstddef>
 #include <string>
 
+#include "blockchain/UInt256.hpp"
 #include "opentxs/blockchain/Work.hpp"
 
 namespace opentxs
@@ -19,14 +19,15 @@ namespace opentxs
 class Factory;
 }  // namespace opentxs
 
-namespace mp = boost::multiprecision;
-
 namespace opentxs::blockchain::implementation
 {
 class Work : virtual public blockchain::Work
 {
 public:
-    using Type = mp::cpp_bin_float_double;
+    // Fixed point difficulty with fraction_bits_ fractional bits
+    using Type = UInt256;
+
+    static constexpr std::size_t fraction_bits_{64};
 
     auto operator==(const blockchain::Work& rhs) const noexcept -> bool final;
     auto operator!=(const blockchain::Work& rhs) const noexcept -> bool final;
@@ -37,7 +38,7 @@ public:
     auto operator+(const blockchain::Work& rhs) const noexcept -> OTWork final;
 
     auto asHex() const noexcept -> std::string final;
-    auto Decimal() const noexcept -> std::string final { return data_.str(); }
+    auto Decimal() const noexcept -> std::string final;
 
     Work(Type&& data) noexcept;
     Work() noexcept;
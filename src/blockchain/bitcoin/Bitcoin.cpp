@@ -169,12 +169,12 @@ auto EncodedTransaction::Deserialize(
         LogTrace("opentxs::blockchain::bitcoin::EncodedTransaction::")(
             __FUNCTION__)(": input script bytes: ")(scriptBytes.Value())
             .Flush();
-        expectedSize += scriptBytes.Value();
-
-        if (in.size() < expectedSize) {
+        if (scriptBytes.Value() > (in.size() - expectedSize)) {
             throw std::runtime_error("Partial input (script)");
         }
 
+        expectedSize += scriptBytes.Value();
+
         script.assign(it, it + scriptBytes.Value());
         std::advance(it, scriptBytes.Value());
         expectedSize += sizeof(sequence);
@@ -233,12 +233,12 @@ auto EncodedTransaction::Deserialize(
         LogTrace("opentxs::blockchain::bitcoin::EncodedTransaction::")(
             __FUNCTION__)(": output script bytes: ")(scriptBytes.Value())
             .Flush();
-        expectedSize += scriptBytes.Value();
-
-        if (in.size() < expectedSize) {
+        if (scriptBytes.Value() > (in.size() - expectedSize)) {
             throw std::runtime_error("Partial output (script)");
         }
 
+        expectedSize += scriptBytes.Value();
+
         script.assign(it, it + scriptBytes.Value());
         std::advance(it, scriptBytes.Value());
     }
@@ -269,12 +269,12 @@ auto EncodedTransaction::Deserialize(
                     __FUNCTION__)(": push ")(w)(" bytes: ")(
                     witnessBytes.Value())
                     .Flush();
-                expectedSize += witnessBytes.Value();
-
-                if (in.size() < expectedSize) {
+                if (witnessBytes.Value() > (in.size() - expectedSize)) {
                     throw std::runtime_error("Partial witness item");
                 }
 
+                expectedSize += witnessBytes.Value();
+
                 push.assign(it, it + witnessBytes.Value());
                 std::advance(it, witnessBytes.Value());
             }
@@ -389,4 +389,127 @@ auto EncodedWitnessItem::size() const noexcept -> std::size_t
 {
     return cs_.Total();
 }
+
+auto TransactionLayout::Scan(const ReadView in) noexcept(false)
+    -> TransactionLayout
+{
+    if ((nullptr == in.data()) || (0 == in.size())) {
+        throw std::runtime_error("Invalid bytes");
+    }
+
+    auto output = TransactionLayout{};
+    const auto start = reinterpret_cast<ByteIterator>(in.data());
+    auto it{start};
+    auto expectedSize = sizeof(EncodedTransaction::version_);
+    auto count = std::size_t{};
+    auto bytes = std::size_t{};
+    const auto skip = [&](const std::size_t fixed, const char* error) {
+        expectedSize += fixed + 1;
+
+        if (in.size() < expectedSize) { throw std::runtime_error(error); }
+
+        std::advance(it, fixed);
+
+        if (false ==
+            DecodeCompactSizeFromPayload(it, expectedSize, in.size(), bytes)) {
+            throw std::runtime_error(error);
+        }
+
+        if (bytes > (in.size() - expectedSize)) {
+            throw std::runtime_error(error);
+        }
+
+        expectedSize += bytes;
+
+        std::advance(it, bytes);
+    };
+    const auto readCount = [&](const char* error) {
+        expectedSize += 1;
+
+        if (in.size() < expectedSize) { throw std::runtime_error(error); }
+
+        if (false ==
+            DecodeCompactSizeFromPayload(it, expectedSize, in.size(), count)) {
+            throw std::runtime_error(error);
+        }
+    };
+
+    if (in.size() < expectedSize) {
+        throw std::runtime_error("Partial transaction (version)");
+    }
+
+    std::advance(it, expectedSize);
+    output.segwit_ = HasSegwit(it, expectedSize, in.size()).has_value();
+    output.body_ = static_cast<std::size_t>(std::distance(start, it));
+    readCount("Partial transaction (txin count)");
+    const auto inputs{count};
+
+    for (auto i = std::size_t{0}; i < inputs; ++i) {
+        skip(sizeof(EncodedOutpoint), "Partial input");
+        expectedSize += sizeof(EncodedInput::sequence_);
+
+        if (in.size() < expectedSize) {
+            throw std::runtime_error("Partial input (sequence)");
+        }
+
+        std::advance(it, sizeof(EncodedInput::sequence_));
+    }
+
+    readCount("Partial transaction (txout count)");
+
+    const auto outputs{count};
+
+    for (auto i = std::size_t{0}; i < outputs; ++i) {
+        skip(sizeof(EncodedOutput::value_), "Partial output");
+    }
+
+    output.body_size_ =
+        static_cast<std::size_t>(std::distance(start, it)) - output.body_;
+
+    if (output.segwit_) {
+        for (auto i = std::size_t{0}; i < inputs; ++i) {
+            readCount("Partial witness");
+            const auto items{count};
+
+            for (auto w = std::size_t{0}; w < items; ++w) {
+                skip(0, "Partial witness item");
+            }
+        }
+    }
+
+    expectedSize += sizeof(EncodedTransaction::lock_time_);
+
+    if (in.size() < expectedSize) {
+        throw std::runtime_error("Partial transaction (lock time)");
+    }
+
+    output.size_ = expectedSize;
+
+    return output;
+}
+
+auto TransactionLayout::Txid(
+    const api::Core& api,
+    const blockchain::Type chain,
+    const ReadView in,
+    const AllocateOutput destination) const noexcept -> bool
+{
+    if (in.size() < size_) { return false; }
+
+    if (false == segwit_) {
+        return TransactionHash(api, chain, in.substr(0, size_), destination);
+    }
+
+    constexpr auto version = sizeof(EncodedTransaction::version_);
+    constexpr auto lockTime = sizeof(EncodedTransaction::lock_time_);
+    auto preimage = space(version + body_size_ + lockTime);
+    auto it = preimage.data();
+    std::memcpy(it, in.data(), version);
+    std::advance(it, version);
+    std::memcpy(it, in.data() + body_, body_size_);
+    std::advance(it, body_size_);
+    std::memcpy(it, in.data() + (size_ - lockTime), lockTime);
+
+    return TransactionHash(api, chain, reader(preimage), destination);
+}
 }  // namespace opentxs::blockchain::bitcoin
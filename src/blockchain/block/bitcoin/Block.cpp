@@ -9,6 +9,7 @@
 
 #include <boost/endian/buffers.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -16,12 +17,13 @@
 #include <iterator>
 #include <limits>
 #include <map>
-#include <numeric>
-#include <optional>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "blockchain/block/Block.hpp"
@@ -39,6 +41,9 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "util/Container.hpp"
+#include "util/Parallel.hpp"
+
+#define MINIMUM_TRANSACTIONS_PER_THREAD 16
 
 #define OT_METHOD "opentxs::blockchain::block::bitcoin::implementation::Block::"
 
@@ -54,8 +59,20 @@ auto BitcoinBlock(
     const ReadView in) noexcept
     -> std::shared_ptr<blockchain::block::bitcoin::Block>
 {
-    auto data = api.Factory().Data(in);
+    // The caller does not guarantee the lifetime of the input
+    auto copy = std::make_shared<Space>(space(in));
+    const auto bytes = reader(*copy);
+
+    return BitcoinBlock(api, chain, std::move(copy), bytes);
+}
 
+auto BitcoinBlock(
+    const api::client::Manager& api,
+    const blockchain::Type chain,
+    std::shared_ptr<const void> backing,
+    const ReadView in) noexcept
+    -> std::shared_ptr<blockchain::block::bitcoin::Block>
+{
     try {
         if ((nullptr == in.data()) || (0 == in.size())) {
             throw std::runtime_error("Invalid block input");
@@ -77,7 +94,6 @@ auto BitcoinBlock(
             throw std::runtime_error("Invalid block header");
         }
 
-        const auto& header = *pHeader;
         std::advance(it, ReturnType::header_bytes_);
         expectedSize += 1;
 
@@ -86,9 +102,7 @@ auto BitcoinBlock(
                 "Block size too short (transaction count)");
         }
 
-        auto sizeData =
-            ReturnType::CalculatedSize{in.size(), bb::CompactSize{}};
-        auto& [size, txCount] = sizeData;
+        auto txCount = bb::CompactSize{};
 
         if (false == bb::DecodeCompactSizeFromPayload(
                          it, expectedSize, in.size(), txCount)) {
@@ -99,38 +113,25 @@ auto BitcoinBlock(
 
         if (0 == transactionCount) { throw std::runtime_error("Empty block"); }
 
-        auto counter = int{-1};
-        auto index = ReturnType::TxidIndex{};
-        auto transactions = ReturnType::TransactionMap{};
-
-        while (transactions.size() < transactionCount) {
-            auto data = bb::EncodedTransaction::Deserialize(
-                api,
-                chain,
-                ReadView{
-                    reinterpret_cast<const char*>(it),
-                    in.size() - expectedSize});
-            const auto txBytes = data.size();
-            std::advance(it, txBytes);
-            expectedSize += txBytes;
-            auto& txid = index.emplace_back(data.txid_);
-            transactions.emplace(
-                reader(txid),
-                BitcoinTransaction(
-                    api,
-                    chain,
-                    (0 == ++counter),
-                    header.Timestamp(),
-                    std::move(data)));
+        auto index = ReturnType::PositionIndex{};
+
+        while (index.size() < transactionCount) {
+            const auto remaining = ReadView{
+                reinterpret_cast<const char*>(it), in.size() - expectedSize};
+            const auto layout = bb::TransactionLayout::Scan(remaining);
+            index.emplace_back(remaining.substr(0, layout.size_), layout);
+            std::advance(it, layout.size_);
+            expectedSize += layout.size_;
         }
 
         return std::make_shared<ReturnType>(
             api,
             chain,
             std::move(pHeader),
+            std::move(backing),
+            in.substr(0, expectedSize),
             std::move(index),
-            std::move(transactions),
-            std::move(sizeData));
+            ReturnType::CalculatedSize{expectedSize, std::move(txCount)});
     } catch (const std::exception& e) {
         LogOutput("opentxs::factory::")(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -237,25 +238,40 @@ Block::Block(
     const api::client::Manager& api,
     const blockchain::Type chain,
     std::unique_ptr<const internal::Header> header,
-    TxidIndex&& index,
-    TransactionMap&& transactions,
-    std::optional<CalculatedSize>&& size) noexcept(false)
+    Backing&& backing,
+    const ReadView bytes,
+    PositionIndex&& index,
+    CalculatedSize&& size) noexcept(false)
     : block::implementation::Block(api, *header)
+    , chain_(chain)
     , header_p_(std::move(header))
     , header_(*header_p_)
+    , backing_(std::move(backing))
+    , bytes_(bytes)
     , index_(std::move(index))
-    , transactions_(std::move(transactions))
     , size_(std::move(size))
+    , lock_()
+    , transactions_(index_.size())
+    , txids_()
+    , txid_map_()
 {
     if (false == bool(header_p_)) {
         throw std::runtime_error("Invalid header");
     }
 
-    for (const auto& [txid, tx] : transactions_) {
-        if (false == bool(tx)) {
-            throw std::runtime_error("Invalid transaction");
-        }
+    if (false == bool(backing_)) {
+        throw std::runtime_error("Invalid backing");
+    }
+
+    if (bytes_.size() != size_.first) {
+        throw std::runtime_error("Incorrect block size");
     }
+
+    // A block containing a transaction which can not be decoded is invalid
+    parallel_for(
+        index_.size(),
+        [&](const std::size_t i) { transactions_.at(i) = decode(i); },
+        MINIMUM_TRANSACTIONS_PER_THREAD);
 }
 
 auto Block::at(const std::size_t index) const noexcept -> const value_type&
@@ -265,7 +281,7 @@ auto Block::at(const std::size_t index) const noexcept -> const value_type&
             throw std::out_of_range("invalid index " + std::to_string(index));
         }
 
-        return at(reader(index_.at(index)));
+        return transactions_.at(index);
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -276,8 +292,13 @@ auto Block::at(const std::size_t index) const noexcept -> const value_type&
 auto Block::at(const ReadView txid) const noexcept -> const value_type&
 {
     try {
+        const auto index = [&] {
+            Lock lock(lock_);
+
+            return txids(lock).at(txid);
+        }();
 
-        return transactions_.at(txid);
+        return at(index);
     } catch (...) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": transaction ")(
             api_.Factory().Data(txid)->asHex())(" not found in block ")(
@@ -288,34 +309,40 @@ auto Block::at(const ReadView txid) const noexcept -> const value_type&
     }
 }
 
-auto Block::calculate_size() const noexcept -> CalculatedSize
+auto Block::decode(const std::size_t index) const noexcept(false) -> value_type
 {
-    if (false == size_.has_value()) {
-        size_ = CalculatedSize{0, bb::CompactSize(transactions_.size())};
-        auto& [bytes, cs] = size_.value();
-        auto cb = [](const auto& previous, const auto& in) -> std::size_t {
-            return previous + in.second->CalculateSize();
-        };
-        bytes = std::accumulate(
-            std::begin(transactions_),
-            std::end(transactions_),
-            header_bytes_ + cs.Size(),
-            cb);
+    const auto& [bytes, layout] = index_.at(index);
+    auto output = value_type{factory::BitcoinTransaction(
+        api_,
+        chain_,
+        (0 == index),
+        header_.Timestamp(),
+        bb::EncodedTransaction::Deserialize(api_, chain_, bytes))};
+
+    if (false == bool(output)) {
+        throw std::runtime_error(
+            "Failed to decode transaction " + std::to_string(index));
     }
 
-    return size_.value();
+    return output;
 }
 
 auto Block::ExtractElements(const FilterType style) const noexcept
     -> std::vector<Space>
 {
     auto output = std::vector<Space>{};
-    LogTrace(OT_METHOD)(__FUNCTION__)(": processing ")(transactions_.size())(
+    auto elements = std::vector<std::vector<Space>>(index_.size());
+    LogTrace(OT_METHOD)(__FUNCTION__)(": processing ")(index_.size())(
         " transactions")
         .Flush();
-
-    for (const auto& [txid, tx] : transactions_) {
-        auto temp = tx->ExtractElements(style);
+    parallel_for(
+        index_.size(),
+        [&](const std::size_t i) {
+            elements.at(i) = transactions_.at(i)->ExtractElements(style);
+        },
+        MINIMUM_TRANSACTIONS_PER_THREAD);
+
+    for (auto& temp : elements) {
         output.insert(
             output.end(),
             std::make_move_iterator(temp.begin()),
@@ -337,9 +364,16 @@ auto Block::FindMatches(
     if (0 == (outpoints.size() + patterns.size())) { return {}; }
 
     auto output = Matches{};
-
-    for (const auto& [txid, tx] : transactions_) {
-        auto temp = tx->FindMatches(style, outpoints, patterns);
+    auto matches = std::vector<Matches>(index_.size());
+    parallel_for(
+        index_.size(),
+        [&](const std::size_t i) {
+            matches.at(i) =
+                transactions_.at(i)->FindMatches(style, outpoints, patterns);
+        },
+        MINIMUM_TRANSACTIONS_PER_THREAD);
+
+    for (auto& temp : matches) {
         output.insert(
             output.end(),
             std::make_move_iterator(temp.begin()),
@@ -360,7 +394,7 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
         return false;
     }
 
-    const auto [size, txCount] = calculate_size();
+    const auto& [size, txCount] = size_;
     const auto out = bytes(size);
 
     if (false == out.valid(size)) {
@@ -373,63 +407,41 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
     LogInsane(OT_METHOD)(__FUNCTION__)(": Serializing ")(txCount.Value())(
         " transactions into ")(size)(" bytes.")
         .Flush();
-    auto remaining{size};
-    auto it = static_cast<std::byte*>(out.data());
-
-    if (false == header_.Serialize(preallocated(remaining, it))) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to serialize header")
-            .Flush();
+    std::memcpy(out.data(), bytes_.data(), size);
 
-        return false;
-    }
-
-    remaining -= header_bytes_;
-    std::advance(it, header_bytes_);
-
-    if (false == txCount.Encode(preallocated(remaining, it))) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(
-            ": Failed to serialize transaction count")
-            .Flush();
-
-        return false;
-    }
-
-    remaining -= txCount.Size();
-    std::advance(it, txCount.Size());
-
-    for (const auto& txid : index_) {
-        try {
-            const auto& pTX = transactions_.at(reader(txid));
-
-            OT_ASSERT(pTX);
+    return true;
+}
 
-            const auto& tx = *pTX;
-            const auto encoded = tx.Serialize(preallocated(remaining, it));
+auto Block::txids(const Lock& lock) const noexcept -> const TransactionMap&
+{
+    if (false == txid_map_.empty()) { return txid_map_; }
 
-            if (false == encoded.has_value()) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": failed to serialize transaction ")(tx.ID().asHex())
-                    .Flush();
+    auto ids = TxidIndex(index_.size());
+    auto failed = std::atomic<bool>{false};
+    parallel_for(
+        index_.size(),
+        [&](const std::size_t i) {
+            const auto& [bytes, layout] = index_.at(i);
 
-                return false;
+            if (false == layout.Txid(api_, chain_, bytes, writer(ids.at(i)))) {
+                failed = true;
             }
+        },
+        MINIMUM_TRANSACTIONS_PER_THREAD);
 
-            remaining -= encoded.value();
-            std::advance(it, encoded.value());
-        } catch (...) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": missing transaction").Flush();
+    if (failed) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to calculate txids")
+            .Flush();
 
-            return false;
-        }
+        return txid_map_;
     }
 
-    if (0 != remaining) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Extra bytes: ")(remaining)
-            .Flush();
+    txids_ = std::move(ids);
 
-        return false;
+    for (auto i = std::size_t{0}; i < txids_.size(); ++i) {
+        txid_map_.emplace(reader(txids_.at(i)), i);
     }
 
-    return true;
+    return txid_map_;
 }
 }  // namespace opentxs::blockchain::block::bitcoin::implementation
@@ -8,13 +8,14 @@
 #include <iosfwd>
 #include <map>
 #include <memory>
-#include <optional>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 #include "1_Internal.hpp"
 #include "blockchain/bitcoin/CompactSize.hpp"
 #include "blockchain/block/Block.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/Block.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Types.hpp"
@@ -36,13 +37,21 @@ namespace bb = opentxs::blockchain::bitcoin;
 
 namespace opentxs::blockchain::block::bitcoin::implementation
 {
+// Every transaction is decoded in parallel when the block is constructed and
+// the txid index is built the first time a transaction is looked up by txid.
+// backing_ keeps the serialized bytes valid for the lifetime of the block.
+// Blocks received by the block oracle share the zmq frame which carried them;
+// every other block, including those loaded from the block files, owns a
+// private copy made by the ReadView factory.
 class Block final : public bitcoin::Block, public block::implementation::Block
 {
 public:
+    using Backing = std::shared_ptr<const void>;
     using CalculatedSize =
         std::pair<std::size_t, blockchain::bitcoin::CompactSize>;
-    using TxidIndex = std::vector<Space>;
-    using TransactionMap = std::map<ReadView, value_type>;
+    using Position =
+        std::pair<ReadView, blockchain::bitcoin::TransactionLayout>;
+    using PositionIndex = std::vector<Position>;
 
     static const std::size_t header_bytes_;
 
@@ -51,7 +60,7 @@ public:
     auto begin() const noexcept -> const_iterator final { return cbegin(); }
     auto CalculateSize() const noexcept -> std::size_t final
     {
-        return calculate_size().first;
+        return size_.first;
     }
     auto cbegin() const noexcept -> const_iterator final
     {
@@ -75,20 +84,31 @@ public:
         const api::client::Manager& api,
         const blockchain::Type chain,
         std::unique_ptr<const internal::Header> header,
-        TxidIndex&& index,
-        TransactionMap&& transactions,
-        std::optional<CalculatedSize>&& size = {}) noexcept(false);
+        Backing&& backing,
+        const ReadView bytes,
+        PositionIndex&& index,
+        CalculatedSize&& size) noexcept(false);
 
 private:
+    using TxidIndex = std::vector<Space>;
+    using TransactionMap = std::map<ReadView, std::size_t>;
+
     static const value_type null_tx_;
 
+    const blockchain::Type chain_;
     const std::unique_ptr<const internal::Header> header_p_;
     const internal::Header& header_;
-    const TxidIndex index_;
-    const TransactionMap transactions_;
-    mutable std::optional<CalculatedSize> size_;
+    const Backing backing_;
+    const ReadView bytes_;
+    const PositionIndex index_;
+    const CalculatedSize size_;
+    mutable std::mutex lock_;
+    std::vector<value_type> transactions_;
+    mutable TxidIndex txids_;
+    mutable TransactionMap txid_map_;
 
-    auto calculate_size() const noexcept -> CalculatedSize;
+    auto decode(const std::size_t index) const noexcept(false) -> value_type;
+    auto txids(const Lock& lock) const noexcept -> const TransactionMap&;
 
     Block() = delete;
     Block(const Block&) = delete;
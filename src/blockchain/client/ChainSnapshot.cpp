@@ -0,0 +1,121 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                           // IWYU pragma: associated
+#include "1_Internal.hpp"                         // IWYU pragma: associated
+#include "internal/blockchain/client/Client.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cstring>
+
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Log.hpp"
+
+namespace opentxs::blockchain::client::internal
+{
+const std::size_t ChainSnapshot::chunk_size_{2048};
+const std::size_t ChainSnapshot::hash_size_{sizeof(Entry)};
+
+ChainSnapshot::ChainSnapshot() noexcept
+    : chunks_()
+    , owned_()
+    , size_(0)
+{
+}
+
+ChainSnapshot::ChainSnapshot(const ChainSnapshot& rhs) noexcept
+    : chunks_(rhs.chunks_)
+    , owned_(rhs.chunks_.size(), false)
+    , size_(rhs.size_)
+{
+}
+
+auto ChainSnapshot::Contains(
+    const block::Height height,
+    const block::Hash& hash) const noexcept -> bool
+{
+    if ((0 > height) || (static_cast<std::size_t>(height) >= size_)) {
+
+        return false;
+    }
+
+    if (sizeof(Entry) != hash.size()) { return false; }
+
+    const auto index = static_cast<std::size_t>(height);
+    const auto& entry =
+        chunks_.at(index / chunk_size_)->at(index % chunk_size_);
+
+    return 0 == std::memcmp(entry.data(), hash.data(), entry.size());
+}
+
+auto ChainSnapshot::Hash(const block::Height height)
+    const noexcept -> block::pHash
+{
+    if ((0 > height) || (static_cast<std::size_t>(height) >= size_)) {
+
+        return Data::Factory();
+    }
+
+    const auto index = static_cast<std::size_t>(height);
+    const auto& entry =
+        chunks_.at(index / chunk_size_)->at(index % chunk_size_);
+
+    return Data::Factory(entry.data(), entry.size());
+}
+
+auto ChainSnapshot::Set(
+    const block::Height height,
+    const block::Hash& hash) noexcept -> void
+{
+    OT_ASSERT(0 <= height);
+    OT_ASSERT(sizeof(Entry) == hash.size());
+
+    const auto index = static_cast<std::size_t>(height);
+    const auto chunk = index / chunk_size_;
+
+    while (chunks_.size() <= chunk) {
+        auto& added = chunks_.emplace_back(std::make_shared<Chunk>());
+        added->reserve(chunk_size_);
+        owned_.emplace_back(true);
+    }
+
+    if (false == owned_.at(chunk)) {
+        chunks_.at(chunk) = std::make_shared<Chunk>(*chunks_.at(chunk));
+        owned_.at(chunk) = true;
+    }
+
+    auto& entries = *chunks_.at(chunk);
+    const auto offset = index % chunk_size_;
+
+    if (offset >= entries.size()) { entries.resize(offset + 1u); }
+
+    std::memcpy(entries.at(offset).data(), hash.data(), hash.size());
+    size_ = std::max(size_, index + 1u);
+}
+
+auto ChainSnapshot::Tip() const noexcept -> block::Position
+{
+    if (0 == size_) { return {-1, Data::Factory()}; }
+
+    const auto height = static_cast<block::Height>(size_ - 1u);
+
+    return {height, Hash(height)};
+}
+
+auto ChainSnapshot::Truncate(const block::Height height) noexcept -> void
+{
+    const auto size = static_cast<std::size_t>(std::max(height + 1, 0));
+
+    if (size >= size_) { return; }
+
+    // Entries past the end of the last chunk are left in place and
+    // overwritten by Set. Chunks which are no longer needed are released.
+    const auto chunks = (size + chunk_size_ - 1u) / chunk_size_;
+    chunks_.resize(chunks);
+    owned_.resize(chunks);
+    size_ = size;
+}
+}  // namespace opentxs::blockchain::client::internal
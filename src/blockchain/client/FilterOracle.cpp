@@ -16,6 +16,7 @@
 
 #include "blockchain/client/filteroracle/FilterCheckpoints.hpp"
 #include "core/Executor.hpp"
+#include "internal/api/client/Client.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -32,6 +33,8 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/Pipeline.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
+#include "opentxs/network/zeromq/socket/Socket.hpp"
+#include "util/Parallel.hpp"
 #include "util/ScopeGuard.hpp"
 #include "util/Work.hpp"
 
@@ -41,6 +44,7 @@ namespace opentxs::factory
 {
 auto BlockchainFilterOracle(
     const api::client::Manager& api,
+    const api::client::internal::Blockchain& blockchain,
     const blockchain::client::internal::Network& network,
     const blockchain::client::internal::HeaderOracle& header,
     const blockchain::client::internal::FilterDatabase& database,
@@ -51,16 +55,18 @@ auto BlockchainFilterOracle(
     using ReturnType = blockchain::client::implementation::FilterOracle;
 
     return std::make_unique<ReturnType>(
-        api, network, header, database, type, shutdown);
+        api, blockchain, network, header, database, type, shutdown);
 }
 }  // namespace opentxs::factory
 
 namespace opentxs::blockchain::client::implementation
 {
 constexpr std::size_t max_block_requests_{16};
+constexpr std::size_t match_batch_{100};
 
 FilterOracle::FilterOracle(
     const api::client::Manager& api,
+    const api::client::internal::Blockchain& blockchain,
     const internal::Network& network,
     const internal::HeaderOracle& header,
     const internal::FilterDatabase& database,
@@ -90,7 +96,7 @@ FilterOracle::FilterOracle(
     , init_promise_()
     , init_(init_promise_.get_future())
 {
-    auto zmq =
+    const auto zmq =
         socket_->Start(api.Endpoints().InternalBlockchainFilterUpdated(chain_));
 
     OT_ASSERT(zmq);
@@ -324,6 +330,62 @@ auto FilterOracle::compare_tips_to_header_chain() noexcept -> bool
     return true;
 }
 
+auto FilterOracle::FindMatches(
+    const filter::Type type,
+    const block::Height start,
+    const block::Height stop,
+    const Targets& targets) const noexcept -> FilterMatches
+{
+    if (start > stop) { return {{}, start - 1}; }
+
+    if (targets.empty()) { return {{}, stop}; }
+
+    auto blocks = std::vector<block::Position>{};
+    auto height{start};
+
+    for (auto& hash : header_.BestHashes(
+             start, static_cast<std::size_t>(stop - start + 1))) {
+        blocks.emplace_back(height++, std::move(hash));
+    }
+
+    // 0: filter missing, 1: no match, 2: match
+    auto results = std::vector<std::uint8_t>(blocks.size(), 0);
+    parallel_batch(
+        blocks.size(),
+        [&](const std::size_t first, const std::size_t last) {
+            auto hashes = std::vector<ReadView>{};
+            std::transform(
+                std::next(blocks.cbegin(), first),
+                std::next(blocks.cbegin(), last),
+                std::back_inserter(hashes),
+                [](const auto& position) { return position.second->Bytes(); });
+            const auto filters = database_.LoadFilters(type, hashes);
+
+            for (auto i = std::size_t{0}; i < filters.size(); ++i) {
+                const auto& pFilter = filters.at(i);
+
+                if (false == bool(pFilter)) { continue; }
+
+                results.at(first + i) = pFilter->MatchAny(targets) ? 2 : 1;
+            }
+        },
+        match_batch_);
+    auto output = FilterMatches{{}, start - 1};
+    auto& [positions, tested] = output;
+
+    for (auto i = std::size_t{0}; i < blocks.size(); ++i) {
+        const auto result = results.at(i);
+
+        if (0 == result) { break; }
+
+        if (2 == result) { positions.emplace_back(blocks.at(i)); }
+
+        tested = blocks.at(i).first;
+    }
+
+    return output;
+}
+
 auto FilterOracle::oldest_checkpoint_before(
     const block::Height height) const noexcept -> block::Height
 {
@@ -36,6 +36,11 @@ namespace api
 {
 namespace client
 {
+namespace internal
+{
+struct Blockchain;
+}  // namespace internal
+
 class Manager;
 }  // namespace client
 }  // namespace api
@@ -79,6 +84,11 @@ public:
     {
         return default_type_;
     }
+    auto FindMatches(
+        const filter::Type type,
+        const block::Height start,
+        const block::Height stop,
+        const Targets& targets) const noexcept -> FilterMatches final;
     auto LoadFilter(const filter::Type type, const block::Hash& block)
         const noexcept -> std::unique_ptr<const blockchain::internal::GCS> final
     {
@@ -93,6 +103,7 @@ public:
 
     FilterOracle(
         const api::client::Manager& api,
+        const api::client::internal::Blockchain& blockchain,
         const internal::Network& network,
         const internal::HeaderOracle& header,
         const internal::FilterDatabase& database,
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <future>
 #include <iterator>
@@ -17,6 +18,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "internal/blockchain/Blockchain.hpp"
 #include "opentxs/Bytes.hpp"
@@ -35,8 +37,11 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/crypto/key/EllipticCurve.hpp"
+#include "util/Parallel.hpp"
 #include "util/ScopeGuard.hpp"
 
+#define MINIMUM_KEYS_PER_THREAD 16
+
 #define OT_METHOD "opentxs::blockchain::client::implementation::HDStateData::"
 
 namespace opentxs::blockchain::client::implementation
@@ -128,66 +133,85 @@ auto HDStateData::index() noexcept -> void
     const auto first =
         last_indexed_.has_value() ? last_indexed_.value() + 1 : Bip32Index{0};
     const auto last = node_.LastGenerated(subchain_);
-    auto elements = WalletDatabase::ElementMap{};
+    auto keys = std::vector<ECKey>{};
 
     for (auto i{first}; i <= last; ++i) {
-        const auto& element = node_.BalanceElement(subchain_, i);
-        index_element(filter_type_, element, i, elements);
+        keys.emplace_back(node_.BalanceElement(subchain_, i).Key());
     }
 
+    auto elements = WalletDatabase::ElementMap{};
+    index_elements(filter_type_, first, keys, elements);
     db_.SubchainAddElements(node_.ID(), subchain_, filter_type_, elements);
 }
 
-auto HDStateData::index_element(
+auto HDStateData::index_elements(
     const filter::Type type,
-    const api::client::blockchain::BalanceNode::Element& input,
-    const Bip32Index index,
+    const Bip32Index first,
+    const std::vector<ECKey>& keys,
     WalletDatabase::ElementMap& output) noexcept -> void
 {
-    const auto pubkeyHash = input.PubkeyHash();
-    LogVerbose(OT_METHOD)(__FUNCTION__)(": Indexing public key with hash ")(
-        pubkeyHash->asHex())
-        .Flush();
-    auto& list = output[index];
-    auto scripts = std::vector<std::unique_ptr<const block::bitcoin::Script>>{};
-    scripts.reserve(4);  // WARNING keep this number up to date if new scripts
-                         // are added
-    const auto& p2pk =
-        scripts.emplace_back(network_.API().Factory().BitcoinScriptP2PK(
-            network_.Chain(), *input.Key()));
-    const auto& p2pkh =
-        scripts.emplace_back(network_.API().Factory().BitcoinScriptP2PKH(
-            network_.Chain(), *input.Key()));
-    const auto& p2sh_p2pk = scripts.emplace_back(
-        network_.API().Factory().BitcoinScriptP2SH(network_.Chain(), *p2pk));
-    const auto& p2sh_p2pkh = scripts.emplace_back(
-        network_.API().Factory().BitcoinScriptP2SH(network_.Chain(), *p2pkh));
-
-    OT_ASSERT(p2pk);
-    OT_ASSERT(p2pkh);
-    OT_ASSERT(p2sh_p2pk);
-    OT_ASSERT(p2sh_p2pkh);
-
-    switch (type) {
-        case filter::Type::Extended_opentxs: {
-            OT_ASSERT(p2pk->Pubkey().has_value());
-            OT_ASSERT(p2pkh->PubkeyHash().has_value());
-            OT_ASSERT(p2sh_p2pk->ScriptHash().has_value());
-            OT_ASSERT(p2sh_p2pkh->ScriptHash().has_value());
-
-            list.emplace_back(space(p2pk->Pubkey().value()));
-            list.emplace_back(space(p2pkh->PubkeyHash().value()));
-            list.emplace_back(space(p2sh_p2pk->ScriptHash().value()));
-            list.emplace_back(space(p2sh_p2pkh->ScriptHash().value()));
-        } break;
-        case filter::Type::Basic_BIP158:
-        case filter::Type::Basic_BCHVariant:
-        default: {
-            for (const auto& script : scripts) {
-                script->Serialize(writer(list.emplace_back()));
+    const auto& factory = network_.API().Factory();
+    const auto chain = network_.Chain();
+    const auto count = keys.size();
+    auto lists = std::vector<std::vector<Space>>(count);
+    parallel_for(
+        count,
+        [&](const std::size_t i) {
+            const auto& pKey = keys.at(i);
+
+            OT_ASSERT(pKey);
+
+            auto scripts =
+                std::vector<std::unique_ptr<const block::bitcoin::Script>>{};
+            scripts.reserve(4);  // WARNING keep this number up to date if new
+                                 // scripts are added
+            const auto& p2pk =
+                scripts.emplace_back(factory.BitcoinScriptP2PK(chain, *pKey));
+            const auto& p2pkh =
+                scripts.emplace_back(factory.BitcoinScriptP2PKH(chain, *pKey));
+
+            OT_ASSERT(p2pk);
+            OT_ASSERT(p2pkh);
+
+            const auto& p2sh_p2pk =
+                scripts.emplace_back(factory.BitcoinScriptP2SH(chain, *p2pk));
+            const auto& p2sh_p2pkh =
+                scripts.emplace_back(factory.BitcoinScriptP2SH(chain, *p2pkh));
+
+            OT_ASSERT(p2sh_p2pk);
+            OT_ASSERT(p2sh_p2pkh);
+
+            auto& list = lists.at(i);
+            list.reserve(scripts.size());
+
+            switch (type) {
+                case filter::Type::Extended_opentxs: {
+                    OT_ASSERT(p2pk->Pubkey().has_value());
+                    OT_ASSERT(p2pkh->PubkeyHash().has_value());
+                    OT_ASSERT(p2sh_p2pk->ScriptHash().has_value());
+                    OT_ASSERT(p2sh_p2pkh->ScriptHash().has_value());
+
+                    list.emplace_back(space(p2pk->Pubkey().value()));
+                    list.emplace_back(space(p2pkh->PubkeyHash().value()));
+                    list.emplace_back(space(p2sh_p2pk->ScriptHash().value()));
+                    list.emplace_back(space(p2sh_p2pkh->ScriptHash().value()));
+                } break;
+                case filter::Type::Basic_BIP158:
+                case filter::Type::Basic_BCHVariant:
+                default: {
+                    for (const auto& script : scripts) {
+                        script->Serialize(writer(list.emplace_back()));
+                    }
+                }
             }
-        }
+        },
+        MINIMUM_KEYS_PER_THREAD);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        output.emplace(first + static_cast<Bip32Index>(i), std::move(lists[i]));
     }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Indexed ")(count)(" keys").Flush();
 }
 
 auto HDStateData::process() noexcept -> void
@@ -303,64 +327,68 @@ auto HDStateData::scan() noexcept -> void
         last_scanned_.has_value()
             ? block::Position{startHeight, headers.BestHash(startHeight)}
             : block::Position{1, headers.BestHash(1)};
-    const auto stopHeight = std::min(startHeight + 9999, best.first);
+    const auto filterTip = network_.DB().FilterTip(filter_type_);
+    const auto stopHeight =
+        std::min({startHeight + 9999, best.first, filterTip.first});
 
     if (first.second->empty()) { return; }  // Reorg occured while processing
 
+    if (stopHeight < startHeight) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(
+            ": Missing filter for block at height ")(startHeight)
+            .Flush();
+
+        return;
+    }
+
     const auto elements = db_.GetPatterns(node_.ID(), subchain_, filter_type_);
     const auto utxos = db_.GetUnspentOutputs();
-    auto highestTested = last_scanned_.value_or(
-        make_blank<block::Position>::value(network_.API()));
-    auto atLeastOnce{false};
-
-    for (auto i{startHeight}; i <= stopHeight; ++i) {
-        auto blockHash = headers.BestHash(i);
+    const auto patterns = get_targets(elements, utxos);
+    const auto [matches, tested] =
+        filters.FindMatches(filter_type_, startHeight, stopHeight, patterns);
+    auto scanned = tested;
+
+    for (const auto& [height, blockHash] : matches) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": GCS for block ")(
+            blockHash->asHex())(" at height ")(height)(
+            " matches at least one of the ")(patterns.size())(
+            " target elements for this subchain")
+            .Flush();
         const auto pFilter = filters.LoadFilter(filter_type_, blockHash);
 
-        if (false == bool(pFilter)) { break; }
-
-        atLeastOnce = true;
-        highestTested.first = i;
-        highestTested.second = blockHash;
-        const auto& filter = *pFilter;
-        auto patterns = get_targets(elements, utxos);
-        auto matches = filter.Match(patterns);
-        const auto size{matches.size()};
-
-        if (0 < matches.size()) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": GCS for block ")(
-                blockHash->asHex())(" at height ")(i)(
-                " matches at least one of the ")(patterns.size())(
-                " target elements for this subchain")
-                .Flush();
-            const auto retest = db_.GetUntestedPatterns(
-                node_.ID(), subchain_, filter_type_, blockHash->Bytes());
-            patterns = get_targets(retest, utxos);
-            matches = filter.Match(patterns);
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(matches.size())(" of ")(
-                size)(" matches are new")
-                .Flush();
+        // NOTE this block and everything after it will be scanned again
+        if (false == bool(pFilter)) {
+            scanned = height - 1;
 
-            if (0 < matches.size()) {
-                blocks_to_request_.emplace_back(std::move(blockHash));
-            }
+            break;
+        }
+
+        const auto retest = db_.GetUntestedPatterns(
+            node_.ID(), subchain_, filter_type_, blockHash->Bytes());
+
+        if (pFilter->MatchAny(get_targets(retest, utxos))) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": at least one match is new")
+                .Flush();
+            blocks_to_request_.emplace_back(blockHash);
         }
     }
 
-    if (atLeastOnce) {
-        LogVerbose(OT_METHOD)(__FUNCTION__)(": Found ")(
-            blocks_to_request_.size())(" potential matches between blocks ")(
-            startHeight)(" and ")(highestTested.first)(" in ")(
-            std::chrono::duration_cast<std::chrono::milliseconds>(
-                Clock::now() - start)
-                .count())(" milliseconds")
-            .Flush();
-        last_scanned_ = std::move(highestTested);
-    } else {
+    if (scanned < startHeight) {
         LogVerbose(OT_METHOD)(__FUNCTION__)(
-            ": Missing filter for block at height ")(startHeight)
+            ": Missing filter for block at height ")(scanned + 1)
             .Flush();
+
+        return;
     }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Found ")(blocks_to_request_.size())(
+        " potential matches between blocks ")(startHeight)(" and ")(scanned)(
+        " in ")(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - start)
+            .count())(" milliseconds")
+        .Flush();
+    last_scanned_ = block::Position{scanned, headers.BestHash(scanned)};
 }
 
 auto HDStateData::update_utxos(
@@ -97,10 +97,12 @@ private:
         const internal::WalletDatabase::Patterns& keys,
         const std::vector<internal::WalletDatabase::UTXO>& unspent)
         const noexcept -> blockchain::internal::GCS::Targets;
-    auto index_element(
+    // Calculates the patterns for a contiguous range of keys starting at
+    // first. Every key must be valid.
+    auto index_elements(
         const filter::Type type,
-        const api::client::blockchain::BalanceNode::Element& input,
-        const Bip32Index index,
+        const Bip32Index first,
+        const std::vector<ECKey>& keys,
         WalletDatabase::ElementMap& output) noexcept -> void;
     auto update_utxos(
         const block::bitcoin::Block& block,
@@ -117,8 +117,7 @@ HeaderOracle::HeaderOracle(
     , chain_(type)
     , lock_()
 {
-    Lock lock(lock_);
-    const auto best = best_chain(lock);
+    const auto best = snapshot()->Tip();
 
     OT_ASSERT(0 <= best.first);
 }
@@ -147,7 +146,7 @@ auto HeaderOracle::AddCheckpoint(
 
     if (apply_checkpoint(lock, position, update)) {
 
-        return database_.ApplyUpdate(update);
+        return apply_update(lock, update);
     } else {
 
         return false;
@@ -184,7 +183,7 @@ auto HeaderOracle::AddHeaders(
         }
     }
 
-    return database_.ApplyUpdate(update);
+    return apply_update(lock, update);
 }
 
 auto HeaderOracle::add_header(
@@ -294,36 +293,33 @@ auto HeaderOracle::apply_checkpoint(
     }
 }
 
-auto HeaderOracle::best_chain(const Lock& lock) const noexcept
-    -> block::Position
+auto HeaderOracle::apply_update(
+    const Lock& lock,
+    const UpdateTransaction& update) noexcept -> bool
 {
-    return database_.CurrentBest()->Position();
+    if (false == database_.ApplyUpdate(update)) { return false; }
+
+    database_.ReportUpdate(update);
+
+    return true;
 }
 
 auto HeaderOracle::BestChain() const noexcept -> block::Position
 {
-    Lock lock(lock_);
-
-    return best_chain(lock);
+    return snapshot()->Tip();
 }
 
 auto HeaderOracle::BestHash(const block::Height height) const noexcept
     -> block::pHash
 {
-    Lock lock(lock_);
-
-    try {
-        return database_.BestBlock(height);
-    } catch (...) {
-        return make_blank<block::pHash>::value(api_);
-    }
+    return snapshot()->Hash(height);
 }
 
 auto HeaderOracle::BestHashes(
     const block::Height start,
     const std::size_t limit) const noexcept -> std::vector<block::pHash>
 {
-    Lock lock(lock_);
+    const auto chain = snapshot();
     auto output = std::vector<block::pHash>{};
     const auto limitIsZero = (0 == limit);
     auto current{start};
@@ -332,17 +328,11 @@ auto HeaderOracle::BestHashes(
         static_cast<block::Height>(1)};
 
     while (limitIsZero || (current <= last)) {
-        try {
-            auto hash = database_.BestBlock(current++);
+        auto hash = chain->Hash(current++);
 
-            // TODO this check shouldn't be necessary but BestBlock doesn't
-            // throw the exception documented in its declaration.
-            if (hash->empty()) { break; }
+        if (hash->empty()) { break; }
 
-            output.emplace_back(std::move(hash));
-        } catch (...) {
-            break;
-        }
+        output.emplace_back(std::move(hash));
     }
 
     return output;
@@ -352,9 +342,9 @@ auto HeaderOracle::CalculateReorg(const block::Position tip) const
     noexcept(false) -> std::vector<block::Position>
 {
     auto output = std::vector<block::Position>{};
-    Lock lock(lock_);
+    const auto chain = snapshot();
 
-    if (is_in_best_chain(lock, tip)) { return output; }
+    if (chain->Contains(tip.first, tip.second)) { return output; }
 
     output.emplace_back(tip);
 
@@ -379,7 +369,7 @@ auto HeaderOracle::CalculateReorg(const block::Position tip) const
 
         auto parent = block::Position{height - 1, header.ParentHash()};
 
-        if (is_in_best_chain(lock, parent)) { break; }
+        if (chain->Contains(parent.first, parent.second)) { break; }
 
         output.emplace_back(std::move(parent));
     }
@@ -461,18 +451,19 @@ auto HeaderOracle::choose_candidate(
 auto HeaderOracle::CommonParent(const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
-    Lock lock(lock_);
+    const auto chain = snapshot();
     const auto& database = database_;
     std::pair<block::Position, block::Position> output{
-        {0, GenesisBlockHash(chain_)}, best_chain(lock)};
+        {0, GenesisBlockHash(chain_)}, chain->Tip()};
     auto& [parent, best] = output;
-    auto test{position};
-    auto pHeader = database.TryLoadHeader(test.second);
+    auto pHeader = database.TryLoadHeader(position.second);
 
     if (false == bool(pHeader)) { return output; }
 
+    auto test = pHeader->Position();
+
     while (0 < test.first) {
-        if (is_in_best_chain(lock, test.second)) {
+        if (chain->Contains(test.first, test.second)) {
             parent = test;
 
             return output;
@@ -557,7 +548,7 @@ auto HeaderOracle::DeleteCheckpoint() noexcept -> bool
 
     if (apply_checkpoint(lock, position, update)) {
 
-        return database_.ApplyUpdate(update);
+        return apply_update(lock, update);
     } else {
 
         return false;
@@ -668,17 +659,17 @@ auto HeaderOracle::initialize_candidate(
 
 auto HeaderOracle::IsInBestChain(const block::Hash& hash) const noexcept -> bool
 {
-    Lock lock(lock_);
+    const auto pHeader = database_.TryLoadHeader(hash);
+
+    if (false == bool(pHeader)) { return false; }
 
-    return is_in_best_chain(lock, hash);
+    return snapshot()->Contains(pHeader->Height(), hash);
 }
 
 auto HeaderOracle::IsInBestChain(const block::Position& position) const noexcept
     -> bool
 {
-    Lock lock(lock_);
-
-    return is_in_best_chain(lock, position.first, position.second);
+    return snapshot()->Contains(position.first, position.second);
 }
 
 auto HeaderOracle::is_disconnected(
@@ -701,39 +692,6 @@ auto HeaderOracle::is_disconnected(
     }
 }
 
-auto HeaderOracle::is_in_best_chain(const Lock& lock, const block::Hash& hash)
-    const noexcept -> bool
-{
-    const auto pHeader = database_.TryLoadHeader(hash);
-
-    if (false == bool(pHeader)) { return false; }
-
-    const auto& header = *pHeader;
-
-    return is_in_best_chain(lock, header.Height(), hash);
-}
-
-auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
-    const block::Position& position) const noexcept -> bool
-{
-    return is_in_best_chain(lock, position.first, position.second);
-}
-
-auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
-    const block::Height height,
-    const block::Hash& hash) const noexcept -> bool
-{
-    try {
-        return hash == database_.BestBlock(height);
-
-    } catch (...) {
-
-        return false;
-    }
-}
-
 auto HeaderOracle::LoadHeader(const block::Hash& hash) const noexcept
     -> std::unique_ptr<block::Header>
 {
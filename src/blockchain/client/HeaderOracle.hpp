@@ -6,6 +6,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <deque>
 #include <iosfwd>
 #include <map>
@@ -95,6 +96,8 @@ public:
     ~HeaderOracle() final = default;
 
 private:
+    using Snapshot = std::shared_ptr<const internal::ChainSnapshot>;
+
     struct Candidate {
         bool blacklisted_{false};
         std::deque<block::Position> chain_{};
@@ -122,15 +125,10 @@ private:
         const block::Header& current,
         const block::Header& candidate) noexcept -> bool;
 
-    auto best_chain(const Lock& lock) const noexcept -> block::Position;
-    auto is_in_best_chain(const Lock& lock, const block::Hash& hash)
-        const noexcept -> bool;
-    auto is_in_best_chain(const Lock& lock, const block::Position& position)
-        const noexcept -> bool;
-    auto is_in_best_chain(
-        const Lock& lock,
-        const block::Height height,
-        const block::Hash& hash) const noexcept -> bool;
+    auto snapshot() const noexcept -> Snapshot
+    {
+        return database_.BestChainSnapshot();
+    }
 
     auto add_header(
         const Lock& lock,
@@ -140,6 +138,11 @@ private:
         const Lock& lock,
         const block::Height height,
         UpdateTransaction& update) noexcept -> bool;
+    // Commits the update to the database, which publishes a new snapshot,
+    // then announces it
+    auto apply_update(
+        const Lock& lock,
+        const UpdateTransaction& update) noexcept -> bool;
     auto choose_candidate(
         const block::Header& current,
         const Candidates& candidates,
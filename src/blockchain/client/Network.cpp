@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "internal/api/client/Client.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/client/Manager.hpp"
 #include "opentxs/blockchain/block/Header.hpp"
@@ -25,12 +26,15 @@
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/Pipeline.hpp"
+#include "util/Parallel.hpp"
 #include "util/ScopeGuard.hpp"
 
 #define OT_METHOD "opentxs::blockchain::client::implementation::Network::"
 
 namespace opentxs::blockchain::client::implementation
 {
+constexpr std::size_t header_batch_{100};
+
 Network::Network(
     const api::client::Manager& api,
     const api::client::internal::Blockchain& blockchain,
@@ -62,6 +66,7 @@ Network::Network(
           shutdown_sender_.endpoint_))
     , filter_p_(factory::BlockchainFilterOracle(
           api,
+          blockchain,
           *this,
           *header_p_,
           *database_p_,
@@ -106,6 +111,51 @@ auto Network::AddPeer(const p2p::Address& address) const noexcept -> bool
     return peer_.AddPeer(address);
 }
 
+auto Network::check_header(const ReadView payload) const noexcept
+    -> std::unique_ptr<block::Header>
+{
+    auto output = instantiate_header(payload);
+
+    if (false == bool(output)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid header").Flush();
+
+        return {};
+    }
+
+    if (false == output->Valid()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Header ")(output->Hash().asHex())(
+            " does not satisfy its proof of work target")
+            .Flush();
+
+        return {};
+    }
+
+    return output;
+}
+
+auto Network::check_headers(std::vector<ReadView>&& input) noexcept -> Headers
+{
+    auto output = Headers(input.size());
+    parallel_batch(
+        input.size(),
+        [&](const std::size_t first, const std::size_t last) {
+            for (auto i{first}; i < last; ++i) {
+                output.at(i) = check_header(input.at(i));
+            }
+        },
+        header_batch_);
+
+    // Headers following an invalid header are discarded since they can not be
+    // connected to the chain
+    const auto invalid =
+        std::find_if(output.begin(), output.end(), [](const auto& header) {
+            return false == bool(header);
+        });
+    output.erase(invalid, output.end());
+
+    return output;
+}
+
 auto Network::Connect() noexcept -> bool
 {
     if (false == running_.get()) { return false; }
@@ -257,11 +307,7 @@ auto Network::process_header(network::zeromq::Message& in) noexcept -> void
     OT_ASSERT(pPromise);
 
     auto& promise = *pPromise;
-    auto headers = std::vector<std::unique_ptr<block::Header>>{};
-
-    for (const auto& header : input) {
-        headers.emplace_back(instantiate_header(header));
-    }
+    auto headers = check_headers(std::move(input));
 
     if (false == headers.empty()) { header_.AddHeaders(headers); }
 
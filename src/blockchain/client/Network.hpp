@@ -6,10 +6,12 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <future>
 #include <iosfwd>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "core/Executor.hpp"
 #include "core/Shutdown.hpp"
@@ -194,6 +196,8 @@ protected:
 private:
     friend Executor<Network>;
 
+    using Headers = std::vector<std::unique_ptr<block::Header>>;
+
     const api::client::internal::Blockchain& parent_;
     mutable std::atomic<block::Height> local_chain_height_;
     mutable std::atomic<block::Height> remote_chain_height_;
@@ -204,8 +208,13 @@ private:
 
     virtual auto instantiate_header(const ReadView payload) const noexcept
         -> std::unique_ptr<block::Header> = 0;
+    // Instantiates a received header and verifies its proof of work before
+    // it is passed to the header oracle
+    auto check_header(const ReadView payload) const noexcept
+        -> std::unique_ptr<block::Header>;
 
     auto pipeline(zmq::Message& in) noexcept -> void;
+    auto check_headers(std::vector<ReadView>&& input) noexcept -> Headers;
     auto process_block(zmq::Message& in) noexcept -> void;
     auto process_cfheader(zmq::Message& in) noexcept -> void;
     auto process_filter(zmq::Message& in) noexcept -> void;
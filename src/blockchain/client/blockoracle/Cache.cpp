@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/client/Client.hpp"
@@ -51,7 +52,11 @@ auto BlockOracle::Cache::download(const block::Hash& block) const noexcept
 auto BlockOracle::Cache::ReceiveBlock(const zmq::Frame& in) const noexcept
     -> void
 {
-    auto pBlock = factory::BitcoinBlock(network_.API(), chain_, in.Bytes());
+    // Shares the received payload rather than copying it
+    auto frame = std::make_shared<OTZMQFrame>(in);
+    const auto bytes = frame->get().Bytes();
+    auto pBlock =
+        factory::BitcoinBlock(network_.API(), chain_, std::move(frame), bytes);
 
     if (false == bool(pBlock)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid block").Flush();
@@ -113,7 +113,7 @@ public:
         const block::bitcoin::Transaction& transaction,
         const VersionNumber version) const noexcept -> bool final
     {
-        return wallet_.AddConfirmedTransaction(
+        const auto output = wallet_.AddConfirmedTransaction(
             chain,
             balanceNode,
             subchain,
@@ -122,6 +122,11 @@ public:
             block,
             outputIndices,
             transaction);
+
+        // NOTE blocks containing wallet transactions are exempt from pruning
+        if (output) { common_.BlockPin(block.second); }
+
+        return output;
     }
     auto AddOrUpdate(Address address) const noexcept -> bool final
     {
@@ -138,6 +143,11 @@ public:
     {
         return headers_.BestBlock(position);
     }
+    auto BestChainSnapshot() const noexcept
+        -> std::shared_ptr<const client::internal::ChainSnapshot> final
+    {
+        return headers_.BestChainSnapshot();
+    }
     auto BlockExists(const block::Hash& block) const noexcept -> bool final
     {
         return common_.BlockExists(block);
@@ -247,6 +257,13 @@ public:
     {
         return filters_.LoadFilter(type, block);
     }
+    auto LoadFilters(
+        const filter::Type type,
+        const std::vector<ReadView>& blocks) const noexcept
+        -> std::vector<std::unique_ptr<const blockchain::internal::GCS>> final
+    {
+        return filters_.LoadFilters(type, blocks);
+    }
     auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash final
     {
@@ -280,6 +297,11 @@ public:
     {
         return wallet_.ReorgTo(balanceNode, subchain, type, reorg);
     }
+    auto ReportUpdate(const client::UpdateTransaction& update) const noexcept
+        -> void final
+    {
+        headers_.ReportUpdate(update);
+    }
     auto SetFilterHeaderTip(
         const filter::Type type,
         const block::Position position) const noexcept -> bool final
@@ -89,6 +89,13 @@ public:
     {
         return common_.LoadFilter(type, block);
     }
+    auto LoadFilters(
+        const filter::Type type,
+        const std::vector<ReadView>& blocks) const noexcept
+        -> std::vector<std::unique_ptr<const blockchain::internal::GCS>>
+    {
+        return common_.LoadFilters(type, blocks);
+    }
     auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash;
     auto LoadFilterHeader(const filter::Type type, const ReadView block)
@@ -47,6 +47,85 @@ auto tsv(const Input& in) noexcept -> ReadView
     return {reinterpret_cast<const char*>(&in), sizeof(in)};
 }
 
+const std::size_t Headers::header_cache_limit_{4096};
+
+Headers::HeaderCache::HeaderCache(const std::size_t limit) noexcept
+    : limit_(limit)
+    , lock_()
+    , entries_()
+    , index_()
+    , version_(0)
+{
+}
+
+auto Headers::HeaderCache::Add(const block::Header& header) noexcept -> void
+{
+    auto copy = header.clone();
+
+    OT_ASSERT(copy);
+
+    Lock lock(lock_);
+    ++version_;
+    add(lock, std::move(copy));
+}
+
+auto Headers::HeaderCache::add(
+    const Lock&,
+    std::unique_ptr<block::Header> header) noexcept -> void
+{
+    const auto& hash = header->Hash();
+
+    if (auto it = index_.find(hash); index_.end() != it) {
+        it->second->second = std::move(header);
+        entries_.splice(entries_.begin(), entries_, it->second);
+
+        return;
+    }
+
+    entries_.emplace_front(hash, std::move(header));
+    index_.emplace(hash, entries_.begin());
+
+    while (entries_.size() > limit_) {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+}
+
+auto Headers::HeaderCache::Fill(
+    const block::Header& header,
+    const std::size_t version) noexcept -> void
+{
+    auto copy = header.clone();
+
+    OT_ASSERT(copy);
+
+    Lock lock(lock_);
+
+    if (version != version_) { return; }
+
+    add(lock, std::move(copy));
+}
+
+auto Headers::HeaderCache::Find(const block::Hash& hash) noexcept
+    -> std::unique_ptr<block::Header>
+{
+    Lock lock(lock_);
+    auto it = index_.find(hash);
+
+    if (index_.end() == it) { return {}; }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+
+    return it->second->second->clone();
+}
+
+auto Headers::HeaderCache::Version() noexcept -> std::size_t
+{
+    Lock lock(lock_);
+
+    return version_;
+}
+
 Headers::Headers(
     const api::client::Manager& api,
     const client::internal::Network& network,
@@ -58,6 +137,8 @@ Headers::Headers(
     , common_(common)
     , lmdb_(lmdb)
     , lock_()
+    , snapshot_(load_snapshot())
+    , header_cache_(header_cache_limit_)
 {
     import_genesis(type);
     const auto best = this->best();
@@ -82,7 +163,7 @@ auto Headers::ApplyUpdate(const client::UpdateTransaction& update) noexcept
     }
 
     Lock lock(lock_);
-    const auto initialHeight = best(lock).first;
+    const auto initialHeight = best().first;
     auto parentTxn = lmdb_.TransactionRW();
 
     if (update.HaveCheckpoint()) {
@@ -215,22 +296,28 @@ auto Headers::ApplyUpdate(const client::UpdateTransaction& update) noexcept
         }
     }
 
-    parentTxn.Finalize(true);
-
-    if (update.HaveReorg()) {
-        const auto [height, hash] = update.ReorgParent();
-        const auto bytes = hash->Bytes();
-        LogNormal("Blockchain reorg detected. Last common ancestor is ")(
-            hash->asHex())(" at height ")(height)
+    if (false == parentTxn.Finalize(true)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to commit transaction")
             .Flush();
-        auto work = MakeWork(api_, OTZMQWorkType{OT_ZMQ_REORG_SIGNAL});
-        work->AddFrame(network_.Chain());
-        work->AddFrame(bytes.data(), bytes.size());
-        work->AddFrame(height);
-        network_.Reorg().Send(work);
+
+        return false;
     }
 
-    network_.UpdateLocalHeight(best(lock));
+    for (const auto& [hash, pair] : update.UpdatedHeaders()) {
+        const auto& [header, newBlock] = pair;
+        header_cache_.Add(*header);
+    }
+
+    auto next = std::make_shared<client::internal::ChainSnapshot>(
+        *BestChainSnapshot());
+
+    if (update.HaveReorg()) { next->Truncate(update.ReorgParent().first); }
+
+    for (const auto& [height, hash] : update.BestChain()) {
+        next->Set(height, hash);
+    }
+
+    std::atomic_store(&snapshot_, Snapshot{std::move(next)});
 
     return true;
 }
@@ -238,14 +325,7 @@ auto Headers::ApplyUpdate(const client::UpdateTransaction& update) noexcept
 auto Headers::BestBlock(const block::Height position) const noexcept(false)
     -> block::pHash
 {
-    auto output = Data::Factory();
-
-    if (0 > position) { return output; }
-
-    lmdb_.Load(
-        BlockHeaderBest,
-        tsv(static_cast<std::size_t>(position)),
-        [&](const auto in) -> void { output->Assign(in.data(), in.size()); });
+    auto output = BestChainSnapshot()->Hash(position);
 
     if (output->empty()) {
         // TODO some callers which should be catching this exception aren't.
@@ -258,39 +338,7 @@ auto Headers::BestBlock(const block::Height position) const noexcept(false)
 
 auto Headers::best() const noexcept -> block::Position
 {
-    Lock lock(lock_);
-
-    return best(lock);
-}
-
-auto Headers::best(const Lock& lock) const noexcept -> block::Position
-{
-    auto output = make_blank<block::Position>::value(api_);
-    auto height = std::size_t{0};
-
-    if (false ==
-        lmdb_.Load(
-            ChainData,
-            tsv(static_cast<std::size_t>(Key::TipHeight)),
-            [&](const auto in) -> void {
-                std::memcpy(
-                    &height, in.data(), std::min(in.size(), sizeof(height)));
-            })) {
-
-        return make_blank<block::Position>::value(api_);
-    }
-
-    if (false ==
-        lmdb_.Load(BlockHeaderBest, tsv(height), [&](const auto in) -> void {
-            output.second->Assign(in.data(), in.size());
-        })) {
-
-        return make_blank<block::Position>::value(api_);
-    }
-
-    output.first = height;
-
-    return output;
+    return BestChainSnapshot()->Tip();
 }
 
 auto Headers::checkpoint(const Lock& lock) const noexcept -> block::Position
@@ -427,6 +475,12 @@ auto Headers::import_genesis(const blockchain::Type type) const noexcept -> void
         success = transaction.Finalize(true);
 
         OT_ASSERT(success);
+
+        Lock lock(lock_);
+        auto next = std::make_shared<client::internal::ChainSnapshot>(
+            *BestChainSnapshot());
+        next->Set(0, hash);
+        std::atomic_store(&snapshot_, Snapshot{std::move(next)});
     }
 }
 
@@ -440,6 +494,9 @@ auto Headers::IsSibling(const block::Hash& hash) const noexcept -> bool
 auto Headers::load_header(const block::Hash& hash) const
     -> std::unique_ptr<block::Header>
 {
+    if (auto cached = header_cache_.Find(hash); cached) { return cached; }
+
+    const auto version = header_cache_.Version();
     auto proto = common_.LoadBlockHeader(hash);
     const auto haveMeta =
         lmdb_.Load(BlockHeaderMetadata, hash.Bytes(), [&](const auto data) {
@@ -454,6 +511,46 @@ auto Headers::load_header(const block::Hash& hash) const
 
     OT_ASSERT(output);
 
+    header_cache_.Fill(*output, version);
+
+    return output;
+}
+
+auto Headers::load_snapshot() const noexcept -> Snapshot
+{
+    auto output = std::make_shared<client::internal::ChainSnapshot>();
+
+    try {
+        const auto snapshot = lmdb_.ReadSnapshot();
+        const auto tip = snapshot.Get(
+            ChainData, tsv(static_cast<std::size_t>(Key::TipHeight)));
+
+        if (false == tip.has_value()) { return output; }
+
+        auto height = std::size_t{0};
+        std::memcpy(
+            &height, tip->data(), std::min(tip->size(), sizeof(height)));
+
+        for (auto i = std::size_t{0}; i <= height; ++i) {
+            const auto hash = snapshot.Get(BlockHeaderBest, tsv(i));
+
+            if ((false == hash.has_value()) ||
+                (client::internal::ChainSnapshot::hash_size_ != hash->size())) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Invalid best hash at height ")(i)
+                    .Flush();
+
+                break;
+            }
+
+            output->Set(
+                static_cast<block::Height>(i),
+                Data::Factory(hash->data(), hash->size()));
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+    }
+
     return output;
 }
 
@@ -489,25 +586,35 @@ auto Headers::push_best(
 
 auto Headers::RecentHashes() const noexcept -> std::vector<block::pHash>
 {
-    Lock lock(lock_);
+    const auto chain = BestChainSnapshot();
+    auto output = std::vector<block::pHash>{};
+
+    for (auto height = chain->Tip().first;
+         (0 <= height) && (100u > output.size());
+         --height) {
+        output.emplace_back(chain->Hash(height));
+    }
 
-    return recent_hashes(lock);
+    return output;
 }
 
-auto Headers::recent_hashes(const Lock& lock) const noexcept
-    -> std::vector<block::pHash>
+auto Headers::ReportUpdate(const client::UpdateTransaction& update) const
+    noexcept -> void
 {
-    auto output = std::vector<block::pHash>{};
-    lmdb_.Read(
-        BlockHeaderBest,
-        [&](const auto, const auto value) -> bool {
-            output.emplace_back(Data::Factory(value.data(), value.size()));
-
-            return 100 > output.size();
-        },
-        opentxs::storage::lmdb::LMDB::Dir::Backward);
+    if (update.HaveReorg()) {
+        const auto [height, hash] = update.ReorgParent();
+        const auto bytes = hash->Bytes();
+        LogNormal("Blockchain reorg detected. Last common ancestor is ")(
+            hash->asHex())(" at height ")(height)
+            .Flush();
+        auto work = MakeWork(api_, OTZMQWorkType{OT_ZMQ_REORG_SIGNAL});
+        work->AddFrame(network_.Chain());
+        work->AddFrame(bytes.data(), bytes.size());
+        work->AddFrame(height);
+        network_.Reorg().Send(work);
+    }
 
-    return output;
+    network_.UpdateLocalHeight(best());
 }
 
 auto Headers::SiblingHashes() const noexcept -> client::Hashes
@@ -7,8 +7,10 @@
 
 #include <boost/container/flat_set.hpp>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -63,9 +65,14 @@ namespace opentxs::blockchain::database
 struct Headers {
 public:
     using Common = api::client::blockchain::database::implementation::Database;
+    using Snapshot = std::shared_ptr<const client::internal::ChainSnapshot>;
 
     auto BestBlock(const block::Height position) const noexcept(false)
         -> block::pHash;
+    auto BestChainSnapshot() const noexcept -> Snapshot
+    {
+        return std::atomic_load(&snapshot_);
+    }
     auto CurrentBest() const noexcept -> std::unique_ptr<block::Header>
     {
         return load_header(best().second);
@@ -85,6 +92,8 @@ public:
         return load_header(hash);
     }
     auto RecentHashes() const noexcept -> std::vector<block::pHash>;
+    auto ReportUpdate(const client::UpdateTransaction& update) const noexcept
+        -> void;
     auto SiblingHashes() const noexcept -> client::Hashes;
     // Returns null pointer if the header does not exist
     auto TryLoadHeader(const block::Hash& hash) const noexcept
@@ -100,26 +109,65 @@ public:
         const blockchain::Type type) noexcept;
 
 private:
+    // Least recently used cache of deserialized headers
+    //
+    // Headers read from the database without holding lock_ may be older than
+    // a concurrent update, so they are only cached if no update has been
+    // added since the read started.
+    struct HeaderCache {
+        // Adds a header written by an update
+        auto Add(const block::Header& header) noexcept -> void;
+        // Adds a header loaded from the database unless an update has been
+        // added since version was obtained
+        auto Fill(const block::Header& header, const std::size_t version)
+            noexcept -> void;
+        // Returns a copy of the cached header or a null pointer
+        auto Find(const block::Hash& hash) noexcept
+            -> std::unique_ptr<block::Header>;
+        auto Version() noexcept -> std::size_t;
+
+        HeaderCache(const std::size_t limit) noexcept;
+
+    private:
+        using Entry = std::pair<block::pHash, std::unique_ptr<block::Header>>;
+        using Entries = std::list<Entry>;
+        using Index = std::map<block::pHash, Entries::iterator>;
+
+        const std::size_t limit_;
+        std::mutex lock_;
+        Entries entries_;
+        Index index_;
+        std::size_t version_;
+
+        auto add(const Lock& lock, std::unique_ptr<block::Header> header)
+            noexcept -> void;
+    };
+
+    static const std::size_t header_cache_limit_;
+
     const api::client::Manager& api_;
     const client::internal::Network& network_;
     const Common& common_;
     const opentxs::storage::lmdb::LMDB& lmdb_;
     mutable std::mutex lock_;
+    // Best chain hashes kept in sync with BlockHeaderBest. Only read or
+    // written with std::atomic_load and std::atomic_store, and only replaced
+    // while holding lock_.
+    mutable Snapshot snapshot_;
+    mutable HeaderCache header_cache_;
 
     auto best() const noexcept -> block::Position;
-    auto best(const Lock& lock) const noexcept -> block::Position;
     auto checkpoint(const Lock& lock) const noexcept -> block::Position;
     auto header_exists(const Lock& lock, const block::Hash& hash) const noexcept
         -> bool;
     // Throws std::out_of_range if the header does not exist
     auto load_header(const block::Hash& hash) const noexcept(false)
         -> std::unique_ptr<block::Header>;
+    auto load_snapshot() const noexcept -> Snapshot;
     auto pop_best(const std::size_t i, MDB_txn* parent) const noexcept -> bool;
     auto push_best(
         const block::Position next,
         const bool setTip,
         MDB_txn* parent) const noexcept -> bool;
-    auto recent_hashes(const Lock& lock) const noexcept
-        -> std::vector<block::pHash>;
 };
 }  // namespace opentxs::blockchain::database
@@ -570,7 +570,7 @@ auto Peer::send(OTData in) noexcept -> SendStatus
     if (running_.get()) {
         auto [future, promise] = send_promises_.NewPromise();
         auto message = MakeWork(Task::SendMessage);
-        message->AddFrame(in);
+        message->AddFrame(std::move(in));
         message->AddFrame(Data::Factory(&promise, sizeof(promise)));
         pipeline_->Push(message);
 
@@ -590,7 +590,7 @@ auto OTCron::computeTimeout() -> std::chrono::milliseconds
 
 // Make sure to call this regularly so the CronItems get a chance to process and
 // expire.
-void OTCron::ProcessCronItems()
+void OTCron::ProcessCronItems(const ItemLock& lock)
 {
     auto reason = api_.Factory().PasswordPrompt(__FUNCTION__);
     if (!m_bIsActivated) {
@@ -643,6 +643,8 @@ void OTCron::ProcessCronItems()
         }
         auto pItem = it->second;
         OT_ASSERT(false != bool(pItem));
+        const auto itemLock =
+            (lock) ? lock(*pItem) : std::shared_ptr<const void>{};
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Processing item number: ")(
             pItem->GetTransactionNum())
             .Flush();
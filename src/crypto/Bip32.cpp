@@ -7,12 +7,14 @@
 #include "1_Internal.hpp"    // IWYU pragma: associated
 #include "crypto/Bip32.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -64,11 +66,50 @@ auto Print(const proto::HDPath& node) -> std::string
 
 namespace opentxs::crypto::implementation
 {
+const std::size_t Bip32::cache_limit_{256};
+
 Bip32::Bip32(const api::Crypto& crypto) noexcept
     : crypto_(crypto)
+    , lock_()
+    , cache_()
+    , counter_(0)
 {
 }
 
+auto Bip32::blank_key(const Path& path) noexcept -> Key
+{
+    const auto& factory = Context().Factory();
+
+    return Key{factory.Secret(0), factory.Secret(0), Data::Factory(), path, 0};
+}
+
+#if OT_CRYPTO_WITH_BIP32
+auto Bip32::cache_node(
+    const std::string& seedID,
+    Path&& path,
+    const HDNode& node,
+    const Bip32Fingerprint parent) const noexcept -> void
+{
+    auto key = CacheKey{seedID, std::move(path)};
+    Lock lock(lock_);
+
+    if (0 < cache_.count(key)) { return; }
+
+    if (cache_limit_ <= cache_.size()) {
+        const auto oldest = std::min_element(
+            cache_.begin(), cache_.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second.used_ < rhs.second.used_;
+            });
+        cache_.erase(oldest);
+    }
+
+    auto secret = Context().Factory().Secret(0);
+    secret->Assign(node.Parent());
+    cache_.emplace(
+        std::move(key), CachedNode{std::move(secret), parent, ++counter_});
+}
+#endif  // OT_CRYPTO_WITH_BIP32
+
 auto Bip32::ckd_private_hardened(
     const HDNode& node,
     const be::big_uint32_buf_t i,
@@ -102,20 +143,16 @@ auto Bip32::decode(const std::string& serialized) const noexcept -> OTData
 }
 
 #if OT_CRYPTO_WITH_BIP32
-auto Bip32::DeriveKey(
-    const EcdsaCurve& curve,
+auto Bip32::derive(
+    const std::string& seedID,
     const Secret& seed,
-    const Path& path) const -> Key
+    const Path& path,
+    HDNode& node,
+    Bip32Fingerprint& parent) const noexcept -> bool
 {
-    const auto& factory = Context().Factory();
-    auto output =
-        Key{factory.Secret(0), factory.Secret(0), Data::Factory(), path, 0};
-    auto& [privateKey, chainCode, publicKey, pathOut, parent] = output;
-    auto node = HDNode{crypto_};
-    auto& hash = node.hash_;
-    auto& data = node.data_;
+    auto start = restore(seedID, path, node, parent);
 
-    {
+    if (false == start.has_value()) {
         const auto init = root_node(
             EcdsaCurve::secp256k1,
             seed.Bytes(),
@@ -123,85 +160,137 @@ auto Bip32::DeriveKey(
             node.InitCode(),
             node.InitPublic());
 
-        if (false == init) { return output; }
+        if (false == init) { return false; }
 
-        if (false == data.valid(33 + 4)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Failed to allocate temporary data space")
-                .Flush();
+        parent = 0;
+        start = 0;
+        cache_node(seedID, {}, node, parent);
+    }
 
-            return output;
-        }
+    for (auto i{start.value()}; i < path.size(); ++i) {
+        parent = node.Fingerprint();
 
-        if (false == hash.valid(64)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Failed to allocate temporary hash space")
-                .Flush();
+        if (false == derive_child(node, path.at(i))) { return false; }
+
+        const auto depth = i + 1u;
 
-            return output;
+        if (depth < path.size()) {
+            cache_node(
+                seedID,
+                Path{path.cbegin(), std::next(path.cbegin(), depth)},
+                node,
+                parent);
         }
     }
 
-    for (const auto& child : path) {
-        parent = node.Fingerprint();
-        auto i = be::big_uint32_buf_t{child};
+    return true;
+}
 
-        if (IsHard(child)) {
-            ckd_private_hardened(node, i, data);
-        } else {
-            ckd_private_normal(node, i, data);
-        }
+auto Bip32::derive_child(HDNode& node, const Bip32Index child) const noexcept
+    -> bool
+{
+    auto& hash = node.hash_;
+    auto& data = node.data_;
 
-        auto success = crypto_.Hash().HMAC(
-            proto::HASHTYPE_SHA512,
-            node.ParentCode(),
-            reader(data),
-            [&hash](const auto) {
-                return WritableView{hash.data(), 64};
-            });
+    if (false == data.valid(33 + 4)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to allocate temporary data space")
+            .Flush();
+
+        return false;
+    }
+
+    if (false == hash.valid(64)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to allocate temporary hash space")
+            .Flush();
+
+        return false;
+    }
+
+    auto i = be::big_uint32_buf_t{child};
+
+    if (IsHard(child)) {
+        ckd_private_hardened(node, i, data);
+    } else {
+        ckd_private_normal(node, i, data);
+    }
+
+    auto success = crypto_.Hash().HMAC(
+        proto::HASHTYPE_SHA512,
+        node.ParentCode(),
+        reader(data),
+        [&hash](const auto) {
+            return WritableView{hash.data(), 64};
+        });
+
+    if (false == success) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to calculate hash")
+            .Flush();
+
+        return false;
+    }
+
+    try {
+        const auto& ecdsa = provider(EcdsaCurve::secp256k1);
+        success = ecdsa.ScalarAdd(
+            node.ParentPrivate(), {hash.as<char>(), 32}, node.ChildPrivate());
 
         if (false == success) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to calculate hash")
-                .Flush();
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid scalar").Flush();
 
-            return output;
+            return false;
         }
 
-        try {
-            const auto& ecdsa = provider(EcdsaCurve::secp256k1);
-            success = ecdsa.ScalarAdd(
-                node.ParentPrivate(),
-                {hash.as<char>(), 32},
-                node.ChildPrivate());
+        success = ecdsa.ScalarMultiplyBase(
+            reader(node.ChildPrivate()(32)), node.ChildPublic());
 
-            if (false == success) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid scalar").Flush();
+        if (false == success) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to calculate public key")
+                .Flush();
 
-                return output;
-            }
+            return false;
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
-            success = ecdsa.ScalarMultiplyBase(
-                reader(node.ChildPrivate()(32)), node.ChildPublic());
+        return false;
+    }
 
-            if (false == success) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": Failed to calculate public key")
-                    .Flush();
+    auto code = hash.as<std::byte>();
+    std::advance(code, 32);
+    std::memcpy(node.ChildCode().data(), code, 32);
+    node.Next();
 
-                return output;
-            }
-        } catch (const std::exception& e) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+    return true;
+}
 
-            return output;
-        }
+auto Bip32::DeriveKey(
+    const EcdsaCurve& curve,
+    const Secret& seed,
+    const Path& path) const -> Key
+{
+    auto output = blank_key(path);
+    auto& parent = std::get<4>(output);
+    auto node = HDNode{crypto_};
+    const auto seedID = SeedID(seed.Bytes())->str();
 
-        auto code = hash.as<std::byte>();
-        std::advance(code, 32);
-        std::memcpy(node.ChildCode().data(), code, 32);
-        node.Next();
+    if (false == derive(seedID, seed, path, node, parent)) {
+        return output;
     }
 
+    export_key(curve, node, output);
+
+    return output;
+}
+
+auto Bip32::export_key(
+    const EcdsaCurve& curve,
+    const HDNode& node,
+    Key& output) const noexcept -> bool
+{
+    auto& [privateKey, chainCode, publicKey, path, parent] = output;
     const auto privateOut = node.ParentPrivate();
     const auto chainOut = node.ParentCode();
     const auto publicOut = node.ParentPublic();
@@ -219,13 +308,14 @@ auto Bip32::DeriveKey(
         if (false == expanded) {
             LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to expand seed")
                 .Flush();
-            return output;
+
+            return false;
         }
     }
 
     chainCode->Assign(chainOut);
 
-    return output;
+    return true;
 }
 #endif  // OT_CRYPTO_WITH_BIP32
 
@@ -332,6 +422,34 @@ auto Bip32::provider(const EcdsaCurve& curve) const noexcept(false)
 }
 
 #if OT_CRYPTO_WITH_BIP32
+auto Bip32::restore(
+    const std::string& seedID,
+    const Path& path,
+    HDNode& node,
+    Bip32Fingerprint& parent) const noexcept -> std::optional<std::size_t>
+{
+    Lock lock(lock_);
+
+    for (auto depth = path.size() + 1u; depth > 0u; --depth) {
+        const auto prefix =
+            Path{path.cbegin(), std::next(path.cbegin(), depth - 1u)};
+        auto it = cache_.find(CacheKey{seedID, prefix});
+
+        if (cache_.end() == it) { continue; }
+
+        auto& [secret, fingerprint, used] = it->second;
+        const auto bytes = secret->Bytes();
+        auto out = node.InitParent()(bytes.size());
+        std::memcpy(out.data(), bytes.data(), bytes.size());
+        parent = fingerprint;
+        used = ++counter_;
+
+        return depth - 1u;
+    }
+
+    return std::nullopt;
+}
+
 auto Bip32::root_node(
     const EcdsaCurve& curve,
     const ReadView entropy,
@@ -6,7 +6,14 @@
 #pragma once
 
 #include <boost/endian/buffers.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "HDNode.hpp"
 #include "opentxs/Bytes.hpp"
@@ -79,10 +86,34 @@ public:
     Bip32(const api::Crypto& crypto) noexcept;
 
 private:
+    // Intermediate nodes are cached in secure memory so that sibling keys
+    // do not each repeat the derivation of their common ancestors
+    struct CachedNode {
+        OTSecret node_;
+        Bip32Fingerprint parent_;
+        std::uint64_t used_;
+    };
+
+    using CacheKey = std::pair<std::string, Path>;
+
+    static const std::size_t cache_limit_;
+
     const api::Crypto& crypto_;
+    mutable std::mutex lock_;
+    mutable std::map<CacheKey, CachedNode> cache_;
+    mutable std::uint64_t counter_;
 
+    static auto blank_key(const Path& path) noexcept -> Key;
     static auto IsHard(const Bip32Index) noexcept -> bool;
 
+#if OT_CRYPTO_WITH_BIP32
+    auto cache_node(
+        const std::string& seedID,
+        Path&& path,
+        const HDNode& node,
+        const Bip32Fingerprint parent) const noexcept -> void;
+#endif  // OT_CRYPTO_WITH_BIP32
+
     auto ckd_private_hardened(
         const HDNode& node,
         const be::big_uint32_buf_t i,
@@ -92,6 +123,20 @@ private:
         const be::big_uint32_buf_t i,
         const WritableView& data) const noexcept -> void;
     auto decode(const std::string& serialized) const noexcept -> OTData;
+#if OT_CRYPTO_WITH_BIP32
+    // Leaves node set to the key at the end of path and parent set to the
+    // fingerprint of its parent. Only the intermediate nodes are cached.
+    auto derive(
+        const std::string& seedID,
+        const Secret& seed,
+        const Path& path,
+        HDNode& node,
+        Bip32Fingerprint& parent) const noexcept -> bool;
+    auto derive_child(HDNode& node, const Bip32Index child) const noexcept
+        -> bool;
+    auto export_key(const EcdsaCurve& curve, const HDNode& node, Key& output)
+        const noexcept -> bool;
+#endif  // OT_CRYPTO_WITH_BIP32
     auto extract(
         const Data& input,
         Bip32Network& network,
@@ -102,6 +147,12 @@ private:
     auto provider(const EcdsaCurve& curve) const noexcept(false)
         -> const crypto::EcdsaProvider&;
 #if OT_CRYPTO_WITH_BIP32
+    // Returns the length of the longest cached prefix of path
+    auto restore(
+        const std::string& seedID,
+        const Path& path,
+        HDNode& node,
+        Bip32Fingerprint& parent) const noexcept -> std::optional<std::size_t>;
     auto root_node(
         const EcdsaCurve& curve,
         const ReadView entropy,
@@ -84,6 +84,13 @@ auto HDNode::InitCode() noexcept -> AllocateOutput
     return [start](const auto) { return WritableView{start, 32}; };
 }
 
+auto HDNode::InitParent() noexcept -> AllocateOutput
+{
+    auto start = parent().data();
+
+    return [start](const auto) { return WritableView{start, 32 + 32 + 33}; };
+}
+
 auto HDNode::InitPrivate() noexcept -> AllocateOutput
 {
     auto start = parent().data();
@@ -111,6 +118,11 @@ auto HDNode::parent() noexcept -> Secret&
     return (0 == (switch_ % 2)) ? a_ : b_;
 }
 
+auto HDNode::Parent() const noexcept -> ReadView
+{
+    return parent().Bytes();
+}
+
 auto HDNode::ParentCode() const noexcept -> ReadView
 {
     auto start{parent().Bytes().data()};
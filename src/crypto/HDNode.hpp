@@ -29,6 +29,8 @@ public:
     WritableView hash_;
 
     auto Fingerprint() const noexcept -> Bip32Fingerprint;
+    // Private key, chain code and public key of the current node
+    auto Parent() const noexcept -> ReadView;
     auto ParentCode() const noexcept -> ReadView;
     auto ParentPrivate() const noexcept -> ReadView;
     auto ParentPublic() const noexcept -> ReadView;
@@ -38,6 +40,8 @@ public:
     auto ChildPublic() noexcept -> AllocateOutput;
 
     auto InitCode() noexcept -> AllocateOutput;
+    // Restore a node previously obtained from Parent()
+    auto InitParent() noexcept -> AllocateOutput;
     auto InitPrivate() noexcept -> AllocateOutput;
     auto InitPublic() noexcept -> AllocateOutput;
 
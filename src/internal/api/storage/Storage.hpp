@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "opentxs/api/storage/Storage.hpp"
 
 namespace opentxs::api::storage
@@ -14,6 +16,8 @@ class StorageInternal : virtual public Storage
 public:
     virtual void InitBackup() = 0;
     virtual void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) = 0;
+    // Incremented each time the storage root object is written
+    virtual auto Sequence() const noexcept -> std::uint64_t = 0;
     virtual void start() = 0;
 
     virtual ~StorageInternal() override = default;
@@ -130,6 +130,8 @@ struct GCS {
     virtual auto Encode() const noexcept -> OTData = 0;
     virtual auto Hash() const noexcept -> OTData = 0;
     virtual auto Match(const Targets&) const noexcept -> Matches = 0;
+    // Returns as soon as any target is found
+    virtual auto MatchAny(const Targets&) const noexcept -> bool = 0;
     virtual auto Serialize() const noexcept -> proto::GCS = 0;
     virtual auto Test(const Data& target) const noexcept -> bool = 0;
     virtual auto Test(const ReadView target) const noexcept -> bool = 0;
@@ -134,4 +134,26 @@ struct EncodedTransaction {
     auto txid_size() const noexcept -> std::size_t;
     auto size() const noexcept -> std::size_t;
 };
+
+/// Locates the parts of a serialized transaction without decoding it
+///
+/// For segwit transactions the txid preimage consists of the version, the
+/// body_size_ bytes starting at body_, and the lock time
+struct TransactionLayout {
+    std::size_t size_{};
+    std::size_t body_{};
+    std::size_t body_size_{};
+    bool segwit_{};
+
+    /// Throws if bytes does not begin with a complete transaction
+    OPENTXS_EXPORT static auto Scan(const ReadView bytes) noexcept(false)
+        -> TransactionLayout;
+
+    /// bytes must be the same input which was passed to Scan
+    OPENTXS_EXPORT auto Txid(
+        const api::Core& api,
+        const blockchain::Type chain,
+        const ReadView bytes,
+        const AllocateOutput destination) const noexcept -> bool;
+};
 }  // namespace opentxs::blockchain::bitcoin
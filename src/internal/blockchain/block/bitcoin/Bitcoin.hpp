@@ -157,6 +157,14 @@ auto BitcoinBlock(
     const blockchain::Type chain,
     const ReadView in) noexcept
     -> std::shared_ptr<blockchain::block::bitcoin::Block>;
+// The block references in directly and keeps backing alive until it is
+// destroyed. Transactions are only decoded when they are accessed.
+auto BitcoinBlock(
+    const api::client::Manager& api,
+    const blockchain::Type chain,
+    std::shared_ptr<const void> backing,
+    const ReadView in) noexcept
+    -> std::shared_ptr<blockchain::block::bitcoin::Block>;
 auto BitcoinBlockHeader(
     const api::client::Manager& api,
     const proto::BlockchainBlockHeader& serialized) noexcept
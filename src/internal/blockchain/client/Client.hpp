@@ -7,6 +7,8 @@
 
 #include <boost/asio.hpp>
 #include <boost/thread/thread.hpp>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <future>
 #include <iosfwd>
@@ -236,6 +238,11 @@ struct FilterDatabase {
         const block::Hash& block) const noexcept -> bool = 0;
     virtual auto LoadFilter(const filter::Type type, const ReadView block)
         const noexcept -> std::unique_ptr<const blockchain::internal::GCS> = 0;
+    // Output has one element per block. Missing filters are null.
+    virtual auto LoadFilters(
+        const filter::Type type,
+        const std::vector<ReadView>& blocks) const noexcept
+        -> std::vector<std::unique_ptr<const blockchain::internal::GCS>> = 0;
     virtual auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash = 0;
     virtual auto LoadFilterHeader(const filter::Type type, const ReadView block)
@@ -258,10 +265,26 @@ struct FilterDatabase {
 };
 
 struct FilterOracle {
+    using Positions = std::vector<block::Position>;
+    using Targets = std::vector<ReadView>;
+    // Matching blocks and the height of the last block tested
+    using FilterMatches = std::pair<Positions, block::Height>;
+
     virtual auto AddFilter(zmq::Message& work) const noexcept -> void = 0;
     virtual auto AddHeaders(zmq::Message& work) const noexcept -> void = 0;
     virtual auto CheckBlocks() const noexcept -> void = 0;
     virtual auto DefaultType() const noexcept -> filter::Type = 0;
+    /// Tests the filters for every best chain block from start to stop
+    /// inclusive against the targets in parallel. Returns the positions of
+    /// matching blocks in ascending order and the height of the last block
+    /// tested. Testing ends before the first block for which no filter is
+    /// available, so the returned height is start - 1 if the first filter is
+    /// missing. With no targets no filters are loaded and stop is returned.
+    virtual auto FindMatches(
+        const filter::Type type,
+        const block::Height start,
+        const block::Height stop,
+        const Targets& targets) const noexcept -> FilterMatches = 0;
     virtual auto LoadFilter(const filter::Type type, const block::Hash& block)
         const noexcept -> std::unique_ptr<const blockchain::internal::GCS> = 0;
 
@@ -287,12 +310,55 @@ struct HeaderOracle : virtual public opentxs::blockchain::client::HeaderOracle {
     virtual ~HeaderOracle() = default;
 };
 
+// Best chain hashes indexed by height
+//
+// Published snapshots are never modified. Writers copy the current snapshot,
+// which only copies pointers to the fixed size chunks holding the hashes, then
+// modify the copy before publishing it. Chunks are copied the first time a
+// copy writes to them.
+class ChainSnapshot
+{
+public:
+    static const std::size_t hash_size_;
+
+    auto Contains(const block::Height height, const block::Hash& hash)
+        const noexcept -> bool;
+    auto Hash(const block::Height height) const noexcept -> block::pHash;
+    auto Tip() const noexcept -> block::Position;
+
+    auto Set(const block::Height height, const block::Hash& hash) noexcept
+        -> void;
+    // Removes every hash above the specified height
+    auto Truncate(const block::Height height) noexcept -> void;
+
+    ChainSnapshot() noexcept;
+    ChainSnapshot(const ChainSnapshot& rhs) noexcept;
+
+private:
+    using Entry = std::array<std::byte, 32>;
+    using Chunk = std::vector<Entry>;
+
+    static const std::size_t chunk_size_;
+
+    std::vector<std::shared_ptr<Chunk>> chunks_;
+    std::vector<bool> owned_;
+    std::size_t size_;
+
+    ChainSnapshot(ChainSnapshot&&) = delete;
+    auto operator=(const ChainSnapshot&) -> ChainSnapshot& = delete;
+    auto operator=(ChainSnapshot &&) -> ChainSnapshot& = delete;
+};
+
 struct HeaderDatabase {
     virtual auto ApplyUpdate(
         const client::UpdateTransaction& update) const noexcept -> bool = 0;
     // Throws std::out_of_range if no block at that position
     virtual auto BestBlock(const block::Height position) const noexcept(false)
         -> block::pHash = 0;
+    // Returns the best chain as of the last successful ApplyUpdate. The
+    // snapshot never changes, so callers can read it without locking.
+    virtual auto BestChainSnapshot() const noexcept
+        -> std::shared_ptr<const ChainSnapshot> = 0;
     virtual auto CurrentBest() const noexcept
         -> std::unique_ptr<block::Header> = 0;
     virtual auto CurrentCheckpoint() const noexcept -> block::Position = 0;
@@ -307,6 +373,9 @@ struct HeaderDatabase {
     virtual auto LoadHeader(const block::Hash& hash) const noexcept(false)
         -> std::unique_ptr<block::Header> = 0;
     virtual auto RecentHashes() const noexcept -> std::vector<block::pHash> = 0;
+    // Announces an update previously applied by ApplyUpdate
+    virtual auto ReportUpdate(
+        const client::UpdateTransaction& update) const noexcept -> void = 0;
     virtual auto SiblingHashes() const noexcept -> Hashes = 0;
     // Returns null pointer if the header does not exist
     virtual auto TryLoadHeader(const block::Hash& hash) const noexcept
@@ -616,6 +685,7 @@ auto BlockchainDatabase(
     -> std::unique_ptr<blockchain::internal::Database>;
 auto BlockchainFilterOracle(
     const api::client::Manager& api,
+    const api::client::internal::Blockchain& blockchain,
     const blockchain::client::internal::Network& network,
     const blockchain::client::internal::HeaderOracle& header,
     const blockchain::client::internal::FilterDatabase& database,
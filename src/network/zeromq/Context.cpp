@@ -13,6 +13,7 @@
 
 #include "2_Factory.hpp"
 #include "PairEventListener.hpp"
+#include "network/zeromq/Reactor.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/core/Log.hpp"
@@ -126,6 +127,10 @@ Context::Context() noexcept
     auto init = ::zmq_ctx_set(context_, ZMQ_MAX_SOCKETS, 16384);
 
     OT_ASSERT(0 == init);
+
+    reactor_ = std::make_unique<Reactor>(context_, Reactor::DefaultThreads());
+
+    OT_ASSERT(reactor_);
 }
 
 Context::operator void*() const noexcept
@@ -216,10 +221,11 @@ auto Context::PairSocket(
 
 auto Context::Pipeline(
     const api::internal::Core& api,
-    std::function<void(zeromq::Message&)> callback) const noexcept
-    -> OTZMQPipeline
+    std::function<void(zeromq::Message&)> callback,
+    const socket::Socket::Threading threading) const noexcept -> OTZMQPipeline
 {
-    return OTZMQPipeline{opentxs::Factory::Pipeline(api, *this, callback)};
+    return OTZMQPipeline{opentxs::Factory::Pipeline(
+        api, *this, callback, static_cast<bool>(threading))};
 }
 
 auto Context::Proxy(
@@ -243,10 +249,11 @@ auto Context::PullSocket(
 
 auto Context::PullSocket(
     const ListenCallback& callback,
-    const socket::Socket::Direction direction) const noexcept -> OTZMQPullSocket
+    const socket::Socket::Direction direction,
+    const socket::Socket::Threading threading) const noexcept -> OTZMQPullSocket
 {
-    return OTZMQPullSocket{
-        Factory::PullSocket(*this, static_cast<bool>(direction), callback)};
+    return OTZMQPullSocket{Factory::PullSocket(
+        *this, static_cast<bool>(direction), callback, reactor(threading))};
 }
 
 auto Context::PushSocket(
@@ -272,13 +279,24 @@ auto Context::ReplyMessage(const zeromq::Message& request) const noexcept
     return output;
 }
 
+auto Context::reactor(const socket::Socket::Threading threading) const noexcept
+    -> const Reactor*
+{
+    if (socket::Socket::Threading::Shared == threading) {
+        return reactor_.get();
+    }
+
+    return nullptr;
+}
+
 auto Context::ReplySocket(
     const ReplyCallback& callback,
-    const socket::Socket::Direction direction) const noexcept
+    const socket::Socket::Direction direction,
+    const socket::Socket::Threading threading) const noexcept
     -> OTZMQReplySocket
 {
-    return OTZMQReplySocket{
-        Factory::ReplySocket(*this, static_cast<bool>(direction), callback)};
+    return OTZMQReplySocket{Factory::ReplySocket(
+        *this, static_cast<bool>(direction), callback, reactor(threading))};
 }
 
 auto Context::RequestSocket() const noexcept -> OTZMQRequestSocket
@@ -295,14 +313,19 @@ auto Context::RouterSocket(
         Factory::RouterSocket(*this, static_cast<bool>(direction), callback)};
 }
 
-auto Context::SubscribeSocket(const ListenCallback& callback) const noexcept
+auto Context::SubscribeSocket(
+    const ListenCallback& callback,
+    const socket::Socket::Threading threading) const noexcept
     -> OTZMQSubscribeSocket
 {
-    return OTZMQSubscribeSocket{Factory::SubscribeSocket(*this, callback)};
+    return OTZMQSubscribeSocket{
+        Factory::SubscribeSocket(*this, callback, reactor(threading))};
 }
 
 Context::~Context()
 {
+    reactor_.reset();
+
     if (nullptr != context_) { zmq_ctx_shutdown(context_); }
 }
 }  // namespace opentxs::network::zeromq::implementation
@@ -10,8 +10,10 @@
 
 #include <functional>
 #include <iosfwd>
+#include <memory>
 #include <string>
 
+#include "network/zeromq/Reactor.hpp"
 #include "opentxs/Proto.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
@@ -98,7 +100,9 @@ public:
         const std::string& endpoint) const noexcept -> OTZMQPairSocket final;
     auto Pipeline(
         const api::internal::Core& api,
-        std::function<void(zeromq::Message&)> callback) const noexcept
+        std::function<void(zeromq::Message&)> callback,
+        const socket::Socket::Threading threading =
+            socket::Socket::Threading::Dedicated) const noexcept
         -> OTZMQPipeline final;
     auto Proxy(
         network::zeromq::socket::Socket& frontend,
@@ -109,7 +113,9 @@ public:
         -> OTZMQPullSocket final;
     auto PullSocket(
         const ListenCallback& callback,
-        const socket::Socket::Direction direction) const noexcept
+        const socket::Socket::Direction direction,
+        const socket::Socket::Threading threading =
+            socket::Socket::Threading::Dedicated) const noexcept
         -> OTZMQPullSocket final;
     auto PushSocket(const socket::Socket::Direction direction) const noexcept
         -> OTZMQPushSocket final;
@@ -117,14 +123,19 @@ public:
         -> OTZMQMessage final;
     auto ReplySocket(
         const ReplyCallback& callback,
-        const socket::Socket::Direction direction) const noexcept
+        const socket::Socket::Direction direction,
+        const socket::Socket::Threading threading =
+            socket::Socket::Threading::Dedicated) const noexcept
         -> OTZMQReplySocket final;
     auto RequestSocket() const noexcept -> OTZMQRequestSocket final;
     auto RouterSocket(
         const ListenCallback& callback,
         const socket::Socket::Direction direction) const noexcept
         -> OTZMQRouterSocket final;
-    auto SubscribeSocket(const ListenCallback& callback) const noexcept
+    auto SubscribeSocket(
+        const ListenCallback& callback,
+        const socket::Socket::Threading threading =
+            socket::Socket::Threading::Dedicated) const noexcept
         -> OTZMQSubscribeSocket final;
 
     ~Context();
@@ -133,8 +144,11 @@ private:
     friend opentxs::Factory;
 
     void* context_{nullptr};
+    std::unique_ptr<Reactor> reactor_{};
 
     auto clone() const noexcept -> Context* final { return new Context; }
+    auto reactor(const socket::Socket::Threading threading) const noexcept
+        -> const Reactor*;
 
     Context() noexcept;
     Context(const Context&) = delete;
@@ -8,9 +8,12 @@
 #include "network/zeromq/Frame.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <memory>
+#include <utility>
 
 #include "2_Factory.hpp"
 #include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
 
 template class opentxs::Pimpl<opentxs::network::zeromq::Frame>;
@@ -38,8 +41,44 @@ auto Factory::ZMQFrame(const ProtobufType& data) -> network::zeromq::Frame*
 
     return new ReturnType(data);
 }
+
+auto Factory::ZMQFrame(OTData&& data) -> network::zeromq::Frame*
+{
+    using ReturnType = network::zeromq::implementation::Frame;
+
+    return new ReturnType(std::move(data));
+}
+
+auto Factory::ZMQFrame(Space&& data) -> network::zeromq::Frame*
+{
+    using ReturnType = network::zeromq::implementation::Frame;
+
+    return new ReturnType(std::move(data));
+}
+
+auto Factory::ZMQFrame(std::string&& data) -> network::zeromq::Frame*
+{
+    using ReturnType = network::zeromq::implementation::Frame;
+
+    return new ReturnType(std::move(data));
+}
 }  // namespace opentxs
 
+namespace
+{
+auto view(const opentxs::OTData& in) noexcept -> opentxs::ReadView
+{
+    return in->Bytes();
+}
+
+auto view(const opentxs::Space& in) noexcept -> opentxs::ReadView
+{
+    return opentxs::reader(in);
+}
+
+auto view(const std::string& in) noexcept -> opentxs::ReadView { return in; }
+}  // namespace
+
 namespace opentxs::network::zeromq::implementation
 {
 Frame::Frame() noexcept
@@ -71,6 +110,54 @@ Frame::Frame(const void* data, const std::size_t bytes) noexcept
     std::memcpy(zmq_msg_data(&message_), data, zmq_msg_size(&message_));
 }
 
+Frame::Frame(OTData&& input) noexcept
+    : Frame()
+{
+    adopt(std::move(input));
+}
+
+Frame::Frame(Space&& input) noexcept
+    : Frame()
+{
+    adopt(std::move(input));
+}
+
+Frame::Frame(std::string&& input) noexcept
+    : Frame()
+{
+    adopt(std::move(input));
+}
+
+template <typename Owner>
+auto Frame::adopt(Owner&& input) noexcept -> void
+{
+    const auto bytes = view(input);
+
+    if (adopt_threshold_ > bytes.size()) {
+        const auto init = zmq_msg_init_size(&message_, bytes.size());
+
+        OT_ASSERT(0 == init);
+
+        std::memcpy(zmq_msg_data(&message_), bytes.data(), bytes.size());
+
+        return;
+    }
+
+    // libzmq calls release when the last message sharing the buffer closes
+    auto owner = std::make_unique<Owner>(std::move(input));
+    const auto adopted = view(*owner);
+    const auto init = zmq_msg_init_data(
+        &message_,
+        const_cast<char*>(adopted.data()),
+        adopted.size(),
+        &Frame::release<Owner>,
+        owner.get());
+
+    OT_ASSERT(0 == init);
+
+    owner.release();
+}
+
 Frame::operator std::string() const noexcept { return std::string{Bytes()}; }
 
 auto Frame::Bytes() const noexcept -> ReadView
@@ -82,7 +169,20 @@ auto Frame::Bytes() const noexcept -> ReadView
 
 auto Frame::clone() const noexcept -> Frame*
 {
-    return new Frame(zmq_msg_data(&message_), zmq_msg_size(&message_));
+    // Shares the reference counted payload instead of copying it. Frames are
+    // never modified after construction so the copies can not diverge.
+    auto* output = new Frame();
+    const auto copied = zmq_msg_copy(&output->message_, &message_);
+
+    OT_ASSERT(0 == copied);
+
+    return output;
+}
+
+template <typename Owner>
+auto Frame::release(void*, void* hint) noexcept -> void
+{
+    delete static_cast<Owner*>(hint);
 }
 
 Frame::~Frame() { zmq_msg_close(&message_); }
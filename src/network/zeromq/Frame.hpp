@@ -14,6 +14,7 @@
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 
 namespace opentxs
@@ -46,14 +47,27 @@ private:
     friend opentxs::Factory;
     friend network::zeromq::Frame;
 
+    // Payloads smaller than this are copied rather than adopted, since
+    // libzmq stores very small messages inline and allocates a separate
+    // reference counted header for every adopted buffer
+    static constexpr std::size_t adopt_threshold_{64};
+
     mutable zmq_msg_t message_;
 
+    template <typename Owner>
+    static auto release(void* data, void* hint) noexcept -> void;
+
+    template <typename Owner>
+    auto adopt(Owner&& input) noexcept -> void;
     auto clone() const noexcept -> Frame* final;
 
     Frame() noexcept;
     explicit Frame(const ProtobufType& input) noexcept;
     explicit Frame(const std::size_t bytes) noexcept;
     Frame(const void* data, const std::size_t bytes) noexcept;
+    explicit Frame(OTData&& input) noexcept;
+    explicit Frame(Space&& input) noexcept;
+    explicit Frame(std::string&& input) noexcept;
     Frame(const Frame&) = delete;
     Frame(Frame&&) = delete;
     auto operator=(Frame &&) -> Frame& = delete;
@@ -71,6 +71,8 @@ Message::Message(const Message& rhs)
     : zeromq::Message()
     , messages_()
 {
+    messages_.reserve(rhs.messages_.size());
+
     for (auto& message : rhs.messages_) { messages_.emplace_back(message); }
 }
 
@@ -95,6 +97,34 @@ auto Message::AddFrame(const ProtobufType& input) -> Frame&
     return messages_.back().get();
 }
 
+auto Message::AddFrame(const Frame& input) -> Frame&
+{
+    messages_.emplace_back(input);
+
+    return messages_.back().get();
+}
+
+auto Message::AddFrame(OTData&& input) -> Frame&
+{
+    messages_.emplace_back(Factory::ZMQFrame(std::move(input)));
+
+    return messages_.back().get();
+}
+
+auto Message::AddFrame(Space&& input) -> Frame&
+{
+    messages_.emplace_back(Factory::ZMQFrame(std::move(input)));
+
+    return messages_.back().get();
+}
+
+auto Message::AddFrame(std::string&& input) -> Frame&
+{
+    messages_.emplace_back(Factory::ZMQFrame(std::move(input)));
+
+    return messages_.back().get();
+}
+
 auto Message::at(const std::size_t index) const -> const Frame&
 {
     OT_ASSERT(messages_.size() > index);
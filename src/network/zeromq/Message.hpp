@@ -9,9 +9,12 @@
 #pragma once
 
 #include <iosfwd>
+#include <string>
 #include <vector>
 
+#include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameIterator.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
@@ -43,6 +46,10 @@ public:
     auto AddFrame() -> Frame& final;
     auto AddFrame(const ProtobufType& input) -> Frame& final;
     auto AddFrame(const void* input, const std::size_t size) -> Frame& final;
+    auto AddFrame(const Frame& input) -> Frame& final;
+    auto AddFrame(OTData&& input) -> Frame& final;
+    auto AddFrame(Space&& input) -> Frame& final;
+    auto AddFrame(std::string&& input) -> Frame& final;
     auto at(const std::size_t index) -> Frame& final;
 
     auto Body() -> FrameSection final;
@@ -0,0 +1,358 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                // IWYU pragma: associated
+#include "1_Internal.hpp"              // IWYU pragma: associated
+#include "network/zeromq/Reactor.hpp"  // IWYU pragma: associated
+
+#include <zmq.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+
+#include "network/zeromq/socket/Socket.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+#define REACTOR_RETRY_MILLISECONDS 10
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::Reactor::"
+
+namespace opentxs::network::zeromq::implementation
+{
+thread_local Reactor::Worker* Reactor::Worker::current_{nullptr};
+
+Reactor::Reactor(void* context, const std::size_t threads) noexcept
+    : workers_()
+    , lock_()
+    , assignments_()
+    , next_(0)
+{
+    const auto count = std::max(threads, std::size_t{1});
+    workers_.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        workers_.emplace_back(std::make_unique<Worker>(
+            context, socket::implementation::Socket::random_inproc_endpoint()));
+    }
+}
+
+Reactor::Worker::Worker(void* context, const std::string& endpoint) noexcept
+    : signal_lock_()
+    , signal_(::zmq_socket(context, ZMQ_PUSH))
+    , wait_(::zmq_socket(context, ZMQ_PULL))
+    , lock_()
+    , updated_()
+    , handlers_()
+    , active_()
+    , requested_(1)
+    , applied_(0)
+    , items_()
+    , polled_()
+    , running_(true)
+    , wakeups_(0)
+    , thread_()
+{
+    OT_ASSERT(nullptr != signal_);
+    OT_ASSERT(nullptr != wait_);
+
+    const auto linger = int{0};
+    auto set = ::zmq_setsockopt(signal_, ZMQ_LINGER, &linger, sizeof(linger));
+    set |= ::zmq_setsockopt(wait_, ZMQ_LINGER, &linger, sizeof(linger));
+    set |= ::zmq_bind(wait_, endpoint.c_str());
+    set |= ::zmq_connect(signal_, endpoint.c_str());
+
+    OT_ASSERT(0 == set);
+
+    thread_ = std::thread(&Worker::run, this);
+}
+
+auto Reactor::Worker::apply() noexcept -> void
+{
+    rLock lock(lock_);
+    apply(lock);
+}
+
+auto Reactor::Worker::apply(const rLock&) noexcept -> void
+{
+    if (applied_ == requested_) { return; }
+
+    items_.clear();
+    polled_.clear();
+    items_.push_back({wait_, 0, ZMQ_POLLIN, 0});
+
+    for (auto* handler : handlers_) {
+        auto* socket = handler->reactor_socket();
+
+        if (nullptr == socket) { continue; }
+
+        items_.push_back({socket, 0, ZMQ_POLLIN, 0});
+        polled_.emplace_back(handler);
+    }
+
+    applied_ = requested_;
+    updated_.notify_all();
+}
+
+auto Reactor::DefaultThreads() noexcept -> std::size_t
+{
+    return std::max(std::thread::hardware_concurrency() / 2u, 1u);
+}
+
+auto Reactor::Add(Handler& handler) const noexcept -> void
+{
+    auto* pWorker = [&] {
+        Lock lock(lock_);
+        auto& output = assignments_[&handler];
+
+        if (nullptr == output) {
+            output = workers_.at(next_++ % workers_.size()).get();
+        }
+
+        return output;
+    }();
+
+    pWorker->Add(handler);
+}
+
+auto Reactor::Worker::Add(Handler& handler) noexcept -> void
+{
+    rLock lock(lock_);
+
+    if (handlers_.emplace(&handler).second) { ++requested_; }
+
+    Wake();
+}
+
+auto Reactor::OnWorkerThread() const noexcept -> bool
+{
+    return nullptr != Worker::Current();
+}
+
+auto Reactor::OnWorkerThread(const Handler& handler) const noexcept -> bool
+{
+    Lock lock(lock_);
+    const auto it = assignments_.find(&handler);
+
+    if (assignments_.end() == it) { return false; }
+
+    return std::this_thread::get_id() == it->second->ID();
+}
+
+auto Reactor::Remove(Handler& handler) const noexcept -> void
+{
+    auto* pWorker = [&]() -> Worker* {
+        Lock lock(lock_);
+        auto it = assignments_.find(&handler);
+
+        if (assignments_.end() == it) { return nullptr; }
+
+        auto* output = it->second;
+        assignments_.erase(it);
+
+        return output;
+    }();
+
+    if (nullptr != pWorker) { pWorker->Remove(handler); }
+}
+
+auto Reactor::Worker::Remove(Handler& handler) noexcept -> void
+{
+    rLock lock(lock_);
+
+    if (0 == handlers_.erase(&handler)) { return; }
+
+    const auto target = ++requested_;
+
+    // The worker thread checks membership before calling a handler, so a
+    // handler removed from inside a callback only needs its socket removed
+    // from the poll set before the caller closes it
+    if (this == current_) {
+        apply(lock);
+
+        return;
+    }
+
+    Wake();
+    const auto done = [&] {
+        const auto busy = active_.end() !=
+                          std::find(active_.begin(), active_.end(), &handler);
+
+        return ((applied_ >= target) && (false == busy)) ||
+               (false == running_);
+    };
+
+    if (nullptr == current_) {
+        updated_.wait(lock, done);
+
+        return;
+    }
+
+    // The calling thread is another worker inside a callback. It must keep
+    // applying changes to its own poll set while it waits, otherwise two
+    // workers removing each other's handlers would never finish.
+    while (false == done()) {
+        lock.unlock();
+        current_->apply();
+        lock.lock();
+        updated_.wait_for(
+            lock, std::chrono::milliseconds(REACTOR_RETRY_MILLISECONDS), done);
+    }
+}
+
+template <typename Callback>
+auto Reactor::Worker::dispatch(Handler* handler, Callback cb) noexcept -> void
+{
+    {
+        rLock lock(lock_);
+
+        if (0 == handlers_.count(handler)) { return; }
+
+        active_.emplace_back(handler);
+    }
+
+    // Callbacks run without the lock so they may add, remove, or wake
+    // handlers on any worker
+    cb(*handler);
+    rLock lock(lock_);
+    active_.pop_back();
+    updated_.notify_all();
+}
+
+auto Reactor::Worker::run() noexcept -> void
+{
+    current_ = this;
+    auto ready = std::vector<Handler*>{};
+
+    while (running_) {
+        auto timeout = long{-1};
+        apply();
+        ready = polled_;
+
+        for (auto* handler : ready) {
+            dispatch(handler, [&](auto& item) {
+                if (false == item.reactor_tasks()) {
+                    timeout = REACTOR_RETRY_MILLISECONDS;
+                }
+            });
+        }
+
+        // The tasks above may have changed the poll set
+        apply();
+        const auto events =
+            ::zmq_poll(items_.data(), static_cast<int>(items_.size()), timeout);
+        ++wakeups_;
+
+        if (0 > events) {
+            const auto error = ::zmq_errno();
+
+            if (ETERM == error) { break; }
+
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Poll error: ")(
+                ::zmq_strerror(error))
+                .Flush();
+
+            continue;
+        }
+
+        if (0 == events) { continue; }
+
+        if (0 != (items_.front().revents & ZMQ_POLLIN)) {
+            auto message = ::zmq_msg_t{};
+            ::zmq_msg_init(&message);
+
+            while (-1 != ::zmq_msg_recv(&message, wait_, ZMQ_DONTWAIT)) {}
+
+            ::zmq_msg_close(&message);
+        }
+
+        // Callbacks may rebuild the poll set so the ready handlers are
+        // collected before any of them run
+        ready.clear();
+
+        for (auto i = std::size_t{1}; i < items_.size(); ++i) {
+            if (0 != (items_.at(i).revents & ZMQ_POLLIN)) {
+                ready.emplace_back(polled_.at(i - 1u));
+            }
+        }
+
+        for (auto* handler : ready) {
+            dispatch(handler, [](auto& item) { item.reactor_receive(); });
+        }
+    }
+
+    rLock lock(lock_);
+    running_ = false;
+    updated_.notify_all();
+}
+
+auto Reactor::RunTasks() const noexcept -> void
+{
+    auto* pWorker = Worker::Current();
+
+    if (nullptr != pWorker) { pWorker->RunTasks(); }
+}
+
+auto Reactor::Worker::RunTasks() noexcept -> void
+{
+    OT_ASSERT(this == current_);
+
+    apply();
+    // Tasks may rebuild the poll set
+    const auto handlers = polled_;
+
+    for (auto* handler : handlers) {
+        dispatch(handler, [](auto& item) { item.reactor_tasks(); });
+    }
+}
+
+auto Reactor::Sockets() const noexcept -> std::size_t
+{
+    Lock lock(lock_);
+
+    return assignments_.size();
+}
+
+auto Reactor::Wake(const Handler& handler) const noexcept -> void
+{
+    auto* pWorker = [&]() -> Worker* {
+        Lock lock(lock_);
+        auto it = assignments_.find(&handler);
+
+        return (assignments_.end() == it) ? nullptr : it->second;
+    }();
+
+    if (nullptr != pWorker) { pWorker->Wake(); }
+}
+
+auto Reactor::Worker::Wake() noexcept -> void
+{
+    // A full queue already guarantees the worker will wake up
+    Lock lock(signal_lock_);
+    ::zmq_send(signal_, nullptr, 0, ZMQ_DONTWAIT);
+}
+
+auto Reactor::Wakeups() const noexcept -> std::uint64_t
+{
+    auto output = std::uint64_t{0};
+
+    for (const auto& worker : workers_) { output += worker->Wakeups(); }
+
+    return output;
+}
+
+Reactor::Worker::~Worker()
+{
+    running_ = false;
+    Wake();
+
+    if (thread_.joinable()) { thread_.join(); }
+
+    ::zmq_close(signal_);
+    ::zmq_close(wait_);
+}
+
+Reactor::~Reactor() { workers_.clear(); }
+}  // namespace opentxs::network::zeromq::implementation
@@ -0,0 +1,136 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <zmq.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::network::zeromq::implementation
+{
+// Multiplexes the incoming messages of many receiving sockets onto a small
+// number of threads.
+//
+// Each registered socket is assigned to one worker thread for its entire
+// lifetime so that a zmq socket is never used by two reactor threads. Worker
+// threads block in zmq_poll without a timeout while idle and are woken through
+// an internal inproc socket when the set of sockets changes or a socket has
+// queued tasks.
+class Reactor
+{
+public:
+    class Handler
+    {
+    public:
+        // Run any tasks queued by other threads. Returns false if tasks remain
+        // which could not be run because the socket is busy.
+        virtual auto reactor_tasks() noexcept -> bool = 0;
+        // Called when the socket has at least one incoming message
+        virtual auto reactor_receive() noexcept -> void = 0;
+        virtual auto reactor_socket() const noexcept -> void* = 0;
+
+        virtual ~Handler() = default;
+    };
+
+    static auto DefaultThreads() noexcept -> std::size_t;
+
+    auto Add(Handler& handler) const noexcept -> void;
+    // True if called by any worker thread
+    auto OnWorkerThread() const noexcept -> bool;
+    // True if called by the worker thread assigned to the handler
+    auto OnWorkerThread(const Handler& handler) const noexcept -> bool;
+    // After Remove returns the reactor will not access the handler again. If
+    // a callback for the handler is running on another thread Remove waits
+    // for it to return.
+    auto Remove(Handler& handler) const noexcept -> void;
+    // Runs the tasks queued for the handlers of the calling worker thread. A
+    // worker which waits for a task on another worker must call this while
+    // waiting, otherwise two workers waiting for each other never finish.
+    auto RunTasks() const noexcept -> void;
+    auto Sockets() const noexcept -> std::size_t;
+    auto Threads() const noexcept -> std::size_t { return workers_.size(); }
+    auto Wake(const Handler& handler) const noexcept -> void;
+    auto Wakeups() const noexcept -> std::uint64_t;
+
+    Reactor(void* context, const std::size_t threads) noexcept;
+
+    ~Reactor();
+
+private:
+    class Worker
+    {
+    public:
+        static auto Current() noexcept -> Worker* { return current_; }
+
+        auto Add(Handler& handler) noexcept -> void;
+        auto ID() const noexcept -> std::thread::id { return thread_.get_id(); }
+        auto Remove(Handler& handler) noexcept -> void;
+        auto RunTasks() noexcept -> void;
+        auto Wake() noexcept -> void;
+        auto Wakeups() const noexcept -> std::uint64_t { return wakeups_; }
+
+        Worker(void* context, const std::string& endpoint) noexcept;
+
+        ~Worker();
+
+    private:
+        // The worker whose thread is the calling thread, if any
+        static thread_local Worker* current_;
+
+        std::mutex signal_lock_;
+        void* signal_;
+        void* wait_;
+        std::recursive_mutex lock_;
+        std::condition_variable_any updated_;
+        std::set<Handler*> handlers_;
+        // Handlers whose callbacks are running on the worker thread. Callbacks
+        // nest when a handler runs tasks for its worker while it waits.
+        std::vector<Handler*> active_;
+        std::uint64_t requested_;
+        std::uint64_t applied_;
+        // Only accessed by the worker thread
+        std::vector<::zmq_pollitem_t> items_;
+        std::vector<Handler*> polled_;
+        std::atomic<bool> running_;
+        std::atomic<std::uint64_t> wakeups_;
+        std::thread thread_;
+
+        auto apply() noexcept -> void;
+        auto apply(const rLock& lock) noexcept -> void;
+        template <typename Callback>
+        auto dispatch(Handler* handler, Callback cb) noexcept -> void;
+        auto run() noexcept -> void;
+
+        Worker() = delete;
+        Worker(const Worker&) = delete;
+        Worker(Worker&&) = delete;
+        auto operator=(const Worker&) -> Worker& = delete;
+        auto operator=(Worker &&) -> Worker& = delete;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    mutable std::mutex lock_;
+    mutable std::map<const Handler*, Worker*> assignments_;
+    mutable std::size_t next_;
+
+    Reactor() = delete;
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    auto operator=(const Reactor&) -> Reactor& = delete;
+    auto operator=(Reactor &&) -> Reactor& = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
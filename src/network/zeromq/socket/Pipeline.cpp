@@ -42,11 +42,14 @@ namespace opentxs
 auto Factory::Pipeline(
     const api::internal::Core& api,
     const network::zeromq::Context& context,
-    std::function<void(network::zeromq::Message&)> callback)
-    -> opentxs::network::zeromq::Pipeline*
+    std::function<void(network::zeromq::Message&)> callback,
+    const bool threading) -> opentxs::network::zeromq::Pipeline*
 {
     return new opentxs::network::zeromq::socket::implementation::Pipeline(
-        api, context, callback);
+        api,
+        context,
+        callback,
+        static_cast<network::zeromq::socket::Socket::Threading>(threading));
 }
 }  // namespace opentxs
 
@@ -55,10 +58,11 @@ namespace opentxs::network::zeromq::socket::implementation
 Pipeline::Pipeline(
     const api::internal::Core& api,
     const zeromq::Context& context,
-    std::function<void(zeromq::Message&)> callback) noexcept
+    std::function<void(zeromq::Message&)> callback,
+    const Socket::Threading threading) noexcept
     : sender_(context.PushSocket(Socket::Direction::Bind))
     , callback_(ListenCallback::Factory(callback))
-    , receiver_(context.SubscribeSocket(callback_))
+    , receiver_(context.SubscribeSocket(callback_, threading))
 {
     const auto endpoint = std::string("inproc://opentxs/") +
                           api.Crypto().Encode().Nonce(32)->Get();
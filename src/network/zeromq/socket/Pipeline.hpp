@@ -15,6 +15,7 @@
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/Pipeline.hpp"
 #include "opentxs/network/zeromq/socket/Push.hpp"
+#include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "opentxs/network/zeromq/socket/Subscribe.hpp"
 
 namespace opentxs
@@ -71,7 +72,8 @@ private:
     Pipeline(
         const api::internal::Core& api,
         const zeromq::Context& context,
-        std::function<void(zeromq::Message&)> callback) noexcept;
+        std::function<void(zeromq::Message&)> callback,
+        const Socket::Threading threading) noexcept;
     Pipeline() = delete;
     Pipeline(const Pipeline&) = delete;
     Pipeline(Pipeline&&) = delete;
@@ -53,7 +53,8 @@ auto Factory::PullSocket(
 auto Factory::PullSocket(
     const network::zeromq::Context& context,
     const bool direction,
-    const network::zeromq::ListenCallback& callback)
+    const network::zeromq::ListenCallback& callback,
+    const network::zeromq::implementation::Reactor* reactor)
     -> network::zeromq::socket::Pull*
 {
     using ReturnType = network::zeromq::socket::implementation::Pull;
@@ -61,7 +62,8 @@ auto Factory::PullSocket(
     return new ReturnType(
         context,
         static_cast<network::zeromq::socket::Socket::Direction>(direction),
-        callback);
+        callback,
+        reactor);
 }
 }  // namespace opentxs
 
@@ -71,8 +73,9 @@ Pull::Pull(
     const zeromq::Context& context,
     const Socket::Direction direction,
     const zeromq::ListenCallback& callback,
-    const bool startThread) noexcept
-    : Receiver(context, SocketType::Pull, direction, startThread)
+    const bool startThread,
+    const zeromq::implementation::Reactor* reactor) noexcept
+    : Receiver(context, SocketType::Pull, direction, startThread, reactor)
     , Server(this->get())
     , callback_(callback)
 {
@@ -82,21 +85,22 @@ Pull::Pull(
 Pull::Pull(
     const zeromq::Context& context,
     const Socket::Direction direction,
-    const zeromq::ListenCallback& callback) noexcept
-    : Pull(context, direction, callback, true)
+    const zeromq::ListenCallback& callback,
+    const zeromq::implementation::Reactor* reactor) noexcept
+    : Pull(context, direction, callback, true, reactor)
 {
 }
 
 Pull::Pull(
     const zeromq::Context& context,
     const Socket::Direction direction) noexcept
-    : Pull(context, direction, ListenCallback::Factory(), false)
+    : Pull(context, direction, ListenCallback::Factory(), false, nullptr)
 {
 }
 
 auto Pull::clone() const noexcept -> Pull*
 {
-    return new Pull(context_, direction_, callback_);
+    return new Pull(context_, direction_, callback_, reactor_);
 }
 
 auto Pull::have_callback() const noexcept -> bool { return true; }
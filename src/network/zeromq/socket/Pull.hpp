@@ -60,11 +60,13 @@ private:
         const zeromq::Context& context,
         const Socket::Direction direction,
         const zeromq::ListenCallback& callback,
-        const bool startThread) noexcept;
+        const bool startThread,
+        const zeromq::implementation::Reactor* reactor) noexcept;
     Pull(
         const zeromq::Context& context,
         const Socket::Direction direction,
-        const zeromq::ListenCallback& callback) noexcept;
+        const zeromq::ListenCallback& callback,
+        const zeromq::implementation::Reactor* reactor) noexcept;
     Pull(
         const zeromq::Context& context,
         const Socket::Direction direction) noexcept;
@@ -5,10 +5,12 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <thread>
 
+#include "network/zeromq/Reactor.hpp"
 #include "network/zeromq/socket/Socket.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
@@ -27,19 +29,25 @@ class Context;
 
 #define CALLBACK_WAIT_MILLISECONDS 50
 #define RECEIVER_POLL_MILLISECONDS 100
+#define RECEIVER_TASK_RETRY_MILLISECONDS 10
 
 #define RECEIVER_METHOD "opentxs::network::zeromq::implementation::Receiver::"
 
 namespace opentxs::network::zeromq::socket::implementation
 {
+// Receiving sockets either run a dedicated thread or, if constructed with a
+// reactor, are serviced by the reactor threads owned by the context
 template <typename InterfaceType, typename MessageType = zeromq::Message>
-class Receiver : virtual public InterfaceType, public Socket
+class Receiver : virtual public InterfaceType,
+                 public Socket,
+                 public zeromq::implementation::Reactor::Handler
 {
 public:
     auto apply_socket(SocketCallback&& cb) const noexcept -> bool override;
     auto Close() const noexcept -> bool final;
 
 protected:
+    const zeromq::implementation::Reactor* reactor_;
     mutable std::thread receiver_thread_{};
 
     virtual auto have_callback() const noexcept -> bool { return false; }
@@ -56,7 +64,8 @@ protected:
         const zeromq::Context& context,
         const SocketType type,
         const Socket::Direction direction,
-        const bool startThread) noexcept;
+        const bool startThread,
+        const zeromq::implementation::Reactor* reactor = nullptr) noexcept;
 
     ~Receiver() override;
 
@@ -64,12 +73,19 @@ private:
     const bool start_thread_;
     mutable int next_task_;
     mutable std::mutex task_lock_;
+    mutable std::condition_variable task_finished_;
     mutable std::map<int, SocketCallback> socket_tasks_;
     mutable std::map<int, bool> task_result_;
+    // Lock held by the reactor worker while it runs a callback for this
+    // socket. Only accessed by that worker.
+    const Lock* reactor_lock_;
 
     auto add_task(SocketCallback&& cb) const noexcept -> int;
+    auto reactor_receive() noexcept -> void final;
+    auto reactor_socket() const noexcept -> void* final { return socket_; }
+    auto reactor_tasks() noexcept -> bool final;
+    auto receive(const Lock& lock) noexcept -> void;
     auto task_result(const int id) const noexcept -> bool;
-    auto task_running(const int id) const noexcept -> bool;
 
     Receiver() = delete;
     Receiver(const Receiver&) = delete;
@@ -7,6 +7,9 @@
 #include "network/zeromq/socket/Receiver.hpp"  // IWYU pragma: associated
 
 #include <zmq.h>
+#include <chrono>
+#include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -24,14 +27,18 @@ Receiver<InterfaceType, MessageType>::Receiver(
     const zeromq::Context& context,
     const SocketType type,
     const Socket::Direction direction,
-    const bool startThread) noexcept
+    const bool startThread,
+    const zeromq::implementation::Reactor* reactor) noexcept
     : Socket(context, type, direction)
+    , reactor_(reactor)
     , receiver_thread_()
     , start_thread_(startThread)
     , next_task_(0)
     , task_lock_()
+    , task_finished_()
     , socket_tasks_()
     , task_result_()
+    , reactor_lock_(nullptr)
 {
 }
 
@@ -51,12 +58,41 @@ template <typename InterfaceType, typename MessageType>
 auto Receiver<InterfaceType, MessageType>::apply_socket(
     SocketCallback&& cb) const noexcept -> bool
 {
+    if ((nullptr != reactor_) && reactor_->OnWorkerThread(*this)) {
+        // The reactor thread which owns this socket is busy executing the
+        // caller, so it can not be using the socket
+        if (nullptr != reactor_lock_) { return cb(*reactor_lock_); }
+
+        Lock lock(lock_);
+
+        return cb(lock);
+    }
+
     const auto id = add_task(std::move(cb));
 
-    while (task_running(id)) {
-        Sleep(std::chrono::milliseconds(RECEIVER_POLL_MILLISECONDS));
+    if (nullptr != reactor_) { reactor_->Wake(*this); }
+
+    Lock lock(task_lock_);
+    const auto done = [&] { return 0 < task_result_.count(id); };
+
+    if ((nullptr != reactor_) && reactor_->OnWorkerThread()) {
+        // The worker which owns this socket may itself be waiting for a task
+        // queued on one of the caller's sockets
+        while (false == done()) {
+            lock.unlock();
+            reactor_->RunTasks();
+            lock.lock();
+            task_finished_.wait_for(
+                lock,
+                std::chrono::milliseconds(RECEIVER_TASK_RETRY_MILLISECONDS),
+                done);
+        }
+    } else {
+        task_finished_.wait(lock, done);
     }
 
+    lock.unlock();
+
     return task_result(id);
 }
 
@@ -65,6 +101,8 @@ auto Receiver<InterfaceType, MessageType>::Close() const noexcept -> bool
 {
     running_->Off();
 
+    if (nullptr != reactor_) { reactor_->Remove(const_cast<Receiver&>(*this)); }
+
     if (receiver_thread_.joinable()) { receiver_thread_.join(); }
 
     return Socket::Close();
@@ -75,28 +113,100 @@ void Receiver<InterfaceType, MessageType>::init() noexcept
 {
     Socket::init();
 
-    if (start_thread_) {
+    if (false == start_thread_) { return; }
+
+    if (nullptr == reactor_) {
         receiver_thread_ = std::thread(&Receiver::thread, this);
+    } else {
+        // Only sockets which are constructed with a callback use a reactor so
+        // there is no need to wait for have_callback()
+        reactor_->Add(*this);
     }
 }
 
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::reactor_receive() noexcept -> void
+{
+    Lock lock(lock_, std::try_to_lock);
+
+    if (false == lock.owns_lock()) { return; }
+
+    if (false == running_.get()) { return; }
+
+    reactor_lock_ = &lock;
+    receive(lock);
+    reactor_lock_ = nullptr;
+}
+
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::reactor_tasks() noexcept -> bool
+{
+    {
+        Lock task_lock(task_lock_);
+
+        if (socket_tasks_.empty()) { return true; }
+    }
+
+    // Called while a callback for this socket is waiting for another worker
+    if (nullptr != reactor_lock_) {
+        run_tasks(*reactor_lock_);
+
+        return true;
+    }
+
+    Lock lock(lock_, std::try_to_lock);
+
+    if (false == lock.owns_lock()) { return false; }
+
+    reactor_lock_ = &lock;
+    run_tasks(lock);
+    reactor_lock_ = nullptr;
+
+    return true;
+}
+
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::receive(const Lock& lock) noexcept
+    -> void
+{
+    auto message = MessageType::Factory();
+    const auto received = Socket::receive_message(lock, socket_, message);
+
+    if (false == received) {
+        std::cerr << RECEIVER_METHOD << __FUNCTION__
+                  << ": Failed to receive incoming message." << std::endl;
+
+        return;
+    }
+
+    process_incoming(lock, message);
+}
+
 template <typename InterfaceType, typename MessageType>
 void Receiver<InterfaceType, MessageType>::run_tasks(
     const Lock& lock) const noexcept
 {
-    Lock task_lock(task_lock_);
-    auto i = socket_tasks_.begin();
+    auto tasks = std::map<int, SocketCallback>{};
 
-    while (i != socket_tasks_.end()) {
-        const auto& [id, cb] = *i;
-        task_result_.emplace(id, cb(lock));
-        i = socket_tasks_.erase(i);
+    {
+        Lock task_lock(task_lock_);
+        tasks.swap(socket_tasks_);
+    }
+
+    // Tasks run without task_lock_ since they may queue tasks of their own
+    for (const auto& [id, cb] : tasks) {
+        const auto result = cb(lock);
+        Lock task_lock(task_lock_);
+        task_result_.emplace(id, result);
+        task_finished_.notify_all();
     }
 }
 
 template <typename InterfaceType, typename MessageType>
 void Receiver<InterfaceType, MessageType>::shutdown(const Lock& lock) noexcept
 {
+    if (nullptr != reactor_) { reactor_->Remove(*this); }
+
     if (receiver_thread_.joinable()) { receiver_thread_.join(); }
 
     Socket::shutdown(lock);
@@ -117,15 +227,6 @@ auto Receiver<InterfaceType, MessageType>::task_result(
     return output;
 }
 
-template <typename InterfaceType, typename MessageType>
-auto Receiver<InterfaceType, MessageType>::task_running(
-    const int id) const noexcept -> bool
-{
-    Lock lock(task_lock_);
-
-    return (1 == socket_tasks_.count(id));
-}
-
 template <typename InterfaceType, typename MessageType>
 void Receiver<InterfaceType, MessageType>::thread() noexcept
 {
@@ -159,17 +260,7 @@ void Receiver<InterfaceType, MessageType>::thread() noexcept
 
         if (false == running_.get()) { return; }
 
-        auto reply = MessageType::Factory();
-        const auto received = Socket::receive_message(lock, socket_, reply);
-
-        if (false == received) {
-            std::cerr << RECEIVER_METHOD << __FUNCTION__
-                      << ": Failed to receive incoming message." << std::endl;
-
-            continue;
-        }
-
-        process_incoming(lock, reply);
+        receive(lock);
         lock.unlock();
         std::this_thread::yield();
     }
@@ -178,6 +269,8 @@ void Receiver<InterfaceType, MessageType>::thread() noexcept
 template <typename InterfaceType, typename MessageType>
 Receiver<InterfaceType, MessageType>::~Receiver()
 {
+    if (nullptr != reactor_) { reactor_->Remove(*this); }
+
     if (receiver_thread_.joinable()) { receiver_thread_.join(); }
 }
 }  // namespace opentxs::network::zeromq::socket::implementation
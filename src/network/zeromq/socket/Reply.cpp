@@ -43,7 +43,8 @@ namespace opentxs
 auto Factory::ReplySocket(
     const network::zeromq::Context& context,
     const bool direction,
-    const network::zeromq::ReplyCallback& callback)
+    const network::zeromq::ReplyCallback& callback,
+    const network::zeromq::implementation::Reactor* reactor)
     -> network::zeromq::socket::Reply*
 {
     using ReturnType = network::zeromq::socket::implementation::Reply;
@@ -51,7 +52,8 @@ auto Factory::ReplySocket(
     return new ReturnType(
         context,
         static_cast<network::zeromq::socket::Socket::Direction>(direction),
-        callback);
+        callback,
+        reactor);
 }
 }  // namespace opentxs
 
@@ -60,8 +62,9 @@ namespace opentxs::network::zeromq::socket::implementation
 Reply::Reply(
     const zeromq::Context& context,
     const Socket::Direction direction,
-    const ReplyCallback& callback) noexcept
-    : Receiver(context, SocketType::Reply, direction, true)
+    const ReplyCallback& callback,
+    const zeromq::implementation::Reactor* reactor) noexcept
+    : Receiver(context, SocketType::Reply, direction, true, reactor)
     , Server(this->get())
     , callback_(callback)
 {
@@ -70,7 +73,7 @@ Reply::Reply(
 
 auto Reply::clone() const noexcept -> Reply*
 {
-    return new Reply(context_, direction_, callback_);
+    return new Reply(context_, direction_, callback_, reactor_);
 }
 
 auto Reply::have_callback() const noexcept -> bool { return true; }
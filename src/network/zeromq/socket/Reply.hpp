@@ -59,7 +59,8 @@ private:
     Reply(
         const zeromq::Context& context,
         const Socket::Direction direction,
-        const ReplyCallback& callback) noexcept;
+        const ReplyCallback& callback,
+        const zeromq::implementation::Reactor* reactor) noexcept;
     Reply() = delete;
     Reply(const Reply&) = delete;
     Reply(Reply&&) = delete;
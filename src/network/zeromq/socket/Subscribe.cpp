@@ -44,12 +44,13 @@ namespace opentxs
 {
 auto Factory::SubscribeSocket(
     const network::zeromq::Context& context,
-    const network::zeromq::ListenCallback& callback)
+    const network::zeromq::ListenCallback& callback,
+    const network::zeromq::implementation::Reactor* reactor)
     -> network::zeromq::socket::Subscribe*
 {
     using ReturnType = network::zeromq::socket::implementation::Subscribe;
 
-    return new ReturnType(context, callback);
+    return new ReturnType(context, callback, reactor);
 }
 }  // namespace opentxs
 
@@ -57,8 +58,14 @@ namespace opentxs::network::zeromq::socket::implementation
 {
 Subscribe::Subscribe(
     const zeromq::Context& context,
-    const zeromq::ListenCallback& callback) noexcept
-    : Receiver(context, SocketType::Subscribe, Socket::Direction::Connect, true)
+    const zeromq::ListenCallback& callback,
+    const zeromq::implementation::Reactor* reactor) noexcept
+    : Receiver(
+          context,
+          SocketType::Subscribe,
+          Socket::Direction::Connect,
+          true,
+          reactor)
     , Client(this->get())
     , callback_(callback)
 {
@@ -67,7 +74,7 @@ Subscribe::Subscribe(
 
 auto Subscribe::clone() const noexcept -> Subscribe*
 {
-    return new Subscribe(context_, callback_);
+    return new Subscribe(context_, callback_, reactor_);
 }
 
 auto Subscribe::have_callback() const noexcept -> bool { return true; }
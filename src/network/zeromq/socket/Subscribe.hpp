@@ -49,7 +49,8 @@ protected:
 
     Subscribe(
         const zeromq::Context& context,
-        const zeromq::ListenCallback& callback) noexcept;
+        const zeromq::ListenCallback& callback,
+        const zeromq::implementation::Reactor* reactor = nullptr) noexcept;
 
 private:
     friend opentxs::Factory;
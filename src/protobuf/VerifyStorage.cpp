@@ -11,6 +11,7 @@ auto BlindedSeriesListAllowedStorageItemHash() noexcept -> const VersionMap&
 {
     static const auto output = VersionMap{
         {1, {1, 2}},
+        {2, {2, 2}},
     };
 
     return output;
@@ -124,6 +125,7 @@ auto StorageNotaryAllowedBlindedSeriesList() noexcept -> const VersionMap&
 {
     static const auto output = VersionMap{
         {1, {1, 1}},
+        {2, {2, 2}},
     };
 
     return output;
@@ -272,6 +274,15 @@ auto StorageThreadAllowedItem() noexcept -> const VersionMap&
 {
     static const auto output = VersionMap{
         {1, {1, 1}},
+        {2, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageThreadAllowedStorageItemHash() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {2, {2, 2}},
     };
 
     return output;
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <set>
 #include <string>
 
 #include "opentxs/protobuf/Basic.hpp"
@@ -18,6 +19,15 @@ namespace opentxs
 {
 namespace proto
 {
+namespace
+{
+auto is_number(const std::string& value) -> bool
+{
+    return (false == value.empty()) &&
+           (std::string::npos == value.find_first_not_of("0123456789"));
+}
+}  // namespace
+
 auto CheckProto_1(
     const BlindedSeriesList& input,
     const bool silent,
@@ -32,15 +42,57 @@ auto CheckProto_1(
     CHECK_IDENTIFIER(unit);
     CHECK_SUBOBJECTS(series, BlindedSeriesListAllowedStorageItemHash());
 
+    // Each mint series is a single spent token list identified by its alias
+    auto aliases = std::set<std::string>{};
+
+    for (const auto& series : input.series()) {
+        const auto& alias = series.alias();
+
+        if (false == is_number(alias)) { FAIL_2("invalid series", alias) }
+
+        if (false == aliases.emplace(alias).second) {
+            FAIL_2("duplicate series", alias)
+        }
+    }
+
     return true;
 }
 
 auto CheckProto_2(
     const BlindedSeriesList& input,
     const bool silent,
-    const std::string&) -> bool
+    const std::string& notary) -> bool
 {
-    UNDEFINED_VERSION(2)
+    CHECK_IDENTIFIER(notary);
+
+    if (notary != input.notary()) {
+        FAIL_4("Incorrect notary ", input.notary(), " expected ", notary);
+    }
+
+    CHECK_IDENTIFIER(unit);
+    CHECK_SUBOBJECTS(series, BlindedSeriesListAllowedStorageItemHash());
+
+    // A mint series is stored as a sequence of spent token list segments,
+    // each aliased as <series>:<segment>
+    auto aliases = std::set<std::string>{};
+
+    for (const auto& series : input.series()) {
+        const auto& alias = series.alias();
+        const auto colon = alias.find(':');
+
+        if (std::string::npos == colon) { FAIL_2("missing segment", alias) }
+
+        const auto valid = is_number(alias.substr(0, colon)) &&
+                           is_number(alias.substr(colon + 1u));
+
+        if (false == valid) { FAIL_2("invalid series segment", alias) }
+
+        if (false == aliases.emplace(alias).second) {
+            FAIL_2("duplicate series segment", alias)
+        }
+    }
+
+    return true;
 }
 
 auto CheckProto_3(
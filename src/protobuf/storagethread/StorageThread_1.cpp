@@ -9,8 +9,10 @@
 
 #include "opentxs/protobuf/Basic.hpp"
 #include "opentxs/protobuf/Check.hpp"
+#include "opentxs/protobuf/StorageItemHash.pb.h"
 #include "opentxs/protobuf/StorageThread.pb.h"
 #include "opentxs/protobuf/StorageThreadItem.pb.h"
+#include "opentxs/protobuf/verify/StorageItemHash.hpp"
 #include "opentxs/protobuf/verify/StorageThread.hpp"
 #include "opentxs/protobuf/verify/StorageThreadItem.hpp"
 #include "opentxs/protobuf/verify/VerifyStorage.hpp"
@@ -53,12 +55,65 @@ auto CheckProto_1(const StorageThread& input, const bool silent) -> bool
         }
     }
 
+    if (0 < input.chunk_size()) { FAIL_1("unexpected chunk") }
+
     return true;
 }
 
 auto CheckProto_2(const StorageThread& input, const bool silent) -> bool
 {
-    UNDEFINED_VERSION(2)
+    if (!input.has_id()) { FAIL_1("missing id") }
+
+    if (MIN_PLAUSIBLE_IDENTIFIER > input.id().size()) { FAIL_1("invalid id") }
+
+    for (auto& nym : input.participant()) {
+        if (MIN_PLAUSIBLE_IDENTIFIER > nym.size()) {
+            FAIL_1("invalid participant")
+        }
+    }
+
+    if (0 == input.participant_size()) { FAIL_1("no patricipants") }
+
+    for (auto& item : input.item()) {
+        try {
+            const bool valid = Check(
+                item,
+                StorageThreadAllowedItem().at(input.version()).first,
+                StorageThreadAllowedItem().at(input.version()).second,
+                silent);
+
+            if (false == valid) { FAIL_1("invalid item") }
+        } catch (const std::out_of_range&) {
+            FAIL_2(
+                "allowed storage thread item version not defined for version",
+                input.version())
+        }
+    }
+
+    // A thread index lists either its items or the chunks which contain them
+    if ((0 < input.item_size()) && (0 < input.chunk_size())) {
+        FAIL_1("items and chunks both present")
+    }
+
+    for (auto& chunk : input.chunk()) {
+        try {
+            const bool valid = Check(
+                chunk,
+                StorageThreadAllowedStorageItemHash().at(input.version()).first,
+                StorageThreadAllowedStorageItemHash()
+                    .at(input.version())
+                    .second,
+                silent);
+
+            if (false == valid) { FAIL_1("invalid chunk") }
+        } catch (const std::out_of_range&) {
+            FAIL_2(
+                "allowed storage item hash version not defined for version",
+                input.version())
+        }
+    }
+
+    return true;
 }
 
 auto CheckProto_3(const StorageThread& input, const bool silent) -> bool
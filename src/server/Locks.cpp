@@ -0,0 +1,113 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"      // IWYU pragma: associated
+#include "1_Internal.hpp"    // IWYU pragma: associated
+#include "server/Locks.hpp"  // IWYU pragma: associated
+
+#include <functional>
+#include <utility>
+
+namespace opentxs::server
+{
+Locks::Set::Set() noexcept
+    : cron_shared_()
+    , cron_exclusive_()
+    , shared_()
+    , exclusive_()
+    , stripes_()
+{
+}
+
+Locks::Set::Set(Set&& rhs) noexcept
+    : cron_shared_(std::move(rhs.cron_shared_))
+    , cron_exclusive_(std::move(rhs.cron_exclusive_))
+    , shared_(std::move(rhs.shared_))
+    , exclusive_(std::move(rhs.exclusive_))
+    , stripes_(std::move(rhs.stripes_))
+{
+}
+
+auto Locks::Set::operator=(Set&& rhs) noexcept -> Set&
+{
+    stripes_ = std::move(rhs.stripes_);
+    exclusive_ = std::move(rhs.exclusive_);
+    shared_ = std::move(rhs.shared_);
+    cron_exclusive_ = std::move(rhs.cron_exclusive_);
+    cron_shared_ = std::move(rhs.cron_shared_);
+
+    return *this;
+}
+
+Locks::Locks(const std::size_t stripes) noexcept
+    : cron_()
+    , global_()
+    , stripes_(stripes)
+{
+}
+
+auto Locks::Cron() const noexcept -> Set
+{
+    auto output = Set{};
+    output.cron_exclusive_ = eLock{cron_};
+
+    return output;
+}
+
+auto Locks::Exclusive() const noexcept -> Set
+{
+    auto output = Set{};
+    output.cron_exclusive_ = eLock{cron_};
+    output.exclusive_ = eLock{global_};
+
+    return output;
+}
+
+auto Locks::Global() const noexcept -> Set
+{
+    auto output = Set{};
+    output.exclusive_ = eLock{global_};
+
+    return output;
+}
+
+auto Locks::Shared(
+    const std::set<std::string>& ids,
+    const CronAccess cron) const noexcept -> Set
+{
+    // Stripes are always locked in ascending order so two requests which
+    // need overlapping sets of stripes can not deadlock
+    auto indices = std::set<std::size_t>{};
+
+    for (const auto& id : ids) {
+        if (id.empty()) { continue; }
+
+        indices.emplace(std::hash<std::string>{}(id) % stripes_.size());
+    }
+
+    auto output = Set{};
+
+    switch (cron) {
+        case CronAccess::Read: {
+            output.cron_shared_ = sLock{cron_};
+        } break;
+        case CronAccess::Write: {
+            output.cron_exclusive_ = eLock{cron_};
+        } break;
+        case CronAccess::None:
+        default: {
+        }
+    }
+
+    output.shared_ = sLock{global_};
+    output.stripes_.reserve(indices.size());
+
+    for (const auto index : indices) {
+        output.stripes_.emplace_back(stripes_.at(index));
+    }
+
+    return output;
+}
+}  // namespace opentxs::server
@@ -0,0 +1,87 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::server
+{
+// Locks which allow requests from different nyms to be processed at the same
+// time.
+//
+// A request which only modifies state belonging to a known set of nyms and
+// accounts holds the global lock in shared mode, plus the striped lock for
+// each of those identifiers. Requests with effects that can not be determined
+// in advance hold the global lock exclusively.
+//
+// Cron has a lock of its own which protects the cron items and markets. Cron
+// holds it exclusively while it runs and locks the nyms and accounts of each
+// item as it processes that item. Requests which read markets hold the cron
+// lock shared, and requests which add cron items hold it exclusively.
+//
+// Locks are always acquired in this order: cron, global, stripes.
+class Locks
+{
+public:
+    enum class CronAccess { None, Read, Write };
+
+    // Releases every lock in the reverse order of acquisition when destroyed
+    class Set
+    {
+    public:
+        auto Exclusive() const noexcept -> bool
+        {
+            return exclusive_.owns_lock();
+        }
+
+        Set() noexcept;
+        Set(Set&&) noexcept;
+        auto operator=(Set&&) noexcept -> Set&;
+
+    private:
+        friend Locks;
+
+        sLock cron_shared_;
+        eLock cron_exclusive_;
+        sLock shared_;
+        eLock exclusive_;
+        std::vector<Lock> stripes_;
+
+        Set(const Set&) = delete;
+        auto operator=(const Set&) -> Set& = delete;
+    };
+
+    // The cron lock only
+    auto Cron() const noexcept -> Set;
+    // The cron lock and the global lock
+    auto Exclusive() const noexcept -> Set;
+    // The global lock only, for cron items which can affect any account. Must
+    // only be called while holding the cron lock.
+    auto Global() const noexcept -> Set;
+    auto Shared(
+        const std::set<std::string>& ids,
+        const CronAccess cron = CronAccess::None) const noexcept -> Set;
+
+    Locks(const std::size_t stripes = 256) noexcept;
+
+private:
+    mutable std::shared_mutex cron_;
+    mutable std::shared_mutex global_;
+    mutable std::vector<std::mutex> stripes_;
+
+    Locks(const Locks&) = delete;
+    Locks(Locks&&) = delete;
+    auto operator=(const Locks&) -> Locks& = delete;
+    auto operator=(Locks &&) -> Locks& = delete;
+};
+}  // namespace opentxs::server
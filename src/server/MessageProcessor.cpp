@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"               // IWYU pragma: associated
 #include "server/MessageProcessor.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <ostream>
@@ -79,16 +80,14 @@ MessageProcessor::MessageProcessor(
           [=](const zmq::Message& incoming) -> OTZMQMessage {
               return this->process_backend(incoming);
           }))
-    , backend_socket_(server.API().ZeroMQ().ReplySocket(
-          backend_callback_,
-          zmq::socket::Socket::Direction::Bind))
+    , backend_sockets_()
     , internal_callback_(zmq::ListenCallback::Factory(
           [=](const zmq::Message& incoming) -> void {
               this->process_internal(incoming);
           }))
     , internal_socket_(server.API().ZeroMQ().DealerSocket(
           internal_callback_,
-          zmq::socket::Socket::Direction::Connect))
+          zmq::socket::Socket::Direction::Bind))
     , notification_callback_(zmq::ListenCallback::Factory(
           [=](const zmq::Message& incoming) -> void {
               this->process_notification(incoming);
@@ -105,8 +104,7 @@ MessageProcessor::MessageProcessor(
     , active_connections_()
     , connection_map_lock_()
 {
-    auto bound = backend_socket_->Start(internal_endpoint_);
-    bound &= internal_socket_->Start(internal_endpoint_);
+    auto bound = internal_socket_->Start(internal_endpoint_);
     bound &= notification_socket_->Start(
         server_.API().Endpoints().InternalPushNotification());
 
@@ -135,7 +133,8 @@ void MessageProcessor::cleanup()
     frontend_socket_->Close();
     notification_socket_->Close();
     internal_socket_->Close();
-    backend_socket_->Close();
+
+    for (auto& socket : backend_sockets_) { socket->Close(); }
 
     if (thread_.joinable()) { thread_.join(); }
 }
@@ -175,10 +174,30 @@ auto MessageProcessor::get_connection(const network::zeromq::Message& incoming)
 void MessageProcessor::init(
     const bool inproc,
     const int port,
-    const Secret& privkey)
+    const Secret& privkey,
+    const std::size_t workers)
 {
     if (port == 0) { OT_FAIL; }
 
+    // The internal dealer socket distributes requests to the reply sockets in
+    // round robin order. Each reply socket processes requests on its own
+    // thread.
+    const auto count = std::max(workers, std::size_t{1});
+    backend_sockets_.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        auto& socket = backend_sockets_.emplace_back(
+            server_.API().ZeroMQ().ReplySocket(
+                backend_callback_, zmq::socket::Socket::Direction::Connect));
+        const auto started = socket->Start(internal_endpoint_);
+
+        OT_ASSERT(started);
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Started ")(count)(
+        " request processing threads")
+        .Flush();
+
     auto set = frontend_socket_->SetPrivateKey(privkey);
 
     OT_ASSERT(set);
@@ -214,8 +233,9 @@ void MessageProcessor::run()
         const auto timeout = server_.ComputeTimeout();
 
         if (timeout.count() <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            Lock lock(lock_);
+            // Each cron item locks the accounts it affects while it is
+            // processed, so most requests continue to run during cron
+            const auto locks = server_.GetLocks().Cron();
             server_.ProcessCron();
         }
 
@@ -226,8 +246,7 @@ void MessageProcessor::run()
 auto MessageProcessor::process_backend(const zmq::Message& incoming)
     -> OTZMQMessage
 {
-    // ProcessCron and process_backend must not run simultaneously
-    Lock lock(lock_);
+    // UserCommandProcessor acquires the locks required by each request
     std::string reply{};
 
     std::string messageString{};
@@ -6,18 +6,19 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "opentxs/Proto.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Identifier.hpp"
-#include "opentxs/core/Lockable.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/ReplyCallback.hpp"
@@ -58,14 +59,19 @@ class Secret;
 
 namespace opentxs::server
 {
-class MessageProcessor : Lockable
+class MessageProcessor
 {
 public:
     void DropIncoming(const int count) const;
     void DropOutgoing(const int count) const;
 
     void cleanup();
-    void init(const bool inproc, const int port, const Secret& privkey);
+    // Requests are processed by the specified number of worker threads
+    void init(
+        const bool inproc,
+        const int port,
+        const Secret& privkey,
+        const std::size_t workers = 1);
     void Start();
 
     explicit MessageProcessor(
@@ -82,7 +88,7 @@ private:
     OTZMQListenCallback frontend_callback_;
     OTZMQRouterSocket frontend_socket_;
     OTZMQReplyCallback backend_callback_;
-    OTZMQReplySocket backend_socket_;
+    std::vector<OTZMQReplySocket> backend_sockets_;
     OTZMQListenCallback internal_callback_;
     OTZMQDealerSocket internal_socket_;
     OTZMQListenCallback notification_callback_;
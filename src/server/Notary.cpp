@@ -8,6 +8,7 @@
 #include "server/Notary.hpp"  // IWYU pragma: associated
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <map>
@@ -125,6 +126,162 @@ Notary::Finalize::~Finalize()
     balance_item_.SaveContract();
 }
 
+auto Notary::Affected(
+    const Identifier& accountID,
+    Ledger& input,
+    std::set<std::string>& ids,
+    bool& cron) const -> bool
+{
+    const auto& serverID = server_.GetServerID();
+    const auto account = manager_.Wallet().Account(accountID);
+
+    if (false == bool(account)) { return false; }
+
+    const auto& unitID = account.get().GetInstrumentDefinitionID();
+
+    for (const auto& it : input.GetTransactionMap()) {
+        const auto& pTransaction = it.second;
+
+        if (false == bool(pTransaction)) { return false; }
+
+        auto& transaction = *pTransaction;
+
+        switch (transaction.GetType()) {
+            case transactionType::transfer: {
+                const auto item = transaction.GetItem(itemType::transfer);
+
+                if (false == bool(item)) { return false; }
+
+                ids.emplace(item->GetDestinationAcctID().str());
+            } break;
+            case transactionType::processInbox: {
+                if (false ==
+                    affected_by_inbox(account.get(), transaction, ids)) {
+                    return false;
+                }
+            } break;
+            case transactionType::withdrawal: {
+                ids.emplace(unitID.str());
+            } break;
+            case transactionType::deposit: {
+                ids.emplace(unitID.str());
+                const auto item = transaction.GetItem(itemType::depositCheque);
+
+                if (false == bool(item)) { break; }
+
+                const auto cheque = extract_cheque(serverID, unitID, *item);
+
+                if (false == bool(cheque)) { return false; }
+
+                ids.emplace(cheque->GetSenderNymID().str());
+                ids.emplace(cheque->GetSenderAcctID().str());
+
+                if (cheque->HasRemitter()) {
+                    ids.emplace(cheque->GetRemitterNymID().str());
+                    ids.emplace(cheque->GetRemitterAcctID().str());
+                }
+            } break;
+            case transactionType::marketOffer: {
+                const auto item = transaction.GetItem(itemType::marketOffer);
+
+                if (false == bool(item)) { return false; }
+
+                ids.emplace(item->GetDestinationAcctID().str());
+                cron = true;
+            } break;
+            case transactionType::paymentPlan: {
+                const auto item = transaction.GetItem(itemType::paymentPlan);
+
+                if (false == bool(item)) { return false; }
+
+                auto serialized = String::Factory();
+                item->GetAttachment(serialized);
+                auto plan = manager_.Factory().PaymentPlan();
+
+                OT_ASSERT(plan);
+
+                if (false == plan->LoadContractFromString(serialized)) {
+                    return false;
+                }
+
+                ids.emplace(plan->GetSenderNymID().str());
+                ids.emplace(plan->GetSenderAcctID().str());
+                ids.emplace(plan->GetRecipientNymID().str());
+                ids.emplace(plan->GetRecipientAcctID().str());
+                cron = true;
+            } break;
+            default: {
+                // Dividends, basket exchanges, smart contracts, and cron item
+                // cancellation can affect any account
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+auto Notary::affected_by_inbox(
+    const Account& account,
+    OTTransaction& processInbox,
+    std::set<std::string>& ids) const -> bool
+{
+    const auto& serverID = server_.GetServerID();
+    std::unique_ptr<Ledger> inbox{};
+
+    for (const auto& item : processInbox.GetItemList()) {
+        if (false == bool(item)) { return false; }
+
+        switch (item->GetType()) {
+            case itemType::acceptPending:
+            case itemType::rejectPending: {
+            } break;
+            default: {
+                // Other receipts only modify the account being processed
+                continue;
+            }
+        }
+
+        // Accepting or rejecting a transfer modifies the sender's inbox and
+        // outbox. The sender of a pending transfer never changes, so it can
+        // be looked up before the request holds any locks.
+        if (false == bool(inbox)) {
+            inbox.reset(manager_.Factory()
+                            .Ledger(
+                                account.GetNymID(),
+                                account.GetRealAccountID(),
+                                serverID)
+                            .release());
+
+            OT_ASSERT(inbox);
+
+            if (false == inbox->LoadInbox()) { return false; }
+        }
+
+        const auto number = item->GetReferenceToNum();
+        auto pending = inbox->GetTransaction(number);
+
+        if (pending && pending->IsAbbreviated()) {
+            if (false == inbox->LoadBoxReceipt(number)) { return false; }
+
+            pending = inbox->GetTransaction(number);
+        }
+
+        if (false == bool(pending)) { return false; }
+
+        auto serialized = String::Factory();
+        pending->GetReferenceString(serialized);
+        const auto original = manager_.Factory().Item(
+            serialized, serverID, pending->GetReferenceToNum());
+
+        if (false == bool(original)) { return false; }
+
+        ids.emplace(original->GetPurportedAccountID().str());
+    }
+
+    return true;
+}
+
 void Notary::AddHashesToTransaction(
     OTTransaction& transaction,
     const Ledger& inbox,
@@ -8217,6 +8374,10 @@ void Notary::process_cash_deposit(
                     LogOutput(OT_METHOD)(__FUNCTION__)(
                         ": Incorrect notary ID on purse")
                         .Flush();
+                } else if (false == verify_tokens(purse)) {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Purse contains invalid tokens")
+                        .Flush();
                 } else {
                     responseBalanceItem.SetStatus(Item::acknowledgement);
                     bool bSuccess{false};
@@ -8585,7 +8746,7 @@ auto Notary::process_token_deposit(
         return false;
     }
 
-    if (false == verify_token(mint, token)) { return false; }
+    if (false == verify_token(token)) { return false; }
 
     if (false == reserveAccount.get().Debit(amount)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(
@@ -8755,20 +8916,9 @@ auto Notary::process_token_withdrawal(
     return true;
 }
 
-auto Notary::verify_token(blind::Mint& mint, blind::Token& token) -> bool
+auto Notary::verify_token(blind::Token& token) -> bool
 {
-    // This call to VerifyToken verifies the token's Series and From/To dates
-    // against the mint's, and also verifies that the CURRENT date is inside
-    // that valid date range.
-    //
-    // It also verifies the Lucre coin data itself against the key for that
-    // series and denomination. (The signed and unblinded Lucre coin is finally
-    // verified in Lucre using the appropriate Mint private key.)
-    if (false == mint.VerifyToken(server_.GetServerNym(), token, reason_)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to verofy token").Flush();
-
-        return false;
-    }
+    // The token signature was already checked by verify_tokens
 
     // Lookup the token in the SPENT TOKEN DATABASE, and make sure
     // that it hasn't already been spent...
@@ -8785,5 +8935,24 @@ auto Notary::verify_token(blind::Mint& mint, blind::Token& token) -> bool
         return true;
     }
 }
+
+auto Notary::verify_tokens(const blind::Purse& purse) -> bool
+{
+    // Verifies the Lucre coin data of every token against the key for its
+    // series and denomination. The signatures are checked concurrently.
+    const auto verified =
+        purse.VerifyTokens(manager_, server_.GetServerNym(), reason_);
+
+    for (auto i = std::size_t{0}; i < verified.size(); ++i) {
+        if (false == verified.at(i)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to verify token ")(i)
+                .Flush();
+
+            return false;
+        }
+    }
+
+    return true;
+}
 #endif
 }  // namespace opentxs::server
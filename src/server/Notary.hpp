@@ -6,6 +6,8 @@
 #pragma once
 
 #include <memory>
+#include <set>
+#include <string>
 
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Account.hpp"
@@ -58,6 +60,7 @@ class Client;
 namespace server
 {
 class Server;
+class Test_Notary;
 }  // namespace server
 
 class Identifier;
@@ -70,6 +73,16 @@ namespace opentxs::server
 class Notary
 {
 public:
+    // Adds the nyms and accounts other than the sender and the sender's
+    // account which notarizing the ledger can modify, including reserve
+    // accounts which are identified by their unit definition. Sets cron if
+    // the ledger adds cron items. Returns false if the affected accounts can
+    // not be determined without processing the ledger.
+    auto Affected(
+        const Identifier& accountID,
+        Ledger& input,
+        std::set<std::string>& ids,
+        bool& cron) const -> bool;
     void NotarizeProcessInbox(
         otx::context::Client& context,
         ExclusiveAccount& account,
@@ -91,6 +104,7 @@ public:
 
 private:
     friend Server;
+    friend Test_Notary;
 
     class Finalize
     {
@@ -121,6 +135,10 @@ private:
         const Ledger& inbox,
         const Ledger& outbox,
         const Identifier& accounthash) const;
+    auto affected_by_inbox(
+        const Account& account,
+        OTTransaction& processInbox,
+        std::set<std::string>& ids) const -> bool;
     auto extract_cheque(
         const identifier::Server& serverID,
         const identifier::UnitDefinition& unitID,
@@ -294,7 +312,8 @@ private:
         Account& account,
         blind::Purse& replyPurse,
         std::shared_ptr<blind::Token> pToken) -> bool;
-    auto verify_token(blind::Mint& mint, blind::Token& token) -> bool;
+    auto verify_token(blind::Token& token) -> bool;
+    OPENTXS_EXPORT auto verify_tokens(const blind::Purse& purse) -> bool;
 #endif
 
     Notary(
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <list>
+#include <memory>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -40,8 +41,10 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/contract/ServerContract.hpp"
 #include "opentxs/core/cron/OTCron.hpp"
+#include "opentxs/core/cron/OTCronItem.hpp"
 #include "opentxs/core/crypto/NymParameters.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/core/recurring/OTPaymentPlan.hpp"
 #include "opentxs/crypto/Envelope.hpp"
 #include "opentxs/ext/OTPayment.hpp"
 #include "opentxs/identity/Nym.hpp"
@@ -78,6 +81,7 @@ Server::Server(
     const PasswordPrompt& reason)
     : manager_(manager)
     , reason_(reason)
+    , locks_()
     , mainFile_(*this, reason_)
     , notary_(*this, reason_, manager_)
     , transactor_(*this, reason_)
@@ -113,6 +117,24 @@ void Server::ActivateCron()
 /// It sleeps in between. (See testserver.cpp for the call
 /// and OTSleep() for the sleep code.)
 ///
+auto Server::lock_cron_item(const OTCronItem& item) const
+    -> std::shared_ptr<const void>
+{
+    const auto* plan = dynamic_cast<const OTPaymentPlan*>(&item);
+
+    if (nullptr != plan) {
+        return std::make_shared<Locks::Set>(
+            locks_.Shared({plan->GetSenderNymID().str(),
+                           plan->GetSenderAcctID().str(),
+                           plan->GetRecipientNymID().str(),
+                           plan->GetRecipientAcctID().str()}));
+    }
+
+    // Trades settle against other offers in their market, and smart contracts
+    // can move funds between the accounts of any of their parties
+    return std::make_shared<Locks::Set>(locks_.Global());
+}
+
 void Server::ProcessCron()
 {
     if (!m_Cron->IsActivated()) return;
@@ -135,9 +157,10 @@ void Server::ProcessCron()
 
     if (bAddedNumbers) { m_Cron->SaveCron(); }
 
-    m_Cron->ProcessCronItems();  // This needs to be called regularly for
-                                 // trades, markets, payment plans, etc to
-                                 // process.
+    // This needs to be called regularly for trades, markets, payment plans,
+    // etc to process.
+    m_Cron->ProcessCronItems(
+        [this](const OTCronItem& item) { return lock_cron_item(item); });
 
     // NOTE:  TODO:  OTHER RE-OCCURRING SERVER FUNCTIONS CAN GO HERE AS WELL!!
     //
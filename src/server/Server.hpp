@@ -29,6 +29,7 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/socket/Push.hpp"
 #include "opentxs/protobuf/ContractEnums.pb.h"
+#include "server/Locks.hpp"
 #include "server/MainFile.hpp"
 #include "server/Notary.hpp"
 #include "server/Transactor.hpp"
@@ -98,6 +99,7 @@ public:
         const identifier::Nym& recipientNymID,
         transactionType transactionType,
         const Message& msg) -> bool;
+    auto GetLocks() const -> const Locks& { return locks_; }
     auto GetMainFile() -> MainFile& { return mainFile_; }
     auto GetNotary() -> Notary& { return notary_; }
     auto GetTransactor() -> Transactor& { return transactor_; }
@@ -128,6 +130,7 @@ private:
 
     const opentxs::api::server::internal::Manager& manager_;
     const PasswordPrompt& reason_;
+    const Locks locks_;
     MainFile mainFile_;
     Notary notary_;
     Transactor transactor_;
@@ -149,6 +152,8 @@ private:
                                      // tasks go.
     OTZMQPushSocket notification_socket_;
 
+    auto lock_cron_item(const OTCronItem& item) const
+        -> std::shared_ptr<const void>;
     auto nymbox_push(const identifier::Nym& nymID, const OTTransaction& item)
         const -> OTZMQMessage;
 
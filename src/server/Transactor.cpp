@@ -33,6 +33,7 @@ namespace opentxs::server
 Transactor::Transactor(Server& server, const PasswordPrompt& reason)
     : server_(server)
     , reason_(reason)
+    , number_lock_()
     , transactionNumber_(0)
     , idToBasketMap_()
     , contractIdToBasketAccountId_()
@@ -51,6 +52,8 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
 auto Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber) -> bool
 {
+    rLock lock(number_lock_);
+
     // transactionNumber_ stores the last VALID AND ISSUED transaction number.
     // So first, we increment that, since we don't want to issue the same number
     // twice.
@@ -75,6 +78,8 @@ auto Transactor::issueNextTransactionNumberToNym(
     otx::context::Client& context,
     TransactionNumber& lTransactionNumber) -> bool
 {
+    rLock lock(number_lock_);
+
     if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
 
     // Each Nym stores the transaction numbers that have been issued to it.
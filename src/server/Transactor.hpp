@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "opentxs/Types.hpp"
@@ -98,6 +99,8 @@ private:
 
     Server& server_;
     const PasswordPrompt& reason_;
+    // Requests from different nyms may be issued numbers at the same time
+    std::recursive_mutex number_lock_;
     // This stores the last VALID AND ISSUED transaction number.
     TransactionNumber transactionNumber_;
     // maps basketId with basketAccountId
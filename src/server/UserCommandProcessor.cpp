@@ -2715,6 +2715,82 @@ auto UserCommandProcessor::load_inbox(
     return inbox;
 }
 
+auto UserCommandProcessor::affected(
+    const Message& msgIn,
+    std::set<std::string>& ids,
+    bool& cron) const -> bool
+{
+    const auto nymID = identifier::Nym::Factory(msgIn.m_strNymID);
+    const auto accountID = Identifier::Factory(msgIn.m_strAcctID);
+    auto input{
+        manager_.Factory().Ledger(nymID, accountID, server_.GetServerID())};
+
+    OT_ASSERT(input);
+
+    if (false ==
+        input->LoadLedgerFromString(String::Factory(msgIn.m_ascPayload))) {
+        return false;
+    }
+
+    return server_.GetNotary().Affected(accountID, *input, ids, cron);
+}
+
+auto UserCommandProcessor::lock_request(
+    const Message& msgIn,
+    const MessageType type) const -> Locks::Set
+{
+    const auto& locks = server_.GetLocks();
+
+    switch (type) {
+        case MessageType::pingNotary:
+        case MessageType::getRequestNumber:
+        case MessageType::getTransactionNumbers:
+        case MessageType::checkNym:
+        case MessageType::sendNymMessage:
+        case MessageType::getNymbox:
+        case MessageType::getBoxReceipt:
+        case MessageType::getAccountData:
+        case MessageType::processNymbox:
+        case MessageType::queryInstrumentDefinitions:
+        case MessageType::getInstrumentDefinition:
+        case MessageType::getMint: {
+            // These requests only modify state belonging to the sender, to
+            // the recipient of a nym message, or to the account named in the
+            // request
+            return locks.Shared({msgIn.m_strNymID->Get(),
+                                 msgIn.m_strNymID2->Get(),
+                                 msgIn.m_strAcctID->Get()});
+        }
+        case MessageType::getMarketList:
+        case MessageType::getMarketOffers:
+        case MessageType::getMarketRecentTrades:
+        case MessageType::getNymMarketOffers: {
+            // Markets are modified by cron
+            return locks.Shared(
+                {msgIn.m_strNymID->Get()}, Locks::CronAccess::Read);
+        }
+        case MessageType::notarizeTransaction:
+        case MessageType::processInbox: {
+            auto ids = std::set<std::string>{msgIn.m_strNymID->Get(),
+                                             msgIn.m_strAcctID->Get()};
+            auto cron{false};
+
+            if (affected(msgIn, ids, cron)) {
+                return locks.Shared(
+                    ids,
+                    cron ? Locks::CronAccess::Write : Locks::CronAccess::None);
+            }
+
+            return locks.Exclusive();
+        }
+        default: {
+            // Account and contract registration, and administrative commands
+            // can affect any nym or account
+            return locks.Exclusive();
+        }
+    }
+}
+
 auto UserCommandProcessor::load_nymbox(
     const identifier::Nym& nymID,
     const identifier::Server& serverID,
@@ -2812,6 +2888,7 @@ auto UserCommandProcessor::ProcessUserCommand(
 {
     const std::string command(msgIn.m_strCommand->Get());
     const auto type = Message::Type(command);
+    const auto locks = lock_request(msgIn, type);
     ReplyMessage reply(
         *this,
         server_.API().Wallet(),
@@ -7,12 +7,15 @@
 
 #include <cstdint>
 #include <memory>
+#include <set>
+#include <string>
 #include <vector>
 
 #include "internal/api/server/Server.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Message.hpp"
+#include "server/Locks.hpp"
 
 namespace opentxs
 {
@@ -187,6 +190,12 @@ private:
         const identifier::Server& serverID,
         const identity::Nym& serverNym,
         const bool verifyAccount) const -> std::unique_ptr<Ledger>;
+    auto affected(
+        const Message& msgIn,
+        std::set<std::string>& ids,
+        bool& cron) const -> bool;
+    auto lock_request(const Message& msgIn, const MessageType type) const
+        -> Locks::Set;
     auto load_nymbox(
         const identifier::Nym& nymID,
         const identifier::Server& serverID,
@@ -7,6 +7,8 @@
 #include "1_Internal.hpp"      // IWYU pragma: associated
 #include "storage/Plugin.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <map>
 #include <thread>
 
 #include "opentxs/api/storage/Storage.hpp"
@@ -17,6 +19,8 @@
 
 namespace opentxs
 {
+const std::size_t Plugin::batch_limit_{256};
+const std::size_t Plugin::queue_limit_{4096};
 
 Plugin::Plugin(
     const api::storage::Storage& storage,
@@ -29,9 +33,41 @@ Plugin::Plugin(
     , storage_(storage)
     , digest_(hash)
     , current_bucket_(bucket)
+    , write_lock_()
+    , write_ready_()
+    , write_done_()
+    , write_queue_()
+    , writes_queued_(0)
+    , writes_finished_(0)
+    , write_stats_()
+    , running_(true)
+    , writer_(&Plugin::write_thread, this)
 {
 }
 
+void Plugin::Cleanup_Plugin()
+{
+    {
+        Lock lock(write_lock_);
+
+        if (false == running_) { return; }
+
+        running_ = false;
+    }
+
+    write_ready_.notify_all();
+    write_done_.notify_all();
+
+    if (writer_.joinable()) { writer_.join(); }
+}
+
+void Plugin::Flush() const
+{
+    Lock lock(write_lock_);
+    const auto target = writes_queued_;
+    write_done_.wait(lock, [&] { return writes_finished_ >= target; });
+}
+
 auto Plugin::Load(
     const std::string& key,
     const bool checking,
@@ -119,7 +155,7 @@ auto Plugin::Store(
 {
     std::promise<bool> promise;
     auto future = promise.get_future();
-    store(isTransaction, key, value, bucket, &promise);
+    queue_write(isTransaction, key, value, bucket, promise);
 
     return future.get();
 }
@@ -131,9 +167,7 @@ void Plugin::Store(
     const bool bucket,
     std::promise<bool>& promise) const
 {
-    std::thread thread(
-        &Plugin::store, this, isTransaction, key, value, bucket, &promise);
-    thread.detach();
+    queue_write(isTransaction, key, value, bucket, promise);
 }
 
 auto Plugin::Store(
@@ -151,4 +185,99 @@ auto Plugin::Store(
 
     return false;
 }
+
+void Plugin::queue_write(
+    const bool isTransaction,
+    const std::string& key,
+    const std::string& value,
+    const bool bucket,
+    std::promise<bool>& promise) const
+{
+    Lock lock(write_lock_);
+
+    // Callers block while the queue is full so that a burst of writes can not
+    // consume an unbounded amount of memory
+    write_done_.wait(lock, [&] {
+        return (false == running_) || (write_queue_.size() < queue_limit_);
+    });
+
+    if (false == running_) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Shutting down").Flush();
+        promise.set_value(false);
+
+        return;
+    }
+
+    write_queue_.emplace_back(
+        bucket, Write{isTransaction, key, value, &promise});
+    ++writes_queued_;
+    write_stats_.max_queued_ =
+        std::max(write_stats_.max_queued_, write_queue_.size());
+    lock.unlock();
+    write_ready_.notify_one();
+}
+
+void Plugin::store_batch(const bool bucket, Batch& batch) const
+{
+    for (auto& write : batch) {
+        store(
+            write.transaction_,
+            write.key_,
+            write.value_,
+            bucket,
+            write.promise_);
+    }
+}
+
+void Plugin::write_thread()
+{
+    auto batches = std::map<bool, Batch>{};
+
+    while (true) {
+        Lock lock(write_lock_);
+        write_ready_.wait(lock, [&] {
+            return (false == running_) || (0 < write_queue_.size());
+        });
+
+        // Pending writes are completed before the thread exits
+        if (write_queue_.empty()) { return; }
+
+        const auto count = std::min(write_queue_.size(), batch_limit_);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            auto& [bucket, write] = write_queue_.front();
+            batches[bucket].emplace_back(std::move(write));
+            write_queue_.pop_front();
+        }
+
+        ++write_stats_.batches_;
+        write_stats_.writes_ += count;
+        write_stats_.largest_batch_ =
+            std::max(write_stats_.largest_batch_, count);
+        lock.unlock();
+        write_done_.notify_all();
+
+        for (auto& [bucket, batch] : batches) {
+            if (0 < batch.size()) { store_batch(bucket, batch); }
+
+            batch.clear();
+        }
+
+        lock.lock();
+        writes_finished_ += count;
+        lock.unlock();
+        write_done_.notify_all();
+    }
+}
+
+auto Plugin::WriteStats() const -> WriteStatistics
+{
+    Lock lock(write_lock_);
+    auto output = write_stats_;
+    output.queued_ = write_queue_.size();
+
+    return output;
+}
+
+Plugin::~Plugin() { Cleanup_Plugin(); }
 }  // namespace opentxs
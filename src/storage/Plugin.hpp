@@ -6,9 +6,17 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
@@ -37,6 +45,16 @@ class StorageConfig;
 class Plugin : virtual public opentxs::api::storage::Plugin
 {
 public:
+    struct WriteStatistics {
+        // Number of writes waiting for the writer thread
+        std::size_t queued_{0};
+        // Largest number of writes which have been waiting at once
+        std::size_t max_queued_{0};
+        std::size_t batches_{0};
+        std::size_t writes_{0};
+        std::size_t largest_batch_{0};
+    };
+
     auto EmptyBucket(const bool bucket) const -> bool override = 0;
 
     auto Load(const std::string& key, const bool checking, std::string& value)
@@ -69,11 +87,24 @@ public:
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool override = 0;
 
+    // Blocks until every write queued prior to the call has been processed
+    void Flush() const;
+    auto WriteStats() const -> WriteStatistics;
+
     virtual void Cleanup() = 0;
 
-    ~Plugin() override = default;
+    ~Plugin() override;
 
 protected:
+    struct Write {
+        bool transaction_;
+        std::string key_;
+        std::string value_;
+        std::promise<bool>* promise_;
+    };
+
+    using Batch = std::vector<Write>;
+
     const StorageConfig& config_;
     const Random& random_;
 
@@ -91,11 +122,40 @@ protected:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const = 0;
+    // Drivers which can write several objects in a single transaction should
+    // override this. The promise for every write must be satisfied.
+    virtual void store_batch(const bool bucket, Batch& batch) const;
+
+    // Must be called by the destructor of every driver before any state
+    // needed by store() or store_batch() is destroyed
+    void Cleanup_Plugin();
 
 private:
+    using Queued = std::pair<bool, Write>;
+
+    static const std::size_t batch_limit_;
+    static const std::size_t queue_limit_;
+
     const api::storage::Storage& storage_;
     const Digest& digest_;
     const Flag& current_bucket_;
+    mutable std::mutex write_lock_;
+    mutable std::condition_variable write_ready_;
+    mutable std::condition_variable write_done_;
+    mutable std::deque<Queued> write_queue_;
+    mutable std::uint64_t writes_queued_;
+    mutable std::uint64_t writes_finished_;
+    mutable WriteStatistics write_stats_;
+    bool running_;
+    std::thread writer_;
+
+    void queue_write(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const;
+    void write_thread();
 
     Plugin(const Plugin&) = delete;
     Plugin(Plugin&&) = delete;
@@ -47,10 +47,7 @@ StorageFS::StorageFS(
 
 void StorageFS::Cleanup() { Cleanup_StorageFS(); }
 
-void StorageFS::Cleanup_StorageFS()
-{
-    // future cleanup actions go here
-}
+void StorageFS::Cleanup_StorageFS() { Cleanup_Plugin(); }
 
 void StorageFS::Init_StorageFS()
 {
@@ -68,10 +68,7 @@ void StorageFSGC::Cleanup()
     ot_super::Cleanup();
 }
 
-void StorageFSGC::Cleanup_StorageFSGC()
-{
-    // future cleanup actions go here
-}
+void StorageFSGC::Cleanup_StorageFSGC() { Cleanup_Plugin(); }
 
 auto StorageFSGC::EmptyBucket(const bool bucket) const -> bool
 {
@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"                   // IWYU pragma: associated
 #include "storage/drivers/StorageLMDB.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <string>
 #include <utility>
 
@@ -61,7 +62,7 @@ StorageLMDB::StorageLMDB(
 
 void StorageLMDB::Cleanup() { Cleanup_StorageLMDB(); }
 
-void StorageLMDB::Cleanup_StorageLMDB() {}
+void StorageLMDB::Cleanup_StorageLMDB() { Cleanup_Plugin(); }
 
 auto StorageLMDB::EmptyBucket(const bool bucket) const -> bool
 {
@@ -117,6 +118,51 @@ void StorageLMDB::store(
     }
 }
 
+void StorageLMDB::store_batch(const bool bucket, Batch& batch) const
+{
+    const auto table = get_table(bucket);
+    auto immediate = std::size_t{0};
+    auto success{true};
+
+    for (const auto& write : batch) {
+        if (write.transaction_) {
+            lmdb_.Queue(table, write.key_, write.value_);
+        } else {
+            ++immediate;
+        }
+    }
+
+    // Every object which is not part of a root transaction is written in a
+    // single write transaction instead of one transaction per object
+    if (0 < immediate) {
+        try {
+            auto parentTxn = lmdb_.TransactionRW();
+
+            for (const auto& write : batch) {
+                if (write.transaction_) { continue; }
+
+                success &=
+                    lmdb_.Store(table, write.key_, write.value_, parentTxn)
+                        .first;
+            }
+
+            success = parentTxn.Finalize(success) && success;
+        } catch (...) {
+            success = false;
+        }
+
+        if (false == success) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to store ")(
+                immediate)(" objects")
+                .Flush();
+        }
+    }
+
+    for (auto& write : batch) {
+        write.promise_->set_value(write.transaction_ || success);
+    }
+}
+
 auto StorageLMDB::StoreRoot(const bool commit, const std::string& hash) const
     -> bool
 {
@@ -76,6 +76,7 @@ private:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const final;
+    void store_batch(const bool bucket, Batch& batch) const final;
 
     void Init_StorageLMDB();
 
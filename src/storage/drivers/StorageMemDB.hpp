@@ -51,9 +51,9 @@ public:
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool final;
 
-    void Cleanup() final {}
+    void Cleanup() final { Cleanup_Plugin(); }
 
-    ~StorageMemDB() final = default;
+    ~StorageMemDB() final { Cleanup_Plugin(); }
 
 private:
     using ot_super = Plugin;
@@ -7,9 +7,10 @@
 #include "1_Internal.hpp"                      // IWYU pragma: associated
 #include "storage/drivers/StorageSqlite3.hpp"  // IWYU pragma: associated
 
-#include <iostream>
-#include <memory>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "2_Factory.hpp"
@@ -17,6 +18,13 @@
 #include "opentxs/core/LogSource.hpp"
 #include "storage/StorageConfig.hpp"
 
+// Rows written by each multi-row statement. Every row uses two parameters
+// and older SQLite versions allow at most 999 parameters per statement.
+#define SQLITE3_UPSERT_ROWS 250
+// Milliseconds a load waits for a lock held by another connection, such as
+// during a write-ahead log checkpoint
+#define SQLITE3_BUSY_TIMEOUT 5000
+
 #define OT_METHOD "opentxs::StorageSqlite3::"
 
 namespace opentxs
@@ -46,49 +54,65 @@ StorageSqlite3::StorageSqlite3(
     , transaction_lock_()
     , transaction_bucket_(Flag::Factory(false))
     , pending_()
-    , db_(nullptr)
+    , write_()
+    , read_()
+    , wal_(false)
 {
     Init_StorageSqlite3();
 }
 
-auto StorageSqlite3::bind_key(
-    const std::string& source,
-    const std::string& key,
-    const std::size_t start) const -> std::string
+auto StorageSqlite3::begin(const Lock& lock) const -> bool
 {
-    sqlite3_stmt* statement{nullptr};
-    sqlite3_prepare_v2(db_, source.c_str(), -1, &statement, nullptr);
-    sqlite3_bind_text(statement, start, key.c_str(), key.size(), SQLITE_STATIC);
-    const auto output = expand_sql(statement);
-    sqlite3_finalize(statement);
-
-    return output;
+    return exec(lock, "BEGIN TRANSACTION;");
 }
 
 void StorageSqlite3::Cleanup() { Cleanup_StorageSqlite3(); }
 
-void StorageSqlite3::Cleanup_StorageSqlite3() { sqlite3_close(db_); }
-
-void StorageSqlite3::commit(std::stringstream& sql) const
+void StorageSqlite3::Cleanup_StorageSqlite3()
 {
-    sql << "COMMIT TRANSACTION;";
+    Cleanup_Plugin();
+    Lock writeLock(write_.lock_);
+    Lock readLock(read_.lock_);
+    finalize(writeLock, write_);
+    finalize(readLock, read_);
+
+    for (auto* db : {&read_.db_, &write_.db_}) {
+        if (nullptr != *db) {
+            sqlite3_close(*db);
+            *db = nullptr;
+        }
+    }
 }
 
 auto StorageSqlite3::commit_transaction(const std::string& rootHash) const
     -> bool
 {
     Lock lock(transaction_lock_);
-    std::stringstream sql{};
-    start_transaction(sql);
-    set_data(sql);
-    set_root(rootHash, sql);
-    commit(sql);
+    auto rows = std::vector<Row>{};
+    rows.reserve(pending_.size());
+
+    for (const auto& [key, value] : pending_) { rows.emplace_back(key, value); }
+
+    Lock statementLock(write_.lock_);
+    auto success = begin(statementLock);
+    success = success &&
+              upsert(
+                  statementLock,
+                  GetTableName(transaction_bucket_.get()),
+                  rows) &&
+              upsert(
+                  statementLock,
+                  config_.sqlite3_control_table_,
+                  {{config_.sqlite3_root_key_, rootHash}});
+    success = finish(statementLock, success);
     pending_.clear();
-    LogVerbose(OT_METHOD)(__FUNCTION__)(sql.str()).Flush();
 
-    return (
-        SQLITE_OK ==
-        sqlite3_exec(db_, sql.str().c_str(), nullptr, nullptr, nullptr));
+    if (false == success) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to commit transaction.")
+            .Flush();
+    }
+
+    return success;
 }
 
 auto StorageSqlite3::Create(const std::string& tablename) const -> bool
@@ -98,7 +122,8 @@ auto StorageSqlite3::Create(const std::string& tablename) const -> bool
     const std::string sql = createTable + "`" + tablename + "`" + tableFormat;
 
     return (
-        SQLITE_OK == sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr));
+        SQLITE_OK ==
+        sqlite3_exec(write_.db_, sql.c_str(), nullptr, nullptr, nullptr));
 }
 
 auto StorageSqlite3::EmptyBucket(const bool bucket) const -> bool
@@ -106,13 +131,37 @@ auto StorageSqlite3::EmptyBucket(const bool bucket) const -> bool
     return Purge(GetTableName(bucket));
 }
 
-auto StorageSqlite3::expand_sql(sqlite3_stmt* statement) const -> std::string
+auto StorageSqlite3::exec(const Lock& lock, const std::string& sql) const
+    -> bool
 {
-    const auto sql = sqlite3_expanded_sql(statement);
-    const std::string output{sql};
-    sqlite3_free(sql);
+    auto* statement = prepare(lock, write_, sql);
+
+    if (nullptr == statement) { return false; }
 
-    return output;
+    const auto result = sqlite3_step(statement);
+    reset(statement);
+
+    return (SQLITE_DONE == result);
+}
+
+void StorageSqlite3::finalize(const Lock& lock, Connection& connection) const
+{
+    OT_ASSERT(lock.owns_lock());
+
+    for (auto& [sql, statement] : connection.statements_) {
+        sqlite3_finalize(statement);
+    }
+
+    connection.statements_.clear();
+}
+
+auto StorageSqlite3::finish(const Lock& lock, const bool success) const -> bool
+{
+    if (success && exec(lock, "COMMIT TRANSACTION;")) { return true; }
+
+    exec(lock, "ROLLBACK TRANSACTION;");
+
+    return false;
 }
 
 auto StorageSqlite3::GetTableName(const bool bucket) const -> std::string
@@ -128,11 +177,34 @@ void StorageSqlite3::Init_StorageSqlite3()
     if (SQLITE_OK ==
         sqlite3_open_v2(
             filename.c_str(),
-            &db_,
+            &write_.db_,
             SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX,
             nullptr)) {
-        sqlite3_exec(
-            db_, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr);
+        sqlite3_stmt* journal{nullptr};
+
+        // The journal_mode pragma reports the mode actually in effect, which
+        // is not WAL if the filesystem or build does not support it
+        if (SQLITE_OK == sqlite3_prepare_v2(
+                             write_.db_,
+                             "PRAGMA journal_mode=WAL;",
+                             -1,
+                             &journal,
+                             nullptr)) {
+            if (SQLITE_ROW == sqlite3_step(journal)) {
+                const auto* mode = reinterpret_cast<const char*>(
+                    sqlite3_column_text(journal, 0));
+                wal_ = (nullptr != mode) && (std::string_view{mode} == "wal");
+            }
+        }
+
+        sqlite3_finalize(journal);
+
+        if (false == wal_) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Write-ahead logging not available.")
+                .Flush();
+        }
+
         Create(config_.sqlite3_primary_bucket_);
         Create(config_.sqlite3_secondary_bucket_);
         Create(config_.sqlite3_control_table_);
@@ -142,6 +214,25 @@ void StorageSqlite3::Init_StorageSqlite3()
 
         OT_FAIL
     }
+
+    // With write-ahead logging readers are not blocked by an open write
+    // transaction as long as they use their own connection. Without it a
+    // second connection would fail with SQLITE_BUSY during every write.
+    if (false == wal_) { return; }
+
+    if (SQLITE_OK !=
+        sqlite3_open_v2(
+            filename.c_str(),
+            &read_.db_,
+            SQLITE_OPEN_READONLY | SQLITE_OPEN_FULLMUTEX,
+            nullptr)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to open read connection.")
+            .Flush();
+
+        OT_FAIL
+    }
+
+    sqlite3_busy_timeout(read_.db_, SQLITE3_BUSY_TIMEOUT);
 }
 
 auto StorageSqlite3::LoadFromBucket(
@@ -165,29 +256,90 @@ auto StorageSqlite3::LoadRoot() const -> std::string
     return "";
 }
 
+auto StorageSqlite3::prepare(
+    const Lock& lock,
+    Connection& connection,
+    const std::string& sql) const -> sqlite3_stmt*
+{
+    OT_ASSERT(lock.owns_lock());
+
+    auto& statements = connection.statements_;
+    auto it = statements.find(sql);
+
+    if (statements.end() != it) { return it->second; }
+
+    sqlite3_stmt* statement{nullptr};
+
+    if (SQLITE_OK !=
+        sqlite3_prepare_v2(
+            connection.db_, sql.c_str(), -1, &statement, nullptr)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to prepare ")(sql)(": ")(
+            sqlite3_errmsg(connection.db_))
+            .Flush();
+        sqlite3_finalize(statement);
+
+        return nullptr;
+    }
+
+    statements.emplace(sql, statement);
+
+    return statement;
+}
+
 auto StorageSqlite3::Purge(const std::string& tablename) const -> bool
 {
     const std::string sql = "DROP TABLE `" + tablename + "`;";
+    Lock writeLock(write_.lock_);
+    Lock readLock(read_.lock_);
+
+    // Cached statements which refer to the table would prevent dropping it
+    finalize(writeLock, write_);
+    finalize(readLock, read_);
 
     if (SQLITE_OK ==
-        sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr)) {
+        sqlite3_exec(write_.db_, sql.c_str(), nullptr, nullptr, nullptr)) {
         return Create(tablename);
     }
 
     return false;
 }
 
+auto StorageSqlite3::reader() const -> Connection&
+{
+    return wal_ ? read_ : write_;
+}
+
+void StorageSqlite3::reset(sqlite3_stmt* statement) const
+{
+    // Bound values refer to memory owned by the caller so they must not
+    // outlive the call which bound them
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
+}
+
 auto StorageSqlite3::Select(
     const std::string& key,
     const std::string& tablename,
     std::string& value) const -> bool
 {
-    sqlite3_stmt* statement{nullptr};
-    const std::string query =
-        "SELECT v FROM '" + tablename + "' WHERE k GLOB ?1;";
-    const auto sql = bind_key(query, key, 1);
-    sqlite3_prepare_v2(db_, sql.c_str(), -1, &statement, nullptr);
-    LogVerbose(OT_METHOD)(__FUNCTION__)(sql).Flush();
+    auto& connection = reader();
+    Lock lock(connection.lock_);
+    auto* statement = prepare(
+        lock, connection, "SELECT v FROM `" + tablename + "` WHERE k = ?1;");
+
+    if (nullptr == statement) { return false; }
+
+    if (SQLITE_OK != sqlite3_bind_text(
+                         statement,
+                         1,
+                         key.data(),
+                         static_cast<int>(key.size()),
+                         SQLITE_STATIC)) {
+        reset(statement);
+
+        return false;
+    }
+
     auto result = sqlite3_step(statement);
     bool success = false;
     std::size_t retry{3};
@@ -220,84 +372,11 @@ auto StorageSqlite3::Select(
         }
     }
 
-    sqlite3_finalize(statement);
+    reset(statement);
 
     return success;
 }
 
-void StorageSqlite3::set_data(std::stringstream& sql) const
-{
-    sqlite3_stmt* data{nullptr};
-    std::stringstream dataSQL{};
-    const std::string tablename{GetTableName(transaction_bucket_.get())};
-    dataSQL << "INSERT OR REPLACE INTO '" << tablename << "' (k, v) VALUES ";
-    std::size_t counter{0};
-    const auto size = pending_.size();
-
-    for (std::size_t i = 0; i < size; ++i) {
-        dataSQL << "(?" << ++counter << ", ?";
-        dataSQL << ++counter << ")";
-
-        if (counter < (2 * size)) {
-            dataSQL << ", ";
-        } else {
-            dataSQL << "; ";
-        }
-    }
-
-    sqlite3_prepare_v2(db_, dataSQL.str().c_str(), -1, &data, nullptr);
-    counter = 0;
-
-    for (const auto& it : pending_) {
-        const auto& key = it.first;
-        const auto& value = it.second;
-        auto bound = sqlite3_bind_text(
-            data, ++counter, key.c_str(), key.size(), SQLITE_STATIC);
-
-        OT_ASSERT(SQLITE_OK == bound);
-
-        bound = sqlite3_bind_blob(
-            data, ++counter, value.c_str(), value.size(), SQLITE_STATIC);
-
-        OT_ASSERT(SQLITE_OK == bound);
-    }
-
-    sql << expand_sql(data) << " ";
-    sqlite3_finalize(data);
-}
-
-void StorageSqlite3::set_root(
-    const std::string& rootHash,
-    std::stringstream& sql) const
-{
-    sqlite3_stmt* root{nullptr};
-    std::stringstream rootSQL{};
-    rootSQL << "INSERT OR REPLACE INTO '" << config_.sqlite3_control_table_
-            << "'  (k, v) VALUES (?1, ?2); ";
-    sqlite3_prepare_v2(db_, rootSQL.str().c_str(), -1, &root, nullptr);
-    auto bound = sqlite3_bind_text(
-        root,
-        1,
-        config_.sqlite3_root_key_.c_str(),
-        config_.sqlite3_root_key_.size(),
-        SQLITE_STATIC);
-
-    OT_ASSERT(SQLITE_OK == bound)
-
-    bound = sqlite3_bind_blob(
-        root, 2, rootHash.c_str(), rootHash.size(), SQLITE_STATIC);
-
-    OT_ASSERT(SQLITE_OK == bound)
-
-    sql << expand_sql(root) << " ";
-    sqlite3_finalize(root);
-}
-
-void StorageSqlite3::start_transaction(std::stringstream& sql) const
-{
-    sql << "BEGIN TRANSACTION; ";
-}
-
 void StorageSqlite3::store(
     const bool isTransaction,
     const std::string& key,
@@ -317,6 +396,44 @@ void StorageSqlite3::store(
     }
 }
 
+void StorageSqlite3::store_batch(const bool bucket, Batch& batch) const
+{
+    auto rows = std::vector<Row>{};
+    rows.reserve(batch.size());
+    Lock lock(transaction_lock_);
+
+    for (const auto& write : batch) {
+        if (write.transaction_) {
+            transaction_bucket_->Set(bucket);
+            pending_.emplace_back(write.key_, write.value_);
+        } else {
+            rows.emplace_back(write.key_, write.value_);
+        }
+    }
+
+    lock.unlock();
+    auto success{true};
+
+    // Every object which is not part of a root transaction is written in a
+    // single transaction instead of one implicit transaction per object
+    if (0 < rows.size()) {
+        Lock statementLock(write_.lock_);
+        success = begin(statementLock) &&
+                  upsert(statementLock, GetTableName(bucket), rows);
+        success = finish(statementLock, success);
+
+        if (false == success) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to store ")(
+                rows.size())(" objects")
+                .Flush();
+        }
+    }
+
+    for (auto& write : batch) {
+        write.promise_->set_value(write.transaction_ || success);
+    }
+}
+
 auto StorageSqlite3::StoreRoot(const bool commit, const std::string& hash) const
     -> bool
 {
@@ -330,23 +447,85 @@ auto StorageSqlite3::StoreRoot(const bool commit, const std::string& hash) const
     }
 }
 
+auto StorageSqlite3::upsert(
+    const Lock& lock,
+    const std::string& tablename,
+    const std::vector<Row>& rows) const -> bool
+{
+    const auto count = rows.size();
+    auto row = std::size_t{0};
+
+    while (row < count) {
+        // Full batches use the multi-row statement and any remaining rows are
+        // written one at a time so only two statements are cached per table
+        const std::size_t size =
+            ((count - row) >= SQLITE3_UPSERT_ROWS) ? SQLITE3_UPSERT_ROWS : 1;
+        auto* statement = prepare(lock, write_, upsert_sql(tablename, size));
+
+        if (nullptr == statement) { return false; }
+
+        auto bound{true};
+        auto parameter = int{0};
+
+        for (const auto last = row + size; row < last; ++row) {
+            const auto& [key, value] = rows.at(row);
+            bound &=
+                (SQLITE_OK == sqlite3_bind_text(
+                                  statement,
+                                  ++parameter,
+                                  key.data(),
+                                  static_cast<int>(key.size()),
+                                  SQLITE_STATIC));
+            bound &=
+                (SQLITE_OK == sqlite3_bind_blob(
+                                  statement,
+                                  ++parameter,
+                                  value.data(),
+                                  static_cast<int>(value.size()),
+                                  SQLITE_STATIC));
+        }
+
+        const auto result = bound ? sqlite3_step(statement) : SQLITE_MISUSE;
+        reset(statement);
+
+        if (SQLITE_DONE != result) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to write to table ")(
+                tablename)(": ")(sqlite3_errmsg(write_.db_))
+                .Flush();
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
 auto StorageSqlite3::Upsert(
     const std::string& key,
     const std::string& tablename,
     const std::string& value) const -> bool
 {
-    sqlite3_stmt* statement;
-    const std::string query =
-        "insert or replace into `" + tablename + "` (k, v) values (?1, ?2);";
-
-    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr);
-    sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
-    sqlite3_bind_blob(statement, 2, value.c_str(), value.size(), SQLITE_STATIC);
-    LogVerbose(OT_METHOD)(__FUNCTION__)(expand_sql(statement)).Flush();
-    const auto result = sqlite3_step(statement);
-    sqlite3_finalize(statement);
+    Lock lock(write_.lock_);
+
+    return upsert(lock, tablename, {{key, value}});
+}
+
+auto StorageSqlite3::upsert_sql(
+    const std::string& tablename,
+    const std::size_t rows) -> std::string
+{
+    auto sql = std::stringstream{};
+    sql << "INSERT OR REPLACE INTO `" << tablename << "` (k, v) VALUES ";
+
+    for (auto i = std::size_t{0}; i < rows; ++i) {
+        if (0 < i) { sql << ", "; }
+
+        sql << "(?" << ((2 * i) + 1) << ", ?" << ((2 * i) + 2) << ")";
+    }
+
+    sql << ";";
 
-    return (result == SQLITE_DONE);
+    return sql.str();
 }
 
 StorageSqlite3::~StorageSqlite3() { Cleanup_StorageSqlite3(); }
@@ -12,10 +12,12 @@ extern "C" {
 #include <sqlite3.h>
 }
 
+#include <cstddef>
 #include <future>
-#include <iosfwd>
+#include <map>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -64,39 +66,62 @@ public:
 
 private:
     using ot_super = Plugin;
+    // key, value
+    using Row = std::pair<std::string_view, std::string_view>;
+
+    // Prepared statements are reused for the lifetime of the connection and
+    // may only be used by the thread holding lock_
+    struct Connection {
+        sqlite3* db_{nullptr};
+        std::mutex lock_{};
+        std::map<std::string, sqlite3_stmt*> statements_{};
+    };
 
     friend Factory;
 
+    static auto upsert_sql(const std::string& tablename, const std::size_t rows)
+        -> std::string;
+
     std::string folder_;
     mutable std::mutex transaction_lock_;
     mutable OTFlag transaction_bucket_;
     mutable std::vector<std::pair<const std::string, const std::string>>
         pending_;
-    sqlite3* db_{nullptr};
+    mutable Connection write_;
+    // Only opened with write-ahead logging, which lets loads proceed while a
+    // write is in progress. Otherwise loads use write_.
+    mutable Connection read_;
+    bool wal_;
 
-    auto bind_key(
-        const std::string& source,
-        const std::string& key,
-        const std::size_t start) const -> std::string;
-    void commit(std::stringstream& sql) const;
+    auto begin(const Lock& lock) const -> bool;
     auto commit_transaction(const std::string& rootHash) const -> bool;
     auto Create(const std::string& tablename) const -> bool;
-    auto expand_sql(sqlite3_stmt* statement) const -> std::string;
+    auto exec(const Lock& lock, const std::string& sql) const -> bool;
+    void finalize(const Lock& lock, Connection& connection) const;
+    auto finish(const Lock& lock, const bool success) const -> bool;
     auto GetTableName(const bool bucket) const -> std::string;
+    auto prepare(
+        const Lock& lock,
+        Connection& connection,
+        const std::string& sql) const -> sqlite3_stmt*;
+    auto reader() const -> Connection&;
+    void reset(sqlite3_stmt* statement) const;
     auto Select(
         const std::string& key,
         const std::string& tablename,
         std::string& value) const -> bool;
     auto Purge(const std::string& tablename) const -> bool;
-    void set_data(std::stringstream& sql) const;
-    void set_root(const std::string& rootHash, std::stringstream& sql) const;
-    void start_transaction(std::stringstream& sql) const;
     void store(
         const bool isTransaction,
         const std::string& key,
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const final;
+    void store_batch(const bool bucket, Batch& batch) const final;
+    auto upsert(
+        const Lock& lock,
+        const std::string& tablename,
+        const std::vector<Row>& rows) const -> bool;
     auto Upsert(
         const std::string& key,
         const std::string& tablename,
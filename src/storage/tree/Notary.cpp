@@ -7,7 +7,11 @@
 #include "1_Internal.hpp"           // IWYU pragma: associated
 #include "storage/tree/Notary.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <functional>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 #include "opentxs/Pimpl.hpp"
@@ -27,9 +31,9 @@
 #include "storage/Plugin.hpp"
 #include "storage/tree/Node.hpp"
 
-#define STORAGE_NOTARY_VERSION 1
+#define STORAGE_NOTARY_VERSION 2
 #if OT_CASH
-#define STORAGE_MINT_SERIES_VERSION 1
+#define STORAGE_MINT_SERIES_VERSION 2
 #define STORAGE_MINT_SERIES_HASH_VERSION 2
 #define STORAGE_MINT_SPENT_LIST_VERSION 1
 #endif
@@ -37,6 +41,104 @@
 
 namespace opentxs::storage
 {
+#if OT_CASH
+namespace
+{
+// Four probes at sixteen bits per element give a false positive rate of
+// roughly 0.25%
+constexpr auto filter_bits_per_element_ = std::size_t{16};
+constexpr auto filter_probes_ = std::size_t{4};
+constexpr auto filter_minimum_elements_ = std::size_t{4096};
+
+// Version 1 series lists alias each series by its number. Version 2 lists
+// add the position of each segment within the series.
+auto parse_alias(const std::string& alias)
+    -> std::pair<Notary::MintSeries, std::size_t>
+{
+    const auto colon = alias.find(':');
+    const auto series =
+        static_cast<Notary::MintSeries>(std::stoull(alias.substr(0, colon)));
+
+    if (std::string::npos == colon) { return {series, 0u}; }
+
+    return {
+        series,
+        static_cast<std::size_t>(std::stoull(alias.substr(colon + 1u)))};
+}
+
+auto segment_alias(const Notary::MintSeries series, const std::size_t segment)
+    -> std::string
+{
+    return std::to_string(series) + ":" + std::to_string(segment);
+}
+}  // namespace
+
+const std::size_t Notary::spent_segment_size_{1024};
+
+Notary::Filter::Filter(const std::size_t elements) noexcept
+    : count_(0)
+    , bits_(
+          (std::max(elements, filter_minimum_elements_) *
+               filter_bits_per_element_ +
+           63u) /
+          64u)
+{
+}
+
+Notary::SpentIndex::SpentIndex(const std::size_t elements) noexcept
+    : filter_(elements)
+    , spent_()
+    , tail_()
+{
+    spent_.reserve(elements);
+}
+
+auto Notary::Filter::Add(const std::string& key) noexcept -> void
+{
+    const auto hash = std::hash<std::string>{}(key);
+
+    for (auto i = std::size_t{0}; i < filter_probes_; ++i) {
+        const auto position = bit(hash, i);
+        bits_[position / 64u] |= (std::uint64_t{1} << (position % 64u));
+    }
+
+    ++count_;
+}
+
+auto Notary::SpentIndex::Add(const std::string& key) noexcept -> void
+{
+    if (filter_.Full()) {
+        filter_ = Filter{2u * (spent_.size() + 1u)};
+
+        for (const auto& existing : spent_) { filter_.Add(existing); }
+    }
+
+    if (spent_.emplace(key).second) { filter_.Add(key); }
+}
+
+auto Notary::Filter::bit(const std::size_t hash, const std::size_t i)
+    const noexcept -> std::size_t
+{
+    // Kirsch-Mitzenmacher double hashing
+    const auto h1 = std::uint64_t{hash};
+    const auto h2 = ((h1 >> 32u) | (h1 << 32u)) | 1u;
+
+    return static_cast<std::size_t>((h1 + i * h2) % (bits_.size() * 64u));
+}
+
+auto Notary::blank_list(const std::string& unitID, const MintSeries series)
+    const -> proto::SpentTokenList
+{
+    auto output = proto::SpentTokenList{};
+    output.set_version(STORAGE_MINT_SPENT_LIST_VERSION);
+    output.set_notary(id_);
+    output.set_unit(unitID);
+    output.set_series(series);
+
+    return output;
+}
+#endif
+
 Notary::Notary(
     const opentxs::api::storage::Driver& storage,
     const std::string& hash,
@@ -45,6 +147,7 @@ Notary::Notary(
     , id_(id)
 #if OT_CASH
     , mint_map_()
+    , spent_index_()
 #endif
 {
     if (check_hash(hash)) {
@@ -63,16 +166,12 @@ auto Notary::CheckSpent(
     if (key.empty()) { throw std::runtime_error("Invalid token key"); }
 
     Lock lock(write_lock_);
-    const auto list = get_or_create_list(lock, unit.str(), series);
 
-    for (const auto& spent : list.spent()) {
-        if (spent == key) {
-            LogTrace(OT_METHOD)(__FUNCTION__)("Token ")(key)(
-                " is already spent.")
-                .Flush();
+    if (get_index(lock, unit.str(), series).Contains(key)) {
+        LogTrace(OT_METHOD)(__FUNCTION__)("Token ")(key)(" is already spent.")
+            .Flush();
 
-            return true;
-        }
+        return true;
     }
 
     LogTrace(OT_METHOD)(__FUNCTION__)("Token ")(key)(" has never been spent.")
@@ -81,51 +180,76 @@ auto Notary::CheckSpent(
     return false;
 }
 
-auto Notary::create_list(
-    const std::string& unitID,
-    const MintSeries series,
-    std::shared_ptr<proto::SpentTokenList>& output) const -> std::string
+auto Notary::Filter::Contains(const std::string& key) const noexcept -> bool
 {
-    std::string hash{};
-    output.reset(new proto::SpentTokenList);
+    const auto hash = std::hash<std::string>{}(key);
+
+    for (auto i = std::size_t{0}; i < filter_probes_; ++i) {
+        const auto position = bit(hash, i);
+        const auto mask = std::uint64_t{1} << (position % 64u);
 
-    OT_ASSERT(output);
+        if (0 == (bits_[position / 64u] & mask)) { return false; }
+    }
 
-    auto& list = *output;
-    list.set_version(STORAGE_MINT_SPENT_LIST_VERSION);
-    list.set_notary(id_);
-    list.set_unit(unitID);
-    list.set_series(series);
+    return true;
+}
 
-    const auto saved = driver_.StoreProto(list, hash);
+auto Notary::SpentIndex::Contains(const std::string& key) const noexcept
+    -> bool
+{
+    if (false == filter_.Contains(key)) { return false; }
 
-    if (false == saved) {
-        throw std::runtime_error("Failed to create spent token list");
-    }
+    return 0 < spent_.count(key);
+}
 
-    return hash;
+auto Notary::Filter::Full() const noexcept -> bool
+{
+    return ((count_ + 1u) * filter_bits_per_element_) > (bits_.size() * 64u);
 }
 
-auto Notary::get_or_create_list(
+auto Notary::get_index(
     const Lock& lock,
     const std::string& unitID,
-    const MintSeries series) const -> proto::SpentTokenList
+    const MintSeries series) const -> SpentIndex&
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    std::shared_ptr<proto::SpentTokenList> output{};
-    auto& hash = mint_map_[unitID][series];
+    auto& output = spent_index_[unitID][series];
 
-    if (hash.empty()) {
-        hash = create_list(unitID, series, output);
-    } else {
-        driver_.LoadProto(hash, output);
+    if (output) { return *output; }
+
+    auto lists = std::vector<std::shared_ptr<proto::SpentTokenList>>{};
+    auto count = std::size_t{0};
+
+    if (auto unit = mint_map_.find(unitID); mint_map_.end() != unit) {
+        if (auto it = unit->second.find(series); unit->second.end() != it) {
+            for (const auto& hash : it->second) {
+                auto& list = lists.emplace_back();
+                driver_.LoadProto(hash, list);
+
+                if (false == bool(list)) {
+                    throw std::runtime_error("Failed to load spent token list");
+                }
+
+                count += static_cast<std::size_t>(list->spent_size());
+            }
+        }
+    }
+
+    auto index = std::make_unique<SpentIndex>(count);
+
+    for (const auto& list : lists) {
+        for (const auto& key : list->spent()) { index->Add(key); }
     }
 
-    if (false == bool(output)) {
-        throw std::runtime_error("Failed to load spent token list");
+    if (lists.empty()) {
+        index->tail_ = blank_list(unitID, series);
+    } else {
+        index->tail_ = *lists.back();
     }
 
+    output = std::move(index);
+
     return *output;
 }
 #endif
@@ -150,8 +274,12 @@ void Notary::init(const std::string& hash)
         auto& unitMap = mint_map_[it.unit()];
 
         for (const auto& storageHash : it.series()) {
-            const auto series = std::stoul(storageHash.alias());
-            unitMap[series] = storageHash.hash();
+            const auto [series, segment] = parse_alias(storageHash.alias());
+            auto& segments = unitMap[series];
+
+            if (segments.size() <= segment) { segments.resize(segment + 1u); }
+
+            segments.at(segment) = storageHash.hash();
         }
     }
 #endif
@@ -170,16 +298,64 @@ auto Notary::MarkSpent(
     }
 
     Lock lock(write_lock_);
-    auto list = get_or_create_list(lock, unit.str(), series);
-    list.add_spent(key);
+    const auto unitID = unit.str();
+    auto& index = get_index(lock, unitID, series);
 
-    OT_ASSERT(proto::Validate(list, VERBOSE));
+    if (index.Contains(key)) {
+        LogTrace(OT_METHOD)(__FUNCTION__)(": Token ")(key)(
+            " is already marked as spent.")
+            .Flush();
+
+        return true;
+    }
 
-    auto& hash = mint_map_[unit.str()][series];
+    auto& segments = mint_map_[unitID][series];
+    const auto newSegment =
+        segments.empty() ||
+        (spent_segment_size_ <=
+         static_cast<std::size_t>(index.tail_.spent_size()));
+    auto tail = newSegment ? blank_list(unitID, series) : index.tail_;
+    tail.add_spent(key);
+
+    OT_ASSERT(proto::Validate(tail, VERBOSE));
+
+    auto hash = std::string{};
+
+    if (false == driver_.StoreProto(tail, hash)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to store spent token list")
+            .Flush();
+
+        return false;
+    }
+
+    auto previous = std::string{};
+
+    if (newSegment) {
+        segments.emplace_back(std::move(hash));
+    } else {
+        previous.swap(segments.back());
+        segments.back() = std::move(hash);
+    }
+
+    if (false == save(lock)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to save notary").Flush();
+
+        if (newSegment) {
+            segments.pop_back();
+        } else {
+            segments.back().swap(previous);
+        }
+
+        return false;
+    }
+
+    // The index must only reflect tokens which have been persisted
+    index.tail_ = std::move(tail);
+    index.Add(key);
     LogTrace(OT_METHOD)(__FUNCTION__)(": Token ")(key)(" marked as spent.")
         .Flush();
 
-    return driver_.StoreProto(list, hash);
+    return true;
 }
 #endif
 
@@ -195,7 +371,14 @@ auto Notary::save(const Lock& lock) const -> bool
 
     if (false == proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    // Leave root_ pointing at the last saved version if the write fails
+    auto hash = std::string{};
+
+    if (false == driver_.StoreProto(serialized, hash)) { return false; }
+
+    root_ = std::move(hash);
+
+    return true;
 }
 
 auto Notary::serialize() const -> proto::StorageNotary
@@ -211,14 +394,16 @@ auto Notary::serialize() const -> proto::StorageNotary
         series.set_notary(id_);
         series.set_unit(unitID);
 
-        for (const auto& [seriesNumber, hash] : seriesMap) {
-            auto& storageHash = *series.add_series();
-            const auto seriesString = std::to_string(seriesNumber);
-            storageHash.set_version(STORAGE_MINT_SERIES_HASH_VERSION);
-            storageHash.set_itemid(Identifier::Factory(seriesString)->str());
-            storageHash.set_hash(hash);
-            storageHash.set_alias(seriesString);
-            storageHash.set_type(proto::STORAGEHASH_PROTO);
+        for (const auto& [seriesNumber, segments] : seriesMap) {
+            for (auto i = std::size_t{0}; i < segments.size(); ++i) {
+                auto& storageHash = *series.add_series();
+                const auto alias = segment_alias(seriesNumber, i);
+                storageHash.set_version(STORAGE_MINT_SERIES_HASH_VERSION);
+                storageHash.set_itemid(Identifier::Factory(alias)->str());
+                storageHash.set_hash(segments.at(i));
+                storageHash.set_alias(alias);
+                storageHash.set_type(proto::STORAGEHASH_PROTO);
+            }
         }
     }
 #endif
@@ -5,10 +5,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
@@ -63,22 +66,67 @@ public:
 
 private:
     friend Tree;
-    using SeriesMap = std::map<MintSeries, std::string>;
+
+#if OT_CASH
+    // Probabilistic pre-check for the spent token index. A negative result
+    // means the token is definitely not in the set.
+    class Filter
+    {
+    public:
+        auto Add(const std::string& key) noexcept -> void;
+        auto Contains(const std::string& key) const noexcept -> bool;
+        // True if the false positive rate would exceed the design target
+        // after adding another element
+        auto Full() const noexcept -> bool;
+
+        Filter(const std::size_t elements) noexcept;
+
+    private:
+        std::size_t count_;
+        std::vector<std::uint64_t> bits_;
+
+        auto bit(const std::size_t hash, const std::size_t i) const noexcept
+            -> std::size_t;
+    };
+
+    // In-memory view of every spent token in one mint series.
+    //
+    // The tokens are persisted as a sequence of SpentTokenList segments. Only
+    // the last segment is ever rewritten and it is sealed once it reaches
+    // spent_segment_size_ tokens, so the cost of marking a token spent does
+    // not depend on the number of previously spent tokens.
+    struct SpentIndex {
+        Filter filter_;
+        std::unordered_set<std::string> spent_;
+        proto::SpentTokenList tail_;
+
+        auto Add(const std::string& key) noexcept -> void;
+        auto Contains(const std::string& key) const noexcept -> bool;
+
+        SpentIndex(const std::size_t elements) noexcept;
+    };
+
+    using Segments = std::vector<std::string>;
+    using SeriesMap = std::map<MintSeries, Segments>;
     using UnitMap = std::map<std::string, SeriesMap>;
+    using SeriesIndex = std::map<MintSeries, std::unique_ptr<SpentIndex>>;
+    using UnitIndex = std::map<std::string, SeriesIndex>;
+
+    static const std::size_t spent_segment_size_;
+#endif
 
     std::string id_;
 
 #if OT_CASH
     mutable UnitMap mint_map_;
+    mutable UnitIndex spent_index_;
 
-    auto create_list(
-        const std::string& unitID,
-        const MintSeries series,
-        std::shared_ptr<proto::SpentTokenList>& output) const -> std::string;
-    auto get_or_create_list(
+    auto blank_list(const std::string& unitID, const MintSeries series) const
+        -> proto::SpentTokenList;
+    auto get_index(
         const Lock& lock,
         const std::string& unitID,
-        const MintSeries series) const -> proto::SpentTokenList;
+        const MintSeries series) const -> SpentIndex&;
 #endif
     auto save(const Lock& lock) const -> bool final;
     auto serialize() const -> proto::StorageNotary;
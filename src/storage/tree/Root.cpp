@@ -46,6 +46,7 @@ Root::Root(
     , tree_root_()
     , tree_lock_()
     , tree_()
+    , dirty_(false)
 {
     if (check_hash(hash)) {
         init(hash);
@@ -75,6 +76,21 @@ void Root::cleanup() const
     }
 }
 
+auto Root::commit() -> bool
+{
+    Lock lock(write_lock_);
+
+    if (false == dirty_) { return false; }
+
+    const bool saved = save(lock);
+
+    OT_ASSERT(saved);
+
+    dirty_ = false;
+
+    return true;
+}
+
 void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
 {
     Lock lock(write_lock_);
@@ -208,9 +224,9 @@ void Root::save(storage::Tree* tree, const Lock& lock)
     tree_root_ = tree->root_;
     treeLock.unlock();
 
-    const bool saved = save(lock);
-
-    OT_ASSERT(saved);
+    // Every tree editor opened while the storage root is being edited shares
+    // a single root update, which happens when the root editor is released
+    dirty_ = true;
 }
 
 auto Root::Save(const opentxs::api::storage::Driver& to) const -> bool
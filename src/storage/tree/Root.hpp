@@ -62,12 +62,15 @@ private:
     std::string tree_root_;
     mutable std::mutex tree_lock_;
     mutable std::unique_ptr<storage::Tree> tree_;
+    // Set when the tree has changed since the root object was last written
+    bool dirty_;
 
     auto serialize() const -> proto::StorageRoot;
     auto tree() const -> storage::Tree*;
 
     void blank(const VersionNumber version) final;
     void cleanup() const;
+    auto commit() -> bool;
     void collect_garbage(const opentxs::api::storage::Driver* to) const;
     void init(const std::string& hash) final;
     auto save(const Lock& lock, const opentxs::api::storage::Driver& to) const
@@ -8,12 +8,17 @@
 #include "storage/tree/Thread.hpp"  // IWYU pragma: associated
 
 #include <memory>
+#include <set>
+#include <string>
 #include <utility>
 
+#include "opentxs/Pimpl.hpp"
 #include "opentxs/api/storage/Driver.hpp"
+#include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/protobuf/Check.hpp"
+#include "opentxs/protobuf/StorageItemHash.pb.h"
 #include "opentxs/protobuf/StorageThread.pb.h"
 #include "opentxs/protobuf/StorageThreadItem.pb.h"
 #include "opentxs/protobuf/verify/StorageThread.hpp"
@@ -22,12 +27,26 @@
 #include "storage/tree/Mailbox.hpp"
 #include "storage/tree/Node.hpp"
 
+#define STORAGE_THREAD_VERSION 2
+#define STORAGE_THREAD_CHUNK_VERSION 2
+#define STORAGE_THREAD_ITEM_VERSION 1
+#define STORAGE_THREAD_CHUNK_SIZE 1024
+
 #define OT_METHOD "opentxs::storage::Thread::"
 
 namespace opentxs
 {
 namespace storage
 {
+const std::size_t Thread::chunk_size_{STORAGE_THREAD_CHUNK_SIZE};
+
+Thread::Chunk::Chunk() noexcept
+    : hash_(Node::BLANK_HASH)
+    , dirty_(true)
+    , items_()
+{
+}
+
 Thread::Thread(
     const opentxs::api::storage::Driver& storage,
     const std::string& id,
@@ -43,11 +62,12 @@ Thread::Thread(
     , mail_outbox_(mailOutbox)
     , items_()
     , participants_()
+    , chunks_()
 {
     if (check_hash(hash)) {
         init(hash);
     } else {
-        blank(1);
+        blank(STORAGE_THREAD_VERSION);
     }
 }
 
@@ -65,8 +85,9 @@ Thread::Thread(
     , mail_outbox_(mailOutbox)
     , items_()
     , participants_(participants)
+    , chunks_()
 {
-    blank(1);
+    blank(STORAGE_THREAD_VERSION);
 }
 
 auto Thread::Add(
@@ -114,7 +135,10 @@ auto Thread::Add(
     }
 
     auto& item = items_[id];
-    item.set_version(version_);
+
+    if (item.has_id()) { unindex_item(lock, item); }
+
+    item.set_version(STORAGE_THREAD_ITEM_VERSION);
     item.set_id(id);
 
     if (0 == index) {
@@ -141,6 +165,8 @@ auto Thread::Add(
         return false;
     }
 
+    index_item(lock, item);
+
     return save(lock);
 }
 
@@ -151,6 +177,43 @@ auto Thread::Alias() const -> std::string
     return alias_;
 }
 
+auto Thread::chunk_number(const proto::StorageThreadItem& item)
+    -> std::size_t
+{
+    return static_cast<std::size_t>(item.index() / chunk_size_);
+}
+
+auto Thread::header(const Lock& lock) const -> proto::StorageThread
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    proto::StorageThread serialized;
+    serialized.set_version(version_);
+    serialized.set_id(id_);
+
+    for (const auto& nym : participants_) {
+        if (!nym.empty()) { *serialized.add_participant() = nym; }
+    }
+
+    return serialized;
+}
+
+auto Thread::index_item(const Lock& lock, const proto::StorageThreadItem& item)
+    -> std::size_t
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    const auto number = chunk_number(item);
+
+    if (item.id().empty()) { return number; }
+
+    auto& chunk = chunks_[number];
+    chunk.items_.emplace(sort_key(item), &item);
+    chunk.dirty_ = true;
+
+    return number;
+}
+
 void Thread::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageThread> serialized;
@@ -163,20 +226,50 @@ void Thread::init(const std::string& hash)
         OT_FAIL;
     }
 
-    init_version(1, *serialized);
+    Lock lock(write_lock_);
+    init_version(STORAGE_THREAD_VERSION, *serialized);
 
     for (const auto& participant : serialized->participant()) {
         participants_.emplace(participant);
     }
 
-    for (const auto& it : serialized->item()) {
-        const auto& index = it.index();
-        items_.emplace(it.id(), it);
+    // Version 1 threads store every item in the index. These items are
+    // written to chunks the next time the thread is saved.
+    for (const auto& item : serialized->item()) { load_item(lock, item); }
+
+    for (const auto& stored : serialized->chunk()) {
+        std::shared_ptr<proto::StorageThread> items;
 
-        if (index >= index_) { index_ = index + 1; }
+        if (false == driver_.LoadProto(stored.hash(), items)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to load thread chunk ")(stored.alias())
+                .Flush();
+            OT_FAIL;
+        }
+
+        auto numbers = std::set<std::size_t>{};
+
+        for (const auto& item : items->item()) {
+            numbers.emplace(load_item(lock, item));
+        }
+
+        // A stored chunk only remains valid if all of its items still belong
+        // to the same chunk and no other stored chunk contributed items to
+        // it, whether listed before it (checked here) or after it (which
+        // marks the chunk dirty again when those items are indexed)
+        if (1 == numbers.size()) {
+            auto& chunk = chunks_.at(*numbers.begin());
+            const auto complete =
+                chunk.items_.size() ==
+                static_cast<std::size_t>(items->item_size());
+
+            if ((Node::BLANK_HASH == chunk.hash_) && complete) {
+                chunk.hash_ = stored.hash();
+                chunk.dirty_ = false;
+            }
+        }
     }
 
-    Lock lock(write_lock_);
     upgrade(lock);
 }
 
@@ -189,6 +282,19 @@ auto Thread::Check(const std::string& id) const -> bool
 
 auto Thread::ID() const -> std::string { return id_; }
 
+auto Thread::Item(const std::string& id, proto::StorageThreadItem& output)
+    const -> bool
+{
+    Lock lock(write_lock_);
+    const auto it = items_.find(id);
+
+    if (items_.end() == it) { return false; }
+
+    output = it->second;
+
+    return true;
+}
+
 auto Thread::Items() const -> proto::StorageThread
 {
     Lock lock(write_lock_);
@@ -196,9 +302,44 @@ auto Thread::Items() const -> proto::StorageThread
     return serialize(lock);
 }
 
+auto Thread::load_item(const Lock& lock, const proto::StorageThreadItem& item)
+    -> std::size_t
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    const auto& index = item.index();
+    const auto [it, added] = items_.emplace(item.id(), item);
+
+    if (index >= index_) { index_ = index + 1; }
+
+    if (false == added) { return chunk_number(it->second); }
+
+    return index_item(lock, it->second);
+}
+
+void Thread::mark_dirty(const Lock& lock, const proto::StorageThreadItem& item)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto it = chunks_.find(chunk_number(item));
+
+    if (chunks_.end() != it) { it->second.dirty_ = true; }
+}
+
 auto Thread::Migrate(const opentxs::api::storage::Driver& to) const -> bool
 {
-    return Node::migrate(root_, to);
+    if (false == check_hash(root_)) { return true; }
+
+    auto output = Node::migrate(root_, to);
+    std::shared_ptr<proto::StorageThread> serialized;
+
+    if (false == driver_.LoadProto(root_, serialized, true)) { return false; }
+
+    for (const auto& hash : serialized->chunk()) {
+        output &= Node::migrate(hash.hash(), to);
+    }
+
+    return output;
 }
 
 auto Thread::Read(const std::string& id, const bool unread) -> bool
@@ -216,6 +357,7 @@ auto Thread::Read(const std::string& id, const bool unread) -> bool
     auto& item = it->second;
 
     item.set_unread(unread);
+    mark_dirty(lock, item);
 
     return save(lock);
 }
@@ -230,6 +372,7 @@ auto Thread::Remove(const std::string& id) -> bool
 
     auto& item = it->second;
     auto box = static_cast<StorageBox>(item.box());
+    unindex_item(lock, item);
     items_.erase(it);
 
     switch (box) {
@@ -261,6 +404,9 @@ auto Thread::Rename(const std::string& newID) -> bool
         participants_.emplace(newID);
     }
 
+    // Every chunk repeats the thread id and participants
+    for (auto& [number, chunk] : chunks_) { chunk.dirty_ = true; }
+
     return save(lock);
 }
 
@@ -268,7 +414,43 @@ auto Thread::save(const Lock& lock) const -> bool
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    auto serialized = serialize(lock);
+    auto serialized = header(lock);
+
+    for (auto it = chunks_.begin(); it != chunks_.end();) {
+        auto& [number, chunk] = *it;
+
+        if (chunk.items_.empty()) {
+            it = chunks_.erase(it);
+
+            continue;
+        }
+
+        if (chunk.dirty_) {
+            auto items = header(lock);
+
+            for (const auto& [key, item] : chunk.items_) {
+                OT_ASSERT(nullptr != item);
+
+                *items.add_item() = *item;
+            }
+
+            if (!proto::Validate(items, VERBOSE)) { return false; }
+
+            if (!driver_.StoreProto(items, chunk.hash_)) { return false; }
+
+            chunk.dirty_ = false;
+        }
+
+        const auto alias = std::to_string(number);
+        auto& hash = *serialized.add_chunk();
+        set_hash(
+            STORAGE_THREAD_CHUNK_VERSION,
+            Identifier::Factory(alias)->str(),
+            chunk.hash_,
+            hash);
+        hash.set_alias(alias);
+        ++it;
+    }
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
@@ -279,21 +461,16 @@ auto Thread::serialize(const Lock& lock) const -> proto::StorageThread
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    proto::StorageThread serialized;
-    serialized.set_version(version_);
-    serialized.set_id(id_);
+    auto serialized = header(lock);
 
-    for (const auto& nym : participants_) {
-        if (!nym.empty()) { *serialized.add_participant() = nym; }
-    }
-
-    auto sorted = sort(lock);
+    // Chunks cover consecutive index ranges so iterating them in order yields
+    // every item in sorted order
+    for (const auto& [number, chunk] : chunks_) {
+        for (const auto& [key, item] : chunk.items_) {
+            OT_ASSERT(nullptr != item);
 
-    for (const auto& it : sorted) {
-        OT_ASSERT(nullptr != it.second);
-
-        const auto& item = *it.second;
-        *serialized.add_item() = item;
+            *serialized.add_item() = *item;
+        }
     }
 
     return serialized;
@@ -308,23 +485,24 @@ auto Thread::SetAlias(const std::string& alias) -> bool
     return true;
 }
 
-auto Thread::sort(const Lock& lock) const -> Thread::SortedItems
+auto Thread::sort_key(const proto::StorageThreadItem& item) -> SortKey
 {
-    OT_ASSERT(verify_write_lock(lock));
+    return SortKey{item.index(), item.time(), item.id()};
+}
 
-    SortedItems output;
+void Thread::unindex_item(
+    const Lock& lock,
+    const proto::StorageThreadItem& item)
+{
+    OT_ASSERT(verify_write_lock(lock));
 
-    for (const auto& it : items_) {
-        const auto& id = it.first;
-        const auto& item = it.second;
+    auto it = chunks_.find(chunk_number(item));
 
-        if (!id.empty()) {
-            SortKey key{item.index(), item.time(), id};
-            output.emplace(key, &item);
-        }
-    }
+    if (chunks_.end() == it) { return; }
 
-    return output;
+    auto& chunk = it->second;
+    chunk.items_.erase(sort_key(item));
+    chunk.dirty_ = true;
 }
 
 auto Thread::UnreadCount() const -> std::size_t
@@ -355,6 +533,7 @@ void Thread::upgrade(const Lock& lock)
             case StorageBox::MAILOUTBOX: {
                 if (item.unread()) {
                     item.set_unread(false);
+                    mark_dirty(lock, item);
                     changed = true;
                 }
             } break;
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <list>
@@ -48,6 +49,20 @@ private:
     using SortKey = std::tuple<std::size_t, std::int64_t, std::string>;
     using SortedItems = std::map<SortKey, const proto::StorageThreadItem*>;
 
+    // Items are stored in chunks covering a fixed range of item indices so
+    // that a change only rewrites the chunk which contains the item. New
+    // items receive the next index and therefore always land in the last
+    // chunk.
+    struct Chunk {
+        std::string hash_;
+        bool dirty_;
+        SortedItems items_;
+
+        Chunk() noexcept;
+    };
+
+    static const std::size_t chunk_size_;
+
     std::string id_;
     std::string alias_;
     std::size_t index_;
@@ -57,11 +72,22 @@ private:
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
     std::set<std::string> participants_;
+    mutable std::map<std::size_t, Chunk> chunks_;
+
+    static auto chunk_number(const proto::StorageThreadItem& item)
+        -> std::size_t;
+    static auto sort_key(const proto::StorageThreadItem& item) -> SortKey;
 
+    auto header(const Lock& lock) const -> proto::StorageThread;
+    auto index_item(const Lock& lock, const proto::StorageThreadItem& item)
+        -> std::size_t;
     void init(const std::string& hash) final;
+    auto load_item(const Lock& lock, const proto::StorageThreadItem& item)
+        -> std::size_t;
+    void mark_dirty(const Lock& lock, const proto::StorageThreadItem& item);
     auto save(const Lock& lock) const -> bool final;
     auto serialize(const Lock& lock) const -> proto::StorageThread;
-    auto sort(const Lock& lock) const -> SortedItems;
+    void unindex_item(const Lock& lock, const proto::StorageThreadItem& item);
     void upgrade(const Lock& lock);
 
     Thread(
@@ -87,6 +113,8 @@ public:
     auto Alias() const -> std::string;
     auto Check(const std::string& id) const -> bool;
     auto ID() const -> std::string;
+    auto Item(const std::string& id, proto::StorageThreadItem& output) const
+        -> bool;
     auto Items() const -> proto::StorageThread;
     auto Migrate(const opentxs::api::storage::Driver& to) const -> bool final;
     auto UnreadCount() const -> std::size_t;
@@ -202,6 +202,8 @@ void ActivitySummary::process_thread(const std::string& id) noexcept
 
     OT_ASSERT(thread);
 
+    if (0 == thread->item_size()) { return; }
+
     auto custom = CustomData{};
     const auto name = display_name(*thread);
     const auto time = Time(
@@ -214,10 +216,17 @@ void ActivitySummary::process_thread(
     const network::zeromq::Message& message) noexcept
 {
     wait_for_startup();
+    const auto body = message.Body();
+
+    OT_ASSERT(0 < body.size());
 
-    OT_ASSERT(1 == message.Body().size());
+    // Rows do not show read state so there is nothing to update
+    if ((1 < body.size()) && (sizeof(ThreadUpdate) == body.at(1).size()) &&
+        (ThreadUpdate::Changed == body.at(1).as<ThreadUpdate>())) {
+        return;
+    }
 
-    const std::string id(*message.Body().begin());
+    const std::string id(body.at(0));
     const auto threadID = Identifier::Factory(id);
 
     OT_ASSERT(false == threadID->empty())
@@ -225,6 +234,9 @@ void ActivitySummary::process_thread(
     if (0 < names_.count(threadID)) {
         Lock lock(lock_);
         delete_item(lock, threadID);
+        lock.unlock();
+        // Not replaced by a new row if every item was removed
+        UpdateNotify();
     }
 
     OT_ASSERT(0 == names_.count(threadID));
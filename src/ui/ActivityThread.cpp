@@ -8,6 +8,7 @@
 #include "ui/ActivityThread.hpp"  // IWYU pragma: associated
 
 #include <chrono>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -506,16 +507,58 @@ void ActivityThread::process_thread(
     const network::zeromq::Message& message) noexcept
 {
     wait_for_startup();
+    const auto body = message.Body();
 
-    OT_ASSERT(1 == message.Body().size());
+    OT_ASSERT(0 < body.size());
 
-    const std::string id(*message.Body().begin());
+    const std::string id(body.at(0));
     const auto threadID = Identifier::Factory(id);
 
     OT_ASSERT(false == threadID->empty())
 
     if (threadID_ != threadID) { return; }
 
+    if (1 == body.size()) {
+        reload_thread();
+
+        return;
+    }
+
+    auto type = ThreadUpdate{};
+
+    try {
+        type = body.at(1).as<ThreadUpdate>();
+    } catch (...) {
+        reload_thread();
+
+        return;
+    }
+
+    for (auto i = std::size_t{2}; i < body.size(); ++i) {
+        const std::string itemID(body.at(i));
+
+        switch (type) {
+            case ThreadUpdate::Added:
+            case ThreadUpdate::Changed: {
+                const auto item = api_.Activity().ThreadItem(
+                    primary_id_, threadID_, api_.Factory().Identifier(itemID));
+
+                if (item) {
+                    process_item(*item);
+                } else {
+                    remove_item(itemID);
+                }
+            } break;
+            case ThreadUpdate::Removed:
+            default: {
+                remove_item(itemID);
+            }
+        }
+    }
+}
+
+void ActivityThread::reload_thread() noexcept
+{
     const auto thread = api_.Activity().Thread(primary_id_, threadID_);
 
     OT_ASSERT(thread)
@@ -534,6 +577,22 @@ void ActivityThread::process_thread(
     delete_inactive(active);
 }
 
+void ActivityThread::remove_item(const std::string& itemID) noexcept
+{
+    Lock lock(lock_);
+    std::vector<ActivityThreadRowID> deleted{};
+
+    for (const auto& [row, key] : names_) {
+        if (std::get<0>(row)->str() == itemID) { deleted.emplace_back(row); }
+    }
+
+    for (const auto& row : deleted) { delete_item(lock, row); }
+
+    lock.unlock();
+
+    if (0 < deleted.size()) { UpdateNotify(); }
+}
+
 auto ActivityThread::same(
     const ActivityThreadRowID& lhs,
     const ActivityThreadRowID& rhs) const noexcept -> bool
@@ -211,6 +211,8 @@ private:
         -> ActivityThreadRowID;
     auto process_drafts() noexcept -> bool;
     void process_thread(const network::zeromq::Message& message) noexcept;
+    void reload_thread() noexcept;
+    void remove_item(const std::string& itemID) noexcept;
     void startup() noexcept;
 
     ActivityThread() = delete;
@@ -19,6 +19,7 @@
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/network/zeromq/socket/Sender.tpp"
+#include "opentxs/network/zeromq/socket/Socket.hpp"
 
 #define OT_METHOD "opentxs::ui::implementation::Widget::"
 
@@ -60,8 +61,9 @@ void Widget::setup_listeners(const ListenerDefinitions& definitions) noexcept
                 [=](const network::zeromq::Message& message) -> void {
                     (*copy)(this, message);
                 }));
-        auto& socket = listeners_.emplace_back(
-            api_.ZeroMQ().SubscribeSocket(nextCallback.get()));
+        auto& socket = listeners_.emplace_back(api_.ZeroMQ().SubscribeSocket(
+            nextCallback.get(),
+            network::zeromq::socket::Socket::Threading::Shared));
         const auto listening = socket->Start(endpoint);
 
         OT_ASSERT(listening)
@@ -9,6 +9,7 @@
 #include "util/LMDB.hpp"  // IWYU pragma: associated
 
 #include <cstddef>
+#include <exception>
 #include <stdexcept>
 
 #include "opentxs/Types.hpp"
@@ -19,6 +20,27 @@
 
 namespace opentxs::storage::lmdb
 {
+constexpr auto max_idle_cursors_ = std::size_t{16};
+constexpr auto max_idle_readers_ = std::size_t{32};
+
+// Innermost snapshot created by the current thread for each database
+thread_local std::map<const LMDB*, const LMDB::Snapshot*> active_snapshots_{};
+
+static auto active_snapshot(const LMDB& parent) noexcept
+    -> const LMDB::Snapshot*
+{
+    const auto it = active_snapshots_.find(&parent);
+
+    if (active_snapshots_.end() == it) { return nullptr; }
+
+    return it->second;
+}
+
+static auto view(const MDB_val& in) noexcept -> ReadView
+{
+    return {static_cast<const char*>(in.mv_data), in.mv_size};
+}
+
 LMDB::LMDB(
     const TableNames& names,
     const std::string& folder,
@@ -29,6 +51,9 @@ LMDB::LMDB(
     , db_(init.size())
     , pending_()
     , lock_()
+    , reader_lock_()
+    , readers_()
+    , cursors_()
 {
     init_environment(folder, init.size(), flags);
     init_tables(init);
@@ -86,6 +111,198 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
 
 LMDB::Transaction::~Transaction() { Finalize(); }
 
+LMDB::Snapshot::Snapshot(const LMDB& parent) noexcept(false)
+    : parent_(parent)
+    , outer_(active_snapshot(parent))
+    , txn_((nullptr == outer_) ? parent_.get_reader() : outer_->txn_)
+    , cursors_()
+{
+    active_snapshots_[&parent_] = this;
+}
+
+LMDB::Snapshot::Iterator::Iterator(
+    MDB_cursor* cursor,
+    const MDB_cursor_op next) noexcept
+    : cursor_(cursor)
+    , next_(next)
+    , current_()
+{
+    if (nullptr != cursor_) { read(MDB_GET_CURRENT); }
+}
+
+LMDB::Snapshot::Iterator::Iterator() noexcept
+    : Iterator(nullptr, MDB_NEXT)
+{
+}
+
+auto LMDB::Snapshot::Iterator::operator++() noexcept -> Iterator&
+{
+    if (nullptr != cursor_) { read(next_); }
+
+    return *this;
+}
+
+auto LMDB::Snapshot::Iterator::read(const MDB_cursor_op op) noexcept -> void
+{
+    auto key = MDB_val{};
+    auto value = MDB_val{};
+
+    if (0 == ::mdb_cursor_get(cursor_, &key, &value, op)) {
+        current_ = {view(key), view(value)};
+    } else {
+        cursor_ = nullptr;
+        current_ = {};
+    }
+}
+
+LMDB::Snapshot::Range::Range(
+    const Snapshot& snapshot,
+    const Table table,
+    const Dir dir,
+    const ReadView start) noexcept(false)
+    : parent_(snapshot.parent_)
+    , table_(table)
+    , dir_(dir)
+    , cursor_(parent_.get_cursor(table, snapshot.txn_))
+    , positioned_(false)
+{
+    const auto requested =
+        MDB_val{start.size(), const_cast<char*>(start.data())};
+    auto key = requested;
+    auto value = MDB_val{};
+
+    if (0 == start.size()) {
+        const auto op = (Dir::Forward == dir_) ? MDB_FIRST : MDB_LAST;
+        positioned_ = 0 == ::mdb_cursor_get(cursor_, &key, &value, op);
+    } else if (Dir::Forward == dir_) {
+        positioned_ =
+            0 == ::mdb_cursor_get(cursor_, &key, &value, MDB_SET_RANGE);
+    } else if (0 == ::mdb_cursor_get(cursor_, &key, &value, MDB_SET_RANGE)) {
+        const auto database = parent_.db_.at(table_);
+
+        if (0 == ::mdb_cmp(snapshot.txn_, database, &key, &requested)) {
+            positioned_ = true;
+        } else {
+            positioned_ =
+                0 == ::mdb_cursor_get(cursor_, &key, &value, MDB_PREV);
+        }
+    } else {
+        positioned_ = 0 == ::mdb_cursor_get(cursor_, &key, &value, MDB_LAST);
+    }
+}
+
+auto LMDB::Snapshot::Range::begin() const noexcept -> Iterator
+{
+    return {
+        positioned_ ? cursor_ : nullptr,
+        (Dir::Forward == dir_) ? MDB_NEXT : MDB_PREV};
+}
+
+LMDB::Snapshot::Range::~Range() { parent_.release_cursor(table_, cursor_); }
+
+auto LMDB::Snapshot::get_cursor(const Table table) const noexcept(false)
+    -> MDB_cursor*
+{
+    auto it = cursors_.find(table);
+
+    if (cursors_.end() != it) { return it->second; }
+
+    auto* output = parent_.get_cursor(table, txn_);
+    cursors_.emplace(table, output);
+
+    return output;
+}
+
+auto LMDB::Snapshot::Exists(const Table table, const ReadView key)
+    const noexcept -> bool
+{
+    return Get(table, key).has_value();
+}
+
+auto LMDB::Snapshot::Get(const Table table, const ReadView index)
+    const noexcept -> std::optional<ReadView>
+{
+    OT_ASSERT(static_cast<std::size_t>(table) < parent_.db_.size());
+
+    const auto database = parent_.db_.at(table);
+    auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
+    auto value = MDB_val{};
+
+    if (0 != ::mdb_get(txn_, database, &key, &value)) { return std::nullopt; }
+
+    return view(value);
+}
+
+auto LMDB::Snapshot::Load(
+    const Table table,
+    const ReadView index,
+    const Callback cb,
+    const Mode mode) const noexcept -> bool
+{
+    try {
+        if (Mode::One == mode) {
+            const auto value = Get(table, index);
+
+            if (false == value.has_value()) { return false; }
+
+            cb(value.value());
+
+            return true;
+        }
+
+        OT_ASSERT(static_cast<std::size_t>(table) < parent_.db_.size());
+
+        auto* cursor = get_cursor(table);
+        auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
+        auto value = MDB_val{};
+
+        if (0 != ::mdb_cursor_get(cursor, &key, &value, MDB_SET)) {
+            return false;
+        }
+
+        ::mdb_cursor_get(cursor, &key, &value, MDB_FIRST_DUP);
+
+        do {
+            if (0 != ::mdb_cursor_get(cursor, &key, &value, MDB_GET_CURRENT)) {
+                return false;
+            }
+
+            cb(view(value));
+        } while (0 == ::mdb_cursor_get(cursor, &key, &value, MDB_NEXT_DUP));
+
+        return true;
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)("Snapshot::")(__FUNCTION__)(": ")(e.what())
+            .Flush();
+
+        return false;
+    }
+}
+
+auto LMDB::Snapshot::Scan(
+    const Table table,
+    const Dir dir,
+    const ReadView start) const noexcept(false) -> Range
+{
+    OT_ASSERT(static_cast<std::size_t>(table) < parent_.db_.size());
+
+    return {*this, table, dir, start};
+}
+
+LMDB::Snapshot::~Snapshot()
+{
+    for (const auto& [table, cursor] : cursors_) {
+        parent_.release_cursor(table, cursor);
+    }
+
+    if (nullptr == outer_) {
+        active_snapshots_.erase(&parent_);
+        parent_.release_reader(txn_);
+    } else {
+        active_snapshots_[&parent_] = outer_;
+    }
+}
+
 auto LMDB::Commit() const noexcept -> bool
 {
     struct Cleanup {
@@ -313,62 +530,70 @@ auto LMDB::Delete(
 auto LMDB::Exists(const Table table, const ReadView index) const noexcept
     -> bool
 {
-    struct Cleanup {
-        bool success_;
+    try {
 
-        Cleanup(MDB_txn*& transaction, MDB_cursor*& cursor)
-            : success_(false)
-            , transaction_(transaction)
-            , cursor_(cursor)
-        {
-        }
+        return ReadSnapshot().Exists(table, index);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
-        ~Cleanup()
-        {
-            if (nullptr != cursor_) {
-                ::mdb_cursor_close(cursor_);
-                cursor_ = nullptr;
-            }
+        return false;
+    }
+}
 
-            if (nullptr != transaction_) {
-                ::mdb_txn_abort(transaction_);
-                transaction_ = nullptr;
-            }
-        }
+auto LMDB::get_cursor(const Table table, MDB_txn* transaction) const
+    noexcept(false) -> MDB_cursor*
+{
+    auto* output = [&]() -> MDB_cursor* {
+        Lock lock(reader_lock_);
+        auto& pool = cursors_[table];
 
-    private:
-        MDB_txn*& transaction_;
-        MDB_cursor*& cursor_;
-    };
+        if (pool.empty()) { return nullptr; }
 
-    OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
+        auto* cursor = pool.back();
+        pool.pop_back();
 
-    MDB_txn* transaction{nullptr};
+        return cursor;
+    }();
 
-    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &transaction)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
-            .Flush();
+    if (nullptr != output) {
+        if (0 == ::mdb_cursor_renew(transaction, output)) { return output; }
 
-        return false;
+        ::mdb_cursor_close(output);
+        output = nullptr;
     }
 
-    OT_ASSERT(nullptr != transaction);
+    if (0 != ::mdb_cursor_open(transaction, db_.at(table), &output)) {
+        throw std::runtime_error("Failed to get cursor");
+    }
 
-    MDB_cursor* cursor{nullptr};
-    Cleanup cleanup(transaction, cursor);
-    const auto database = db_.at(table);
+    return output;
+}
 
-    if (0 != ::mdb_cursor_open(transaction, database, &cursor)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to get cursor").Flush();
+auto LMDB::get_reader() const noexcept(false) -> MDB_txn*
+{
+    auto* output = [&]() -> MDB_txn* {
+        Lock lock(reader_lock_);
 
-        return false;
+        if (readers_.empty()) { return nullptr; }
+
+        auto* transaction = readers_.back();
+        readers_.pop_back();
+
+        return transaction;
+    }();
+
+    if (nullptr != output) {
+        if (0 == ::mdb_txn_renew(output)) { return output; }
+
+        ::mdb_txn_abort(output);
+        output = nullptr;
     }
 
-    auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
-    auto value = MDB_val{};
-    cleanup.success_ = 0 == ::mdb_cursor_get(cursor, &key, &value, MDB_SET);
+    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &output)) {
+        throw std::runtime_error("Failed to start transaction");
+    }
 
-    return cleanup.success_;
+    return output;
 }
 
 auto LMDB::init_db(const Table table, const std::size_t flags) noexcept
@@ -433,85 +658,14 @@ auto LMDB::Load(
     const Callback cb,
     const Mode multiple) const noexcept -> bool
 {
-    struct Cleanup {
-        bool success_;
-
-        Cleanup(MDB_txn*& transaction, MDB_cursor*& cursor)
-            : success_(false)
-            , transaction_(transaction)
-            , cursor_(cursor)
-        {
-        }
-
-        ~Cleanup()
-        {
-            if (nullptr != cursor_) {
-                ::mdb_cursor_close(cursor_);
-                cursor_ = nullptr;
-            }
-
-            if (nullptr != transaction_) {
-                ::mdb_txn_abort(transaction_);
-                transaction_ = nullptr;
-            }
-        }
-
-    private:
-        MDB_txn*& transaction_;
-        MDB_cursor*& cursor_;
-    };
-
-    OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
-
-    MDB_txn* transaction{nullptr};
-
-    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &transaction)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
-            .Flush();
-
-        return false;
-    }
-
-    OT_ASSERT(nullptr != transaction);
-
-    MDB_cursor* cursor{nullptr};
-    Cleanup cleanup(transaction, cursor);
-    const auto database = db_.at(table);
+    try {
 
-    if (0 != ::mdb_cursor_open(transaction, database, &cursor)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to get cursor").Flush();
+        return ReadSnapshot().Load(table, index, cb, multiple);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
         return false;
     }
-
-    auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
-    auto value = MDB_val{};
-    cleanup.success_ = 0 == ::mdb_cursor_get(cursor, &key, &value, MDB_SET);
-
-    if (cleanup.success_) {
-        ::mdb_cursor_get(cursor, &key, &value, MDB_FIRST_DUP);
-
-        if (0 == ::mdb_cursor_get(cursor, &key, &value, MDB_GET_CURRENT)) {
-            cb({static_cast<char*>(value.mv_data), value.mv_size});
-        } else {
-
-            return false;
-        }
-
-        if (static_cast<bool>(multiple)) {
-            while (0 == ::mdb_cursor_get(cursor, &key, &value, MDB_NEXT_DUP)) {
-                if (0 ==
-                    ::mdb_cursor_get(cursor, &key, &value, MDB_GET_CURRENT)) {
-                    cb({static_cast<char*>(value.mv_data), value.mv_size});
-                } else {
-
-                    return false;
-                }
-            }
-        }
-    }
-
-    return cleanup.success_;
 }
 
 auto LMDB::Load(
@@ -544,96 +698,56 @@ auto LMDB::Queue(
 auto LMDB::Read(const Table table, const ReadCallback cb, const Dir dir)
     const noexcept -> bool
 {
-    struct Cleanup {
-        bool success_;
+    try {
+        const auto snapshot = ReadSnapshot();
+        const auto range = snapshot.Scan(table, dir);
+        auto it = range.begin();
 
-        Cleanup(MDB_txn*& transaction, MDB_cursor*& cursor)
-            : success_(false)
-            , transaction_(transaction)
-            , cursor_(cursor)
-        {
-        }
+        if (range.end() == it) { return false; }
 
-        ~Cleanup()
-        {
-            if (nullptr != cursor_) {
-                ::mdb_cursor_close(cursor_);
-                cursor_ = nullptr;
-            }
+        for (; range.end() != it; ++it) {
+            const auto& [key, value] = *it;
 
-            if (nullptr != transaction_) {
-                ::mdb_txn_abort(transaction_);
-                transaction_ = nullptr;
-            }
+            if (false == cb(key, value)) { break; }
         }
-
-    private:
-        MDB_txn*& transaction_;
-        MDB_cursor*& cursor_;
-    };
-
-    OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
-
-    MDB_txn* transaction{nullptr};
-
-    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &transaction)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
-            .Flush();
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
         return false;
     }
 
-    OT_ASSERT(nullptr != transaction);
-
-    MDB_cursor* cursor{nullptr};
-    auto cleanup = Cleanup{transaction, cursor};
-    const auto database = db_.at(table);
-
-    if (0 != ::mdb_cursor_open(transaction, database, &cursor)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to get cursor").Flush();
+    return true;
+}
 
-        return false;
-    }
+auto LMDB::ReadSnapshot() const noexcept(false) -> Snapshot { return {*this}; }
 
-    const auto start =
-        MDB_cursor_op{(Dir::Forward == dir) ? MDB_FIRST : MDB_LAST};
-    const auto next =
-        MDB_cursor_op{(Dir::Forward == dir) ? MDB_NEXT : MDB_PREV};
-    auto again{true};
-    auto key = MDB_val{};
-    auto value = MDB_val{};
-    cleanup.success_ = 0 == ::mdb_cursor_get(cursor, &key, &value, start);
+auto LMDB::release_cursor(const Table table, MDB_cursor* cursor) const noexcept
+    -> void
+{
+    if (nullptr == cursor) { return; }
 
-    try {
-        if (cleanup.success_) {
-            if (0 == ::mdb_cursor_get(cursor, &key, &value, MDB_GET_CURRENT)) {
-                again =
-                    cb({static_cast<char*>(key.mv_data), key.mv_size},
-                       {static_cast<char*>(value.mv_data), value.mv_size});
-            } else {
+    Lock lock(reader_lock_);
+    auto& pool = cursors_[table];
 
-                return false;
-            }
+    if (max_idle_cursors_ > pool.size()) {
+        pool.emplace_back(cursor);
+    } else {
+        ::mdb_cursor_close(cursor);
+    }
+}
 
-            while (again && 0 == ::mdb_cursor_get(cursor, &key, &value, next)) {
-                if (0 ==
-                    ::mdb_cursor_get(cursor, &key, &value, MDB_GET_CURRENT)) {
-                    again =
-                        cb({static_cast<char*>(key.mv_data), key.mv_size},
-                           {static_cast<char*>(value.mv_data), value.mv_size});
-                } else {
+auto LMDB::release_reader(MDB_txn* transaction) const noexcept -> void
+{
+    if (nullptr == transaction) { return; }
 
-                    return false;
-                }
-            }
-        }
-    } catch (const std::exception& e) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+    ::mdb_txn_reset(transaction);
+    Lock lock(reader_lock_);
 
-        return false;
+    if (max_idle_readers_ > readers_.size()) {
+        readers_.emplace_back(transaction);
+    } else {
+        ::mdb_txn_abort(transaction);
     }
-
-    return cleanup.success_;
 }
 
 auto LMDB::Store(
@@ -819,6 +933,16 @@ auto LMDB::TransactionRW() const noexcept(false) -> Transaction
 
 LMDB::~LMDB()
 {
+    for (auto& [table, pool] : cursors_) {
+        for (auto* cursor : pool) { ::mdb_cursor_close(cursor); }
+
+        pool.clear();
+    }
+
+    for (auto* transaction : readers_) { ::mdb_txn_abort(transaction); }
+
+    readers_.clear();
+
     if (nullptr != env_) {
         ::mdb_env_close(env_);
         env_ = nullptr;
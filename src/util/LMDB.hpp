@@ -11,8 +11,10 @@ extern "C" {
 #include <lmdb.h>  // IWYU pragma: export
 }
 
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
+#include <iterator>
 #include <map>
 #include <mutex>
 #include <optional>
@@ -68,6 +70,115 @@ public:
         auto operator=(Transaction &&) -> Transaction& = delete;
     };
 
+    // Read only transaction which can be shared by many lookups
+    //
+    // Transaction handles and cursors are recycled with mdb_txn_reset and
+    // mdb_txn_renew instead of being created and destroyed for every read.
+    // While a snapshot is alive any other snapshot created for the same
+    // database by the same thread shares its transaction, as do Exists, Load
+    // and Read. Views returned by a snapshot are valid until the outermost
+    // snapshot on the thread is destroyed. Snapshots must be destroyed by the
+    // thread which created them.
+    class Snapshot
+    {
+    public:
+        // Single pass iterator over the key/value pairs of a table
+        class Iterator
+        {
+        public:
+            using value_type = std::pair<ReadView, ReadView>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const value_type*;
+            using reference = const value_type&;
+            using iterator_category = std::input_iterator_tag;
+
+            auto operator*() const noexcept -> reference { return current_; }
+            auto operator->() const noexcept -> pointer { return &current_; }
+            auto operator==(const Iterator& rhs) const noexcept -> bool
+            {
+                return cursor_ == rhs.cursor_;
+            }
+            auto operator!=(const Iterator& rhs) const noexcept -> bool
+            {
+                return cursor_ != rhs.cursor_;
+            }
+
+            auto operator++() noexcept -> Iterator&;
+
+            Iterator(MDB_cursor* cursor, const MDB_cursor_op next) noexcept;
+            Iterator() noexcept;
+
+        private:
+            MDB_cursor* cursor_;
+            MDB_cursor_op next_;
+            value_type current_;
+
+            auto read(const MDB_cursor_op op) noexcept -> void;
+        };
+
+        class Range
+        {
+        public:
+            auto begin() const noexcept -> Iterator;
+            auto end() const noexcept -> Iterator { return {}; }
+
+            Range(
+                const Snapshot& snapshot,
+                const Table table,
+                const Dir dir,
+                const ReadView start) noexcept(false);
+            ~Range();
+
+        private:
+            const LMDB& parent_;
+            const Table table_;
+            const Dir dir_;
+            MDB_cursor* cursor_;
+            bool positioned_;
+
+            Range() = delete;
+            Range(const Range&) = delete;
+            Range(Range&&) = delete;
+            auto operator=(const Range&) -> Range& = delete;
+            auto operator=(Range &&) -> Range& = delete;
+        };
+
+        auto Exists(const Table table, const ReadView key) const noexcept
+            -> bool;
+        auto Get(const Table table, const ReadView key) const noexcept
+            -> std::optional<ReadView>;
+        auto Load(
+            const Table table,
+            const ReadView key,
+            const Callback cb,
+            const Mode mode = Mode::One) const noexcept -> bool;
+        // Iterates over the table starting from the first key not less than
+        // start (Dir::Forward) or the last key not greater than start
+        // (Dir::Backward). An empty start begins at the first or last key.
+        auto Scan(
+            const Table table,
+            const Dir dir = Dir::Forward,
+            const ReadView start = {}) const noexcept(false) -> Range;
+
+        Snapshot(const LMDB& parent) noexcept(false);
+        ~Snapshot();
+
+    private:
+        const LMDB& parent_;
+        const Snapshot* const outer_;
+        MDB_txn* const txn_;
+        mutable std::map<Table, MDB_cursor*> cursors_;
+
+        auto get_cursor(const Table table) const noexcept(false)
+            -> MDB_cursor*;
+
+        Snapshot() = delete;
+        Snapshot(const Snapshot&) = delete;
+        Snapshot(Snapshot&&) = delete;
+        auto operator=(const Snapshot&) -> Snapshot& = delete;
+        auto operator=(Snapshot &&) -> Snapshot& = delete;
+    };
+
     auto Commit() const noexcept -> bool;
     auto Delete(const Table table, MDB_txn* parent = nullptr) const noexcept
         -> bool;
@@ -103,6 +214,7 @@ public:
         const Mode mode = Mode::One) const noexcept -> bool;
     auto Read(const Table table, const ReadCallback cb, const Dir dir)
         const noexcept -> bool;
+    auto ReadSnapshot() const noexcept(false) -> Snapshot;
     auto Store(
         const Table table,
         const ReadView key,
@@ -141,8 +253,17 @@ private:
     mutable Databases db_;
     mutable Pending pending_;
     mutable std::mutex lock_;
+    mutable std::mutex reader_lock_;
+    mutable std::vector<MDB_txn*> readers_;
+    mutable std::map<Table, std::vector<MDB_cursor*>> cursors_;
 
+    auto get_cursor(const Table table, MDB_txn* transaction) const
+        noexcept(false) -> MDB_cursor*;
     auto get_database(const Table table) const noexcept -> MDB_dbi;
+    auto get_reader() const noexcept(false) -> MDB_txn*;
+    auto release_cursor(const Table table, MDB_cursor* cursor) const noexcept
+        -> void;
+    auto release_reader(MDB_txn* transaction) const noexcept -> void;
     auto init_db(const Table table, const std::size_t flags) noexcept
         -> MDB_dbi;
     void init_environment(
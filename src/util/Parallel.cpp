@@ -0,0 +1,205 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"       // IWYU pragma: associated
+#include "1_Internal.hpp"     // IWYU pragma: associated
+#include "util/Parallel.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs
+{
+namespace
+{
+class Pool
+{
+public:
+    static auto Get() noexcept -> Pool&
+    {
+        static Pool pool{};
+
+        return pool;
+    }
+    static auto IsWorker() noexcept -> bool { return worker_; }
+
+    auto Post(std::function<void()> task) noexcept -> void
+    {
+        {
+            Lock lock(lock_);
+            tasks_.emplace_back(std::move(task));
+        }
+
+        cv_.notify_one();
+    }
+    auto Threads() const noexcept -> std::size_t
+    {
+        return threads_.size() + 1u;
+    }
+
+    ~Pool()
+    {
+        {
+            Lock lock(lock_);
+            running_ = false;
+        }
+
+        cv_.notify_all();
+
+        for (auto& thread : threads_) { thread.join(); }
+    }
+
+private:
+    static thread_local bool worker_;
+
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool running_;
+    std::vector<std::thread> threads_;
+
+    auto run() noexcept -> void
+    {
+        worker_ = true;
+
+        while (true) {
+            auto task = std::function<void()>{};
+
+            {
+                Lock lock(lock_);
+                cv_.wait(lock, [&] {
+                    return (false == running_) || (false == tasks_.empty());
+                });
+
+                if (false == running_) { return; }
+
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    Pool() noexcept
+        : lock_()
+        , cv_()
+        , tasks_()
+        , running_(true)
+        , threads_()
+    {
+        const auto count = std::max<std::size_t>(
+            std::thread::hardware_concurrency(), std::size_t{1});
+
+        for (auto i = std::size_t{1}; i < count; ++i) {
+            threads_.emplace_back(&Pool::run, this);
+        }
+    }
+    Pool(const Pool&) = delete;
+    Pool(Pool&&) = delete;
+    auto operator=(const Pool&) -> Pool& = delete;
+    auto operator=(Pool&&) -> Pool& = delete;
+};
+
+thread_local bool Pool::worker_{false};
+
+// The job is only referenced while a range is claimed and parallel_batch
+// does not return until every claimed range has completed, so helper tasks
+// which start late never touch it.
+struct Batch {
+    const ParallelBatch& job_;
+    const std::size_t count_;
+    const std::size_t size_;
+    const std::size_t ranges_;
+    std::atomic<std::size_t> next_;
+    std::mutex lock_;
+    std::condition_variable finished_;
+    std::size_t done_;
+    std::exception_ptr error_;
+
+    auto Run() noexcept -> void
+    {
+        for (auto range = next_++; range < ranges_; range = next_++) {
+            const auto first = range * size_;
+            auto error = std::exception_ptr{};
+
+            try {
+                job_(first, std::min(first + size_, count_));
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            Lock lock(lock_);
+
+            if (error && (false == bool(error_))) { error_ = error; }
+
+            if (++done_ == ranges_) { finished_.notify_all(); }
+        }
+    }
+    auto Wait() noexcept -> std::exception_ptr
+    {
+        Lock lock(lock_);
+        finished_.wait(lock, [&] { return done_ == ranges_; });
+
+        return error_;
+    }
+
+    Batch(
+        const ParallelBatch& job,
+        const std::size_t count,
+        const std::size_t size) noexcept
+        : job_(job)
+        , count_(count)
+        , size_(size)
+        , ranges_((count + size - 1u) / size)
+        , next_(0)
+        , lock_()
+        , finished_()
+        , done_(0)
+        , error_()
+    {
+    }
+};
+}  // namespace
+
+auto parallel_batch(
+    const std::size_t count,
+    const ParallelBatch& job,
+    const std::size_t minimum) noexcept(false) -> void
+{
+    if (0u == count) { return; }
+
+    auto& pool = Pool::Get();
+    const auto workers = std::min(
+        pool.Threads(), count / std::max(minimum, std::size_t{1}));
+
+    if ((1u >= workers) || Pool::IsWorker()) {
+        job(0, count);
+
+        return;
+    }
+
+    auto batch =
+        std::make_shared<Batch>(job, count, (count + workers - 1u) / workers);
+
+    for (auto i = std::size_t{1}; i < batch->ranges_; ++i) {
+        pool.Post([batch] { batch->Run(); });
+    }
+
+    batch->Run();
+
+    if (auto error = batch->Wait(); error) { std::rethrow_exception(error); }
+}
+}  // namespace opentxs
@@ -0,0 +1,45 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace opentxs
+{
+using ParallelBatch = std::function<void(std::size_t, std::size_t)>;
+
+// Calls job(first, last) for contiguous ranges which together cover
+// [0, count) and returns once every call has completed.
+//
+// The ranges are run by the calling thread and a process-wide pool of
+// persistent threads. No range is smaller than minimum indices, except the
+// last one, so work which is too small to be worth distributing runs entirely
+// on the calling thread. Calls made from inside a job also run on the calling
+// thread.
+//
+// If any call throws the first exception is rethrown after every range has
+// completed.
+auto parallel_batch(
+    const std::size_t count,
+    const ParallelBatch& job,
+    const std::size_t minimum = 1) noexcept(false) -> void;
+
+// Calls job(i) for every i in [0, count). See parallel_batch.
+template <typename Job>
+auto parallel_for(
+    const std::size_t count,
+    const Job& job,
+    const std::size_t minimum = 1) noexcept(false) -> void
+{
+    parallel_batch(
+        count,
+        [&](const std::size_t first, const std::size_t last) {
+            for (auto i{first}; i < last; ++i) { job(i); }
+        },
+        minimum);
+}
+}  // namespace opentxs
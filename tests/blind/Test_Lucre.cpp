@@ -7,12 +7,17 @@
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "2_Factory.hpp"
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
 #include "internal/api/client/Client.hpp"
+#include "internal/api/server/Server.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
@@ -38,10 +43,14 @@
 #include "opentxs/protobuf/Purse.pb.h"
 #include "opentxs/protobuf/Token.pb.h"
 #include "opentxs/protobuf/verify/Purse.hpp"
+#include "server/Notary.hpp"
+#include "server/Server.hpp"
 
 #define MINT_EXPIRE_MONTHS 6
 #define MINT_VALID_MONTHS 12
 #define REQUEST_PURSE_VALUE 20000
+#define TAMPERED_VALUE 1000
+#define UNKNOWN_SERIES 7
 
 namespace
 {
@@ -427,6 +436,16 @@ TEST_F(Test_Basic, verify)
         EXPECT_TRUE(verified);
     }
 
+    auto tokens = std::vector<const ot::blind::Token*>{};
+
+    for (const auto& token : purse) { tokens.emplace_back(&token); }
+
+    const auto verified = mint.VerifyTokens(bob, tokens, reason_);
+
+    ASSERT_EQ(verified.size(), purse.size());
+
+    for (const auto result : verified) { EXPECT_TRUE(result); }
+
     issue_purse_ = std::move(restored);
 }
 
@@ -490,3 +509,285 @@ TEST_F(Test_Basic, PushPop)
     EXPECT_EQ(purse.Value(), 0);
     EXPECT_EQ(issuePurse.Value(), 0);
 }
+
+namespace opentxs::server
+{
+class Test_Notary : public ::testing::Test
+{
+public:
+    using Tokens = std::vector<std::shared_ptr<blind::Token>>;
+
+    static OTNymID alice_nym_id_;
+    static OTUnitID unit_id_;
+    static std::vector<std::shared_ptr<blind::Mint>> mints_;
+
+    const api::client::internal::Manager& client_;
+    const api::server::internal::Manager& server_;
+    OTPasswordPrompt reason_c_;
+    OTPasswordPrompt reason_s_;
+    Nym_p alice_;
+    Nym_p notary_;
+
+    static auto tokens(blind::Purse& purse) -> Tokens
+    {
+        auto output = Tokens{};
+        auto token = purse.Pop();
+
+        while (token) {
+            output.emplace_back(token);
+            token = purse.Pop();
+        }
+
+        return output;
+    }
+
+    // Saves the series where the notary loads its private mints from
+    auto generate(const std::int32_t series) const
+        -> std::shared_ptr<blind::Mint>
+    {
+        std::shared_ptr<blind::Mint> mint{server_.Factory().Mint(
+            String::Factory(server_.ID().str()),
+            String::Factory(server_.NymID().str()),
+            String::Factory(unit_id_->str()))};
+
+        if (false == bool(mint)) { return {}; }
+
+        const auto now = Clock::now();
+        const std::chrono::seconds expireInterval(
+            std::chrono::hours(MINT_EXPIRE_MONTHS * 30 * 24));
+        const std::chrono::seconds validInterval(
+            std::chrono::hours(MINT_VALID_MONTHS * 30 * 24));
+        mint->GenerateNewMint(
+            server_.Wallet(),
+            series,
+            now,
+            now + validInterval,
+            now + expireInterval,
+            unit_id_,
+            server_.ID(),
+            *notary_,
+            1,
+            10,
+            100,
+            1000,
+            10000,
+            100000,
+            1000000,
+            10000000,
+            100000000,
+            1000000000,
+            OT_MINT_KEY_SIZE_TEST,
+            reason_s_);
+        mint->SetSavePrivateKeys(true);
+        mint->SignContract(*notary_, reason_s_);
+        mint->SaveContract();
+        const auto seriesID = std::string{"."} + std::to_string(series);
+
+        if (false == mint->SaveMint(seriesID.c_str())) { return {}; }
+
+        return mint;
+    }
+    // Returns a purse owned by alice holding tokens signed by the mint
+    auto issue(blind::Mint& mint, const Amount value) const
+        -> std::unique_ptr<blind::Purse>
+    {
+        std::unique_ptr<blind::Purse> request{opentxs::Factory::Purse(
+            client_,
+            *alice_,
+            server_.ID(),
+            *notary_,
+            proto::CASHTYPE_LUCRE,
+            mint,
+            value,
+            reason_c_)};
+
+        if (false == bool(request)) { return {}; }
+
+        std::unique_ptr<blind::Purse> output{
+            opentxs::Factory::Purse(client_, *request, *alice_, reason_c_)};
+
+        if (false == bool(output)) { return {}; }
+
+        if (false == output->AddNym(*notary_, reason_c_)) { return {}; }
+
+        auto token = request->Pop();
+
+        while (token) {
+            if (false == mint.SignToken(*notary_, *token, reason_c_)) {
+                return {};
+            }
+
+            if (false == output->Push(token, reason_c_)) { return {}; }
+
+            token = request->Pop();
+        }
+
+        if (false == output->Process(*alice_, mint, reason_c_)) { return {}; }
+
+        return output;
+    }
+    // Decrypts a deposited purse the same way the notary does
+    auto open(const proto::Purse& serialized) const
+        -> std::unique_ptr<blind::Purse>
+    {
+        auto output = server_.Factory().Purse(serialized);
+
+        if (false == bool(output)) { return {}; }
+
+        if (false == output->Unlock(*notary_, reason_s_)) { return {}; }
+
+        return output;
+    }
+    auto serialize(const Tokens& tokens) const -> proto::Purse
+    {
+        auto purse = client_.Factory().Purse(
+            *alice_, server_.ID(), unit_id_, reason_c_);
+
+        if (false == bool(purse)) { return {}; }
+
+        purse->Unlock(*alice_, reason_c_);
+        purse->AddNym(*notary_, reason_c_);
+
+        for (const auto& token : tokens) { purse->Push(token, reason_c_); }
+
+        return purse->Serialize();
+    }
+    auto verify(const blind::Purse& purse) const -> bool
+    {
+        return server_.Server().GetNotary().verify_tokens(purse);
+    }
+
+    Test_Notary()
+        : client_(dynamic_cast<const api::client::internal::Manager&>(
+              Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , server_(dynamic_cast<const api::server::internal::Manager&>(
+              Context().StartServer(OTTestEnvironment::test_args_, 0, true)))
+        , reason_c_(client_.Factory().PasswordPrompt(__FUNCTION__))
+        , reason_s_(server_.Factory().PasswordPrompt(__FUNCTION__))
+        , alice_()
+        , notary_(server_.Wallet().Nym(server_.NymID()))
+    {
+        if (alice_nym_id_->empty()) {
+            alice_nym_id_ = client_.Wallet().Nym(reason_c_, "Alice")->ID();
+            unit_id_->SetString(Identifier::Random()->str());
+        }
+
+        alice_ = client_.Wallet().Nym(alice_nym_id_);
+    }
+};
+
+OTNymID Test_Notary::alice_nym_id_{identifier::Nym::Factory()};
+OTUnitID Test_Notary::unit_id_{identifier::UnitDefinition::Factory()};
+std::vector<std::shared_ptr<blind::Mint>> Test_Notary::mints_{};
+
+TEST_F(Test_Notary, generateMints)
+{
+    ASSERT_TRUE(alice_);
+    ASSERT_TRUE(notary_);
+
+    for (auto series = std::int32_t{0}; series < 2; ++series) {
+        auto mint = generate(series);
+
+        ASSERT_TRUE(mint);
+        EXPECT_TRUE(server_.GetPrivateMint(unit_id_, series));
+
+        mints_.emplace_back(mint);
+    }
+}
+
+TEST_F(Test_Notary, mixedSeries)
+{
+    ASSERT_EQ(mints_.size(), 2);
+
+    auto first = issue(*mints_.at(0), REQUEST_PURSE_VALUE);
+    auto second = issue(*mints_.at(1), REQUEST_PURSE_VALUE);
+
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+
+    auto input = tokens(*first);
+
+    for (const auto& token : tokens(*second)) { input.emplace_back(token); }
+
+    const auto pPurse = open(serialize(input));
+
+    ASSERT_TRUE(pPurse);
+
+    const auto& purse = *pPurse;
+
+    ASSERT_EQ(purse.size(), 4);
+    EXPECT_EQ(purse.Value(), 2 * REQUEST_PURSE_VALUE);
+
+    const auto verified = purse.VerifyTokens(server_, *notary_, reason_s_);
+
+    ASSERT_EQ(verified.size(), purse.size());
+
+    for (auto i = std::size_t{0}; i < purse.size(); ++i) {
+        EXPECT_TRUE(verified.at(i)) << "series " << purse.at(i).Series();
+    }
+
+    EXPECT_TRUE(verify(purse));
+}
+
+TEST_F(Test_Notary, tamperedToken)
+{
+    ASSERT_FALSE(mints_.empty());
+
+    auto issued = issue(*mints_.at(0), REQUEST_PURSE_VALUE);
+
+    ASSERT_TRUE(issued);
+
+    auto serialized = serialize(tokens(*issued));
+
+    ASSERT_EQ(serialized.token_size(), 2);
+
+    // Claims a denomination other than the one the mint signed
+    auto& token = *serialized.mutable_token(0);
+    serialized.set_totalvalue(
+        serialized.totalvalue() - token.denomination() + TAMPERED_VALUE);
+    token.set_denomination(TAMPERED_VALUE);
+    const auto pPurse = open(serialized);
+
+    ASSERT_TRUE(pPurse);
+
+    const auto& purse = *pPurse;
+    const auto verified = purse.VerifyTokens(server_, *notary_, reason_s_);
+
+    ASSERT_EQ(verified.size(), purse.size());
+
+    for (auto i = std::size_t{0}; i < purse.size(); ++i) {
+        EXPECT_EQ(verified.at(i), TAMPERED_VALUE != purse.at(i).Value());
+    }
+
+    EXPECT_FALSE(verify(purse));
+}
+
+TEST_F(Test_Notary, unknownSeries)
+{
+    ASSERT_FALSE(mints_.empty());
+
+    auto issued = issue(*mints_.at(0), REQUEST_PURSE_VALUE);
+
+    ASSERT_TRUE(issued);
+
+    auto serialized = serialize(tokens(*issued));
+
+    ASSERT_EQ(serialized.token_size(), 2);
+
+    serialized.mutable_token(0)->set_series(UNKNOWN_SERIES);
+    const auto pPurse = open(serialized);
+
+    ASSERT_TRUE(pPurse);
+
+    const auto& purse = *pPurse;
+    const auto verified = purse.VerifyTokens(server_, *notary_, reason_s_);
+
+    ASSERT_EQ(verified.size(), purse.size());
+
+    for (auto i = std::size_t{0}; i < purse.size(); ++i) {
+        EXPECT_EQ(verified.at(i), UNKNOWN_SERIES != purse.at(i).Series());
+    }
+
+    EXPECT_FALSE(verify(purse));
+}
+}  // namespace opentxs::server
@@ -0,0 +1,167 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "api/server/MintSchedule.hpp"
+#include "opentxs/Types.hpp"
+
+namespace
+{
+using MintSchedule = ot::api::server::implementation::MintSchedule;
+using Units = std::vector<std::string>;
+
+const auto short_{std::chrono::milliseconds(50)};
+const auto unit_{std::string{"unit"}};
+const auto other_{std::string{"other"}};
+
+class Test_MintSchedule : public ::testing::Test
+{
+public:
+    std::atomic<bool> enabled_;
+    MintSchedule schedule_;
+    mutable std::size_t lookups_;
+
+    // Series 0 through last exist
+    auto exists(const std::int32_t last) const -> MintSchedule::Exists
+    {
+        return [=](const std::uint32_t series) {
+            ++lookups_;
+
+            return static_cast<std::int32_t>(series) <= last;
+        };
+    }
+    auto wait() -> Units { return schedule_.Wait(ot::Clock::now() + short_); }
+
+    Test_MintSchedule()
+        : enabled_(true)
+        , schedule_([this] { return enabled_.load(); })
+        , lookups_(0)
+    {
+    }
+};
+
+TEST_F(Test_MintSchedule, last_series_none)
+{
+    EXPECT_EQ(schedule_.LastSeries(unit_, exists(-1)), -1);
+    EXPECT_EQ(lookups_, 1u);
+}
+
+TEST_F(Test_MintSchedule, last_series_search)
+{
+    for (const auto last : {0, 1, 2, 3, 36, 63, 64, 65, 1000, 9998}) {
+        const auto id = std::to_string(last);
+        lookups_ = 0;
+
+        EXPECT_EQ(schedule_.LastSeries(id, exists(last)), last);
+        // Exponential search followed by a binary search
+        EXPECT_LE(lookups_, 30u);
+    }
+}
+
+TEST_F(Test_MintSchedule, last_series_limit)
+{
+    EXPECT_EQ(schedule_.LastSeries(unit_, exists(20000)), 9999);
+}
+
+TEST_F(Test_MintSchedule, last_series_cache)
+{
+    EXPECT_EQ(schedule_.LastSeries(unit_, exists(36)), 36);
+
+    lookups_ = 0;
+
+    EXPECT_EQ(schedule_.LastSeries(unit_, exists(36)), 36);
+    EXPECT_EQ(lookups_, 0u);
+
+    schedule_.Record(unit_, 37);
+
+    EXPECT_EQ(schedule_.LastSeries(unit_, exists(36)), 37);
+
+    schedule_.Record(unit_, 5);
+
+    EXPECT_EQ(schedule_.LastSeries(unit_, exists(36)), 37);
+    EXPECT_EQ(lookups_, 0u);
+}
+
+TEST_F(Test_MintSchedule, record_before_search)
+{
+    schedule_.Record(unit_, 4);
+
+    EXPECT_EQ(schedule_.LastSeries(unit_, exists(36)), 4);
+    EXPECT_EQ(lookups_, 0u);
+}
+
+TEST_F(Test_MintSchedule, queue)
+{
+    schedule_.Queue(unit_);
+    schedule_.Queue(other_);
+    schedule_.Queue(unit_);
+
+    EXPECT_EQ(wait(), Units({unit_, other_}));
+    EXPECT_EQ(wait(), Units{});
+}
+
+TEST_F(Test_MintSchedule, disabled)
+{
+    enabled_ = false;
+    schedule_.Queue(unit_);
+
+    EXPECT_EQ(wait(), Units{});
+
+    enabled_ = true;
+
+    EXPECT_EQ(wait(), Units({unit_}));
+}
+
+TEST_F(Test_MintSchedule, rotation)
+{
+    schedule_.Schedule(unit_, ot::Clock::now() - std::chrono::seconds(1));
+    schedule_.Schedule(other_, ot::Clock::now() + (4 * short_));
+
+    EXPECT_EQ(wait(), Units({unit_}));
+    EXPECT_EQ(wait(), Units{});
+    EXPECT_EQ(schedule_.Wait(ot::Clock::now() + (8 * short_)), Units({other_}));
+    EXPECT_EQ(wait(), Units{});
+}
+
+TEST_F(Test_MintSchedule, reschedule)
+{
+    schedule_.Schedule(unit_, ot::Clock::now());
+    schedule_.Schedule(unit_, ot::Clock::now() + std::chrono::hours(1));
+
+    EXPECT_EQ(wait(), Units{});
+}
+
+TEST_F(Test_MintSchedule, retry)
+{
+    schedule_.Queue(unit_);
+
+    ASSERT_EQ(wait(), Units({unit_}));
+
+    // A request which arrives while the unit is being checked must survive
+    // the unit's check failing and being scheduled for a retry
+    schedule_.Queue(unit_);
+    schedule_.Schedule(unit_, ot::Clock::now() + std::chrono::hours(1));
+
+    EXPECT_EQ(wait(), Units({unit_}));
+}
+
+TEST_F(Test_MintSchedule, stop)
+{
+    schedule_.Queue(unit_);
+    schedule_.Stop();
+
+    EXPECT_EQ(schedule_.Wait(), Units{});
+}
+}  // namespace
@@ -0,0 +1,162 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/identifier/Server.hpp"
+#include "opentxs/core/identifier/UnitDefinition.hpp"
+#include "opentxs/protobuf/BlindedSeriesList.pb.h"
+#include "opentxs/protobuf/Check.hpp"
+#include "opentxs/protobuf/StorageEnums.pb.h"
+#include "opentxs/protobuf/StorageItemHash.pb.h"
+#include "opentxs/protobuf/verify/BlindedSeriesList.hpp"
+
+namespace
+{
+constexpr auto batch_size_{std::size_t{1000}};
+// Enough tokens to fill several spent token list segments
+constexpr auto batches_{std::size_t{3}};
+constexpr auto series_{std::uint64_t{0}};
+
+class Test_SpentTokens : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    const ot::OTServerID notary_;
+    const ot::OTUnitID unit_;
+
+    auto random_tokens() const -> std::vector<std::string>
+    {
+        auto output = std::vector<std::string>{};
+        output.reserve(batch_size_);
+
+        for (auto i = std::size_t{0}; i < batch_size_; ++i) {
+            output.emplace_back(ot::Identifier::Random()->str());
+        }
+
+        return output;
+    }
+
+    // Checks and then spends every token in the batch the same way the
+    // notary processes a cash deposit
+    auto deposit(const std::vector<std::string>& tokens) const -> void
+    {
+        const auto& storage = api_.Storage();
+
+        for (const auto& token : tokens) {
+            EXPECT_FALSE(
+                storage.CheckTokenSpent(notary_, unit_, series_, token));
+            EXPECT_TRUE(storage.MarkTokenSpent(notary_, unit_, series_, token));
+        }
+    }
+
+    Test_SpentTokens()
+        : api_(ot::Context().StartClient(OTTestEnvironment::test_args_, 0))
+        , notary_(ot::identifier::Server::Factory(
+              ot::Identifier::Random()->str()))
+        , unit_(ot::identifier::UnitDefinition::Factory(
+              ot::Identifier::Random()->str()))
+    {
+    }
+};
+
+TEST_F(Test_SpentTokens, double_spend)
+{
+    const auto& storage = api_.Storage();
+    const auto tokens = random_tokens();
+
+    deposit(tokens);
+
+    for (const auto& token : tokens) {
+        EXPECT_TRUE(storage.CheckTokenSpent(notary_, unit_, series_, token));
+        EXPECT_FALSE(storage.CheckTokenSpent(
+            notary_, unit_, series_ + 1u, token));
+    }
+
+    for (const auto& token : random_tokens()) {
+        EXPECT_FALSE(storage.CheckTokenSpent(notary_, unit_, series_, token));
+    }
+}
+
+TEST_F(Test_SpentTokens, series_list_versions)
+{
+    const auto entry = [](const std::string& alias) {
+        auto output = ot::proto::StorageItemHash{};
+        output.set_version(2);
+        output.set_itemid(ot::Identifier::Factory(alias)->str());
+        output.set_hash(ot::Identifier::Random()->str());
+        output.set_alias(alias);
+        output.set_type(ot::proto::STORAGEHASH_PROTO);
+
+        return output;
+    };
+    const auto notary = notary_->str();
+    auto list = ot::proto::BlindedSeriesList{};
+    list.set_version(1);
+    list.set_notary(notary);
+    list.set_unit(unit_->str());
+    *list.add_series() = entry("0");
+    *list.add_series() = entry("1");
+
+    EXPECT_TRUE(ot::proto::Validate(list, ot::SILENT, notary));
+
+    // Version 1 holds exactly one spent token list per series
+    *list.add_series() = entry("1");
+
+    EXPECT_FALSE(ot::proto::Validate(list, ot::SILENT, notary));
+
+    list.mutable_series()->RemoveLast();
+    *list.add_series() = entry("2:1");
+
+    EXPECT_FALSE(ot::proto::Validate(list, ot::SILENT, notary));
+
+    list.set_version(2);
+    list.clear_series();
+    *list.add_series() = entry("0:0");
+    *list.add_series() = entry("0:1");
+    *list.add_series() = entry("1:0");
+
+    EXPECT_TRUE(ot::proto::Validate(list, ot::SILENT, notary));
+
+    *list.add_series() = entry("0:1");
+
+    EXPECT_FALSE(ot::proto::Validate(list, ot::SILENT, notary));
+
+    list.mutable_series()->RemoveLast();
+    *list.add_series() = entry("2");
+
+    EXPECT_FALSE(ot::proto::Validate(list, ot::SILENT, notary));
+}
+
+TEST_F(Test_SpentTokens, segments)
+{
+    const auto& storage = api_.Storage();
+    auto batches = std::vector<std::vector<std::string>>{};
+
+    for (auto i = std::size_t{0}; i < batches_; ++i) {
+        deposit(batches.emplace_back(random_tokens()));
+    }
+
+    for (const auto& tokens : batches) {
+        for (const auto& token : tokens) {
+            EXPECT_TRUE(
+                storage.CheckTokenSpent(notary_, unit_, series_, token));
+        }
+    }
+}
+}  // namespace
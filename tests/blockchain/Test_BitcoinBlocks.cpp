@@ -218,4 +218,31 @@ TEST_F(Test_BitcoinBlock, serialization)
         EXPECT_EQ(raw.get(), serialized);
     }
 }
+
+TEST_F(Test_BitcoinBlock, transactions)
+{
+    for (const auto& vector : bip_158_vectors_) {
+        const auto raw = vector.Block(api_);
+        const auto pBlock = api_.Factory().BitcoinBlock(
+            ot::blockchain::Type::Bitcoin_testnet3, raw->Bytes());
+
+        ASSERT_TRUE(pBlock);
+
+        const auto& block = *pBlock;
+
+        ASSERT_LT(0, block.size());
+
+        for (auto i = std::size_t{0}; i < block.size(); ++i) {
+            const auto& pTx = block.at(i);
+
+            ASSERT_TRUE(pTx);
+
+            // Transactions are decoded once, when the block is constructed
+            EXPECT_EQ(pTx.get(), block.at(i).get());
+            EXPECT_EQ(pTx.get(), block.at(pTx->ID().Bytes()).get());
+        }
+
+        EXPECT_EQ(block.CalculateSize(), raw->size());
+    }
+}
 }  // namespace
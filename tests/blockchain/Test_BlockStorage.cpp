@@ -0,0 +1,159 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bip158.hpp"
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/api/client/Client.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/client/Client.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Blockchain.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace fs = boost::filesystem;
+namespace b = ot::blockchain;
+
+namespace
+{
+using BlockPointer = std::shared_ptr<const b::block::bitcoin::Block>;
+
+constexpr auto MiB_ = std::size_t{1024u * 1024u};
+// Offset of the nonce in a serialized block
+constexpr auto nonce_ = std::size_t{76};
+
+class Test_BlockStorage : public ::testing::Test
+{
+public:
+    static constexpr auto keep_ = std::size_t{10};
+    static constexpr auto chain_ = b::Type::Bitcoin_testnet3;
+
+    const ot::api::client::internal::Manager& api_;
+    std::unique_ptr<b::client::internal::Network> network_;
+    b::internal::Database& db_;
+
+    static auto args() -> ot::ArgList
+    {
+        auto output = OTTestEnvironment::test_args_;
+        output[OPENTXS_ARG_BLOCK_FILE_SIZE] = {"1"};
+        output[OPENTXS_ARG_BLOCK_PRUNE] = {std::to_string(keep_)};
+        output[OPENTXS_ARG_BLOCK_STORAGE_LEVEL] = {"2"};
+
+        return output;
+    }
+    // Maintenance runs on a background thread
+    static auto wait(const std::function<bool()>& condition) -> bool
+    {
+        const auto limit =
+            std::chrono::steady_clock::now() + std::chrono::minutes(1);
+
+        while (std::chrono::steady_clock::now() < limit) {
+            if (condition()) { return true; }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        return condition();
+    }
+
+    // Copies of the same block which only differ in the nonce, so each copy
+    // has a unique hash
+    auto block(const std::uint32_t nonce) const -> BlockPointer
+    {
+        auto bytes = ot::space(bip_158_vectors_.at(0).Block(api_)->Bytes());
+        std::memcpy(bytes.data() + nonce_, &nonce, sizeof(nonce));
+
+        return api_.Factory().BitcoinBlock(chain_, ot::reader(bytes));
+    }
+    auto file(const std::size_t number) const -> fs::path
+    {
+        auto name = std::to_string(number);
+
+        while (5 > name.size()) { name.insert(0, 1, '0'); }
+
+        return fs::path{api_.DataFolder()} / "blockchain" / "common" /
+               "blocks" / (std::string{"blk"} + name + ".dat");
+    }
+
+    Test_BlockStorage()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(args(), 0)))
+        , network_(ot::factory::BlockchainNetworkBitcoin(
+              api_,
+              dynamic_cast<const ot::api::client::internal::Blockchain&>(
+                  api_.Blockchain()),
+              chain_,
+              "do not init peers",
+              "inproc://empty"))
+        , db_(network_->DB())
+    {
+    }
+};
+
+TEST_F(Test_BlockStorage, init_opentxs) {}
+
+TEST_F(Test_BlockStorage, minimum_file_size)
+{
+    const auto pBlock = block(0);
+
+    ASSERT_TRUE(pBlock);
+    ASSERT_TRUE(db_.BlockStore(*pBlock));
+
+    const auto loaded = db_.BlockLoadBitcoin(pBlock->ID());
+
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->ID().asHex(), pBlock->ID().asHex());
+    // The configured size of 1 MiB is raised to the minimum
+    EXPECT_EQ(fs::file_size(file(0)), 256u * MiB_);
+}
+
+TEST_F(Test_BlockStorage, prune)
+{
+    constexpr auto count = std::uint32_t{150};
+    auto blocks = std::vector<BlockPointer>{};
+
+    for (auto i = std::uint32_t{1}; i <= count; ++i) {
+        const auto& pBlock = blocks.emplace_back(block(i));
+
+        ASSERT_TRUE(pBlock);
+        ASSERT_TRUE(db_.BlockStore(*pBlock));
+    }
+
+    const auto& oldest = blocks.front()->ID();
+    const auto& newest = blocks.back()->ID();
+
+    EXPECT_TRUE(wait([&] { return false == db_.BlockExists(oldest); }));
+    EXPECT_TRUE(db_.BlockLoadBitcoin(newest));
+
+    auto remaining = std::size_t{0};
+
+    for (const auto& pBlock : blocks) {
+        if (db_.BlockExists(pBlock->ID())) { ++remaining; }
+    }
+
+    EXPECT_GE(remaining, keep_);
+    EXPECT_LT(remaining, std::size_t{count});
+}
+}  // namespace
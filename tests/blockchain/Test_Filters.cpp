@@ -3,16 +3,21 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <boost/multiprecision/cpp_int.hpp>
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -26,11 +31,17 @@
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Context.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Blockchain.hpp"
 #include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/BloomFilter.hpp"
 #include "opentxs/blockchain/client/HeaderOracle.hpp"
 #include "opentxs/core/Data.hpp"
+#include "opentxs/protobuf/Enums.pb.h"
+
+namespace mp = boost::multiprecision;
 
 namespace
 {
@@ -351,6 +362,67 @@ TEST_F(Test_Filters, golomb_coding)
     }
 }
 
+TEST_F(Test_Filters, golomb_coding_long_quotient)
+{
+    const auto P = std::uint8_t{19};
+    auto elements = std::vector<std::uint64_t>{};
+    auto last = std::uint64_t{0};
+
+    for (auto i = std::uint64_t{1}; i < 200; ++i) {
+        last += (i << P) + ((i * 7919u) % (std::uint64_t{1} << P));
+        elements.emplace_back(last);
+    }
+
+    const auto N = static_cast<std::uint32_t>(elements.size());
+    const auto encoded = ot::gcs::GolombEncode(P, elements);
+    const auto decoded = ot::gcs::GolombDecode(N, P, encoded);
+
+    EXPECT_EQ(elements, decoded);
+}
+
+TEST_F(Test_Filters, hashed_set_construct)
+{
+    const auto key = std::string{"0123456789abcdef"};
+    const auto N = std::uint32_t{103};
+    const auto range = std::uint64_t{N} * std::uint64_t{params_.second};
+    auto data = std::vector<std::string>{};
+
+    for (auto i = std::size_t{0}; i < N; ++i) {
+        auto& item = data.emplace_back();
+
+        for (auto j = std::size_t{0}; j < i; ++j) {
+            item.push_back(static_cast<char>((i * 31u) + j));
+        }
+    }
+
+    const auto items = std::vector<ot::ReadView>{data.begin(), data.end()};
+    auto expected = std::vector<std::uint64_t>{};
+
+    // Reference values come from the crypto provider's SipHash-2-4 rather
+    // than from the GCS hashing code under test
+    for (const auto& item : items) {
+        auto hash = std::uint64_t{};
+        auto writer = [&hash](const auto size) -> ot::WritableView {
+            EXPECT_EQ(size, sizeof(hash));
+
+            return {&hash, sizeof(hash)};
+        };
+
+        ASSERT_TRUE(api_.Crypto().Hash().HMAC(
+            ot::proto::HASHTYPE_SIPHASH24, key, item, writer));
+
+        expected.emplace_back(
+            ((mp::uint128_t{hash} * mp::uint128_t{range}) >> 64u)
+                .convert_to<std::uint64_t>());
+    }
+
+    std::sort(expected.begin(), expected.end());
+    const auto hashed =
+        ot::gcs::HashedSetConstruct(api_, key, N, params_.second, items);
+
+    EXPECT_EQ(expected, hashed);
+}
+
 TEST_F(Test_Filters, gcs)
 {
     const auto s1 = std::string{"blah"};
@@ -398,6 +470,20 @@ TEST_F(Test_Filters, gcs)
     for (const auto& match : matches) {
         EXPECT_TRUE((good1 == *match) || (good2 == *match));
     }
+
+    EXPECT_TRUE(gcs.MatchAny(partial));
+    EXPECT_FALSE(gcs.MatchAny({object5->Bytes(), object6->Bytes()}));
+
+    const auto pDecoded = ot::factory::GCS(api_, gcs.Serialize());
+
+    ASSERT_TRUE(pDecoded);
+
+    const auto& decoded = *pDecoded;
+    const auto streamed = decoded.Match(partial);
+
+    EXPECT_EQ(matches, streamed);
+    EXPECT_TRUE(decoded.MatchAny(partial));
+    EXPECT_FALSE(decoded.MatchAny({object5->Bytes(), object6->Bytes()}));
 }
 
 TEST_F(Test_Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
@@ -528,4 +614,84 @@ TEST_F(Test_Filters, hash)
 
     EXPECT_EQ(hash_a.get(), hash_b.get());
 }
+
+TEST_F(Test_Filters, load_filters_snapshot)
+{
+    using Filter = ot::blockchain::client::internal::FilterDatabase::Filter;
+
+    constexpr auto type = ot::blockchain::filter::Type::Basic_BIP158;
+    constexpr auto count = std::size_t{100};
+    const auto network = ot::factory::BlockchainNetworkBitcoin(
+        api_,
+        dynamic_cast<const ot::api::client::internal::Blockchain&>(
+            api_.Blockchain()),
+        ot::blockchain::Type::Bitcoin_testnet3,
+        "do not init peers",
+        "inproc://empty");
+
+    ASSERT_TRUE(network);
+
+    const auto& db = network->DB();
+    const auto key = std::string(16, '\0');
+    const auto a = std::string{"a"};
+    const auto b = std::string{"b"};
+    const auto one = std::vector<ot::OTData>{
+        ot::Data::Factory(a.data(), a.size())};
+    const auto two = std::vector<ot::OTData>{
+        ot::Data::Factory(a.data(), a.size()),
+        ot::Data::Factory(b.data(), b.size())};
+    auto blocks = std::vector<std::string>{};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        auto& hash = blocks.emplace_back(32u, '\0');
+        std::memcpy(hash.data(), &i, sizeof(i));
+    }
+
+    const auto hashes = std::vector<ot::ReadView>{blocks.begin(), blocks.end()};
+    // Every call replaces all the filters in a single write transaction
+    const auto store = [&](const std::vector<ot::OTData>& elements) {
+        auto filters = std::vector<Filter>{};
+
+        for (const auto& hash : hashes) {
+            filters.emplace_back(
+                hash,
+                ot::factory::GCS(
+                    api_, params_.first, params_.second, key, elements));
+        }
+
+        return db.StoreFilters(type, std::move(filters));
+    };
+
+    ASSERT_TRUE(store(one));
+
+    auto running = std::atomic<bool>{true};
+    auto writer = std::thread{[&] {
+        for (auto flip{false}; running; flip = !flip) {
+            EXPECT_TRUE(store(flip ? one : two));
+        }
+    }};
+    auto mixed = std::size_t{0};
+
+    // A batch is read under one snapshot so it must never contain filters
+    // from two different writes
+    for (auto i{0}; i < 200; ++i) {
+        const auto filters = db.LoadFilters(type, hashes);
+        auto elements = std::set<std::uint32_t>{};
+
+        EXPECT_EQ(filters.size(), count);
+
+        for (const auto& pFilter : filters) {
+            EXPECT_TRUE(pFilter);
+
+            if (pFilter) { elements.emplace(pFilter->ElementCount()); }
+        }
+
+        if (1u != elements.size()) { ++mixed; }
+    }
+
+    running = false;
+    writer.join();
+
+    EXPECT_EQ(mixed, 0u);
+}
 }  // namespace
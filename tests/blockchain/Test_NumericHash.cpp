@@ -141,6 +141,13 @@ TEST_F(Test_NumericHash, nBits_4)
 
     EXPECT_EQ(decimal, number->Decimal());
     EXPECT_EQ(hex, number->asHex());
+
+    const auto work = ot::OTWork{ot::factory::Work(number)};
+
+    EXPECT_EQ("16307.42093852398327834", work->Decimal());
+    // Only the integer part of the difficulty is serialized
+    EXPECT_EQ("3fb3", work->asHex());
+    EXPECT_EQ("16307", ot::OTWork{ot::factory::Work("3fb3")}->Decimal());
 }
 
 TEST_F(Test_NumericHash, nBits_5)
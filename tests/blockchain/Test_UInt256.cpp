@@ -0,0 +1,148 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/UInt256.hpp"
+
+namespace b = ot::blockchain;
+namespace mp = boost::multiprecision;
+
+namespace
+{
+using Reference = mp::checked_cpp_int;
+
+constexpr auto iterations_{10000};
+constexpr auto target_one_ = b::UInt256{0xffff} << 208u;
+
+static_assert(b::UInt256{1} == (target_one_.DivMod(target_one_).first));
+static_assert(b::UInt256{} == (b::UInt256{5} - b::UInt256{7}) + b::UInt256{2});
+
+auto random_value(std::mt19937_64& rng) noexcept -> b::UInt256
+{
+    auto limbs = b::UInt256::Limbs{};
+    const auto count = rng() % (limbs.size() + 1u);
+
+    for (auto i = std::size_t{0}; i < count; ++i) { limbs[i] = rng(); }
+
+    return b::UInt256{limbs};
+}
+
+auto reference(const b::UInt256& value) noexcept -> Reference
+{
+    auto output = Reference{};
+
+    for (auto i = std::size_t{4}; i > 0u; --i) {
+        output <<= 64;
+        output |= value.Limb(i - 1u);
+    }
+
+    return output;
+}
+
+auto reference_target(const std::uint32_t nBits) -> Reference
+{
+    const auto exponent = static_cast<int>(nBits >> 24u);
+    const auto mantissa = Reference{nBits & 0x00ffffffu};
+
+    return mantissa << (8 * (exponent - 3));
+}
+
+TEST(UInt256, arithmetic)
+{
+    const Reference modulus = Reference{1} << 256;
+    auto rng = std::mt19937_64{};
+
+    for (auto i{0}; i < 10000; ++i) {
+        const auto lhs = random_value(rng);
+        const auto rhs = random_value(rng);
+        const auto l = reference(lhs);
+        const auto r = reference(rhs);
+        const auto shift = static_cast<std::size_t>(rng() % 300u);
+
+        EXPECT_EQ(reference(lhs + rhs), (l + r) % modulus);
+        EXPECT_EQ(reference(lhs - rhs), (l + modulus - r) % modulus);
+        EXPECT_EQ(lhs < rhs, l < r);
+        EXPECT_EQ(lhs == rhs, l == r);
+        EXPECT_EQ(reference(lhs << shift), (l << shift) % modulus);
+        EXPECT_EQ(reference(lhs >> shift), l >> shift);
+        EXPECT_EQ(lhs.Decimal(), l.str());
+
+        if (false == rhs.IsZero()) {
+            const auto [quotient, remainder] = lhs.DivMod(rhs);
+
+            EXPECT_EQ(reference(quotient), l / r);
+            EXPECT_EQ(reference(remainder), l % r);
+        }
+    }
+}
+
+TEST(UInt256, serialization)
+{
+    auto value = b::UInt256{};
+    const auto bytes = std::string{"\x01\x02", 2};
+
+    EXPECT_TRUE(b::UInt256::FromLittleEndian(bytes, value));
+    EXPECT_EQ(value, b::UInt256{0x0201});
+    EXPECT_TRUE(b::UInt256::FromBigEndian(bytes, value));
+    EXPECT_EQ(value, b::UInt256{0x0102});
+    EXPECT_EQ(value.BigEndian(), (std::vector<std::uint8_t>{0x01, 0x02}));
+    EXPECT_EQ(b::UInt256{}.BigEndian(), std::vector<std::uint8_t>{0x00});
+
+    auto wide = std::string(33, '\0');
+    wide.back() = '\x05';
+
+    EXPECT_TRUE(b::UInt256::FromBigEndian(wide, value));
+    EXPECT_EQ(value, b::UInt256{5});
+
+    wide.front() = '\x01';
+
+    EXPECT_FALSE(b::UInt256::FromBigEndian(wide, value));
+}
+
+TEST(UInt256, difficulty_targets)
+{
+    auto rng = std::mt19937_64{};
+    auto total = b::UInt256{};
+    auto referenceTotal = Reference{};
+    const Reference referenceOne = reference(target_one_);
+    auto previous = b::UInt256{};
+    auto previousReference = Reference{};
+
+    for (auto i{0}; i < iterations_; ++i) {
+        // Targets between difficulty 1 and the current mainnet difficulty
+        const auto exponent = 0x17u + static_cast<std::uint32_t>(rng() % 7u);
+        const auto mantissa = 0x008000u + static_cast<std::uint32_t>(
+                                              rng() % 0x7f0000u);
+        const auto nBits = (exponent << 24u) | mantissa;
+        const auto target = b::UInt256{nBits & 0x00ffffffu}
+                            << (8u * (std::size_t{exponent} - 3u));
+        const auto expected = reference_target(nBits);
+
+        ASSERT_EQ(reference(target), expected);
+        EXPECT_EQ(previous < target, previousReference < expected);
+        EXPECT_EQ(
+            reference(target_one_.DivMod(target).first),
+            referenceOne / expected);
+
+        total = total + target;
+        referenceTotal += expected;
+        previous = target;
+        previousReference = expected;
+    }
+
+    EXPECT_EQ(reference(total), referenceTotal);
+}
+}  // namespace
@@ -19,6 +19,7 @@
 #include "opentxs/SharedPimpl.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Activity.hpp"
 #include "opentxs/api/client/Blockchain.hpp"
 #include "opentxs/api/client/Contacts.hpp"
 #include "opentxs/api/client/Manager.hpp"
@@ -32,6 +33,8 @@
 #include "opentxs/core/PasswordPrompt.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/protobuf/ContactEnums.pb.h"
+#include "opentxs/protobuf/StorageThread.pb.h"
+#include "opentxs/protobuf/StorageThreadItem.pb.h"
 #include "opentxs/ui/AccountActivity.hpp"
 #include "opentxs/ui/AccountList.hpp"
 #include "opentxs/ui/AccountListItem.hpp"
@@ -474,6 +477,110 @@ TEST_F(Test_BlockchainActivity, final_activity_thread_2)
     EXPECT_TRUE(row->Last());
 }
 
+TEST_F(Test_BlockchainActivity, read_state)
+{
+    const auto summary = activity_summary_.updated_.load();
+    const auto thread = api_.Activity().Thread(nym_1_id(), contact_6_id());
+
+    ASSERT_TRUE(thread);
+    ASSERT_EQ(thread->item_size(), 1);
+
+    const auto itemID = api_.Factory().Identifier(thread->item(0).id());
+
+    ASSERT_TRUE(
+        api_.Activity().MarkUnread(nym_1_id(), contact_6_id(), itemID));
+    ASSERT_TRUE(api_.Activity().MarkRead(nym_1_id(), contact_6_id(), itemID));
+
+    // Changed updates must not cause the summary to reload the thread
+    ot::Sleep(std::chrono::seconds(1));
+
+    EXPECT_EQ(activity_summary_.updated_, summary);
+
+    const auto& widget = api_.UI().ActivityThread(nym_1_id(), contact_6_id());
+    auto row = widget.First();
+
+    ASSERT_TRUE(row->Valid());
+    EXPECT_EQ(row->Timestamp(), time_2_);
+    EXPECT_TRUE(row->Last());
+}
+
+TEST_F(Test_BlockchainActivity, remove_thread_item)
+{
+    activity_summary_.expected_ = activity_summary_.updated_ + 1;
+    activity_thread_2_.expected_ = activity_thread_2_.updated_ + 1;
+
+    ASSERT_TRUE(api_.Blockchain().AssignContact(
+        nym_1_id(),
+        account_1_id(),
+        Subchain::External,
+        third_index_,
+        api_.Factory().Identifier()));
+    ASSERT_TRUE(wait_for_counter(activity_thread_2_));
+
+    {
+        const auto& widget =
+            api_.UI().ActivityThread(nym_1_id(), contact_6_id());
+        auto row = widget.First();
+
+        EXPECT_FALSE(row->Valid());
+    }
+
+    ASSERT_TRUE(wait_for_counter(activity_summary_));
+
+    {
+        const auto& widget = api_.UI().ActivitySummary(nym_1_id());
+        auto row = widget.First();
+
+        ASSERT_TRUE(row->Valid());
+        EXPECT_EQ(row->ThreadID(), contact_5_id().str());
+        EXPECT_EQ(row->Timestamp(), time_1_);
+        EXPECT_TRUE(row->Last());
+    }
+}
+
+TEST_F(Test_BlockchainActivity, restore_thread_item)
+{
+    activity_summary_.expected_ = activity_summary_.updated_ + 1;
+    activity_thread_2_.expected_ = activity_thread_2_.updated_ + 1;
+
+    ASSERT_TRUE(api_.Blockchain().AssignContact(
+        nym_1_id(),
+        account_1_id(),
+        Subchain::External,
+        third_index_,
+        contact_6_id()));
+    ASSERT_TRUE(wait_for_counter(activity_thread_2_));
+
+    {
+        const auto& widget =
+            api_.UI().ActivityThread(nym_1_id(), contact_6_id());
+        auto row = widget.First();
+
+        ASSERT_TRUE(row->Valid());
+        EXPECT_EQ(row->Amount(), 1380959);
+        EXPECT_EQ(row->Timestamp(), time_2_);
+        EXPECT_EQ(row->Type(), ot::StorageBox::BLOCKCHAIN);
+        EXPECT_TRUE(row->Last());
+    }
+
+    ASSERT_TRUE(wait_for_counter(activity_summary_));
+
+    {
+        const auto& widget = api_.UI().ActivitySummary(nym_1_id());
+        auto row = widget.First();
+
+        ASSERT_TRUE(row->Valid());
+        EXPECT_EQ(row->ThreadID(), contact_6_id().str());
+        EXPECT_EQ(row->Timestamp(), time_2_);
+        ASSERT_FALSE(row->Last());
+
+        row = widget.Next();
+
+        EXPECT_EQ(row->ThreadID(), contact_5_id().str());
+        EXPECT_TRUE(row->Last());
+    }
+}
+
 // TEST_F(Test_BlockchainActivity, shutdown)
 // {
 //     std::cout << "Waiting for extra events.\n";
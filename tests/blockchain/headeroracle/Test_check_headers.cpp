@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Helpers.hpp"
+#include "internal/api/client/Client.hpp"
+#include "internal/blockchain/client/Client.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/client/HeaderOracle.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+
+namespace
+{
+// Bitcoin block 3 with the last byte of its nonce changed
+const std::string bad_pow_{
+    "01000000bddd99ccfda39da1b108ce1a5d70038d0a967bacb68b6b63065f626a000000"
+    "0044f672226090d85db9a9f2fbfe5f0f9609b387af7be5b7fbb7a1767c831c9e995dbe"
+    "6649ffff001d05e0ed6c"};
+
+// Delivers headers the same way peers do and waits until they are processed
+auto submit(
+    const bc::internal::Network& network,
+    const std::vector<std::string>& headers) -> bool
+{
+    using Promise = std::promise<void>;
+    auto* promise = new Promise{};
+    auto future = promise->get_future();
+    auto work = network.Work(bc::internal::Network::Task::SubmitBlockHeader);
+    work->AddFrame(reinterpret_cast<std::uintptr_t>(promise));
+
+    for (const auto& hex : headers) {
+        work->AddFrame(ot::Data::Factory(hex, ot::Data::Mode::Hex));
+    }
+
+    network.Submit(work);
+
+    return std::future_status::ready ==
+           future.wait_for(std::chrono::seconds(30));
+}
+
+TEST_F(Test_HeaderOracle, init_opentxs) {}
+
+TEST_F(Test_HeaderOracle, reject_insufficient_work)
+{
+    const auto raw = ot::Data::Factory(bad_pow_, ot::Data::Mode::Hex);
+    const auto header = api_.Factory().BlockHeader(type_, raw);
+
+    ASSERT_TRUE(header);
+    EXPECT_FALSE(header->Valid());
+    ASSERT_TRUE(submit(*network_, {bitcoin_.at(0), bitcoin_.at(1), bad_pow_}));
+    EXPECT_FALSE(header_oracle_.LoadHeader(header->Hash()));
+}
+
+TEST_F(Test_HeaderOracle, discard_after_invalid)
+{
+    // The valid copy of block 3 follows the invalid one and would extend the
+    // best chain if it was not discarded
+    ASSERT_TRUE(submit(
+        *network_,
+        {bitcoin_.at(0),
+         bitcoin_.at(1),
+         bad_pow_,
+         bitcoin_.at(2),
+         bitcoin_.at(3)}));
+
+    const auto [height, hash] = header_oracle_.BestChain();
+
+    EXPECT_EQ(height, 2);
+}
+
+TEST_F(Test_HeaderOracle, accept_valid)
+{
+    ASSERT_TRUE(submit(*network_, bitcoin_));
+
+    const auto [height, hash] = header_oracle_.BestChain();
+
+    EXPECT_EQ(height, bitcoin_.size());
+
+    const auto raw = ot::Data::Factory(bitcoin_.back(), ot::Data::Mode::Hex);
+    const auto last = api_.Factory().BlockHeader(type_, raw);
+
+    ASSERT_TRUE(last);
+    EXPECT_EQ(hash->asHex(), last->Hash().asHex());
+}
+}  // namespace
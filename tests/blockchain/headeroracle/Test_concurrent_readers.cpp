@@ -0,0 +1,131 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Helpers.hpp"
+#include "internal/api/client/Client.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/client/HeaderOracle.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using Latency = std::chrono::nanoseconds;
+
+constexpr auto reader_count_{4};
+
+struct Reader {
+    std::vector<Latency> latency_{};
+    bool monotonic_{true};
+    bool consistent_{true};
+};
+
+auto percentile(const std::vector<Latency>& sorted, const double p) noexcept
+    -> Latency
+{
+    if (sorted.empty()) { return {}; }
+
+    const auto index = static_cast<std::size_t>(
+        p * static_cast<double>(sorted.size() - 1u));
+
+    return sorted.at(index);
+}
+}  // namespace
+
+TEST_F(Test_HeaderOracle, init_opentxs) {}
+
+TEST_F(Test_HeaderOracle, concurrent_readers)
+{
+    auto headers = std::vector<std::unique_ptr<bb::Header>>{};
+
+    for (const auto& hex : bitcoin_) {
+        const auto raw = ot::Data::Factory(hex, ot::Data::Mode::Hex);
+        auto pHeader =
+            api_.Factory().BlockHeader(ot::blockchain::Type::Bitcoin, raw);
+
+        ASSERT_TRUE(pHeader);
+
+        headers.emplace_back(std::move(pHeader));
+    }
+
+    auto running = std::atomic<bool>{true};
+    auto readers = std::vector<Reader>(reader_count_);
+    auto threads = std::vector<std::thread>{};
+
+    for (auto& reader : readers) {
+        threads.emplace_back([&] {
+            auto previous = bb::Height{-1};
+
+            while (running) {
+                const auto start = Clock::now();
+                const auto tip = header_oracle_.BestChain();
+                const auto hash = header_oracle_.BestHash(tip.first);
+                const auto found = header_oracle_.IsInBestChain(tip);
+                reader.latency_.emplace_back(Clock::now() - start);
+
+                if (tip.first < previous) { reader.monotonic_ = false; }
+
+                // The chain only grows during this test so a published tip
+                // must remain in the best chain
+                if ((hash != tip.second) || (false == found)) {
+                    reader.consistent_ = false;
+                }
+
+                previous = tip.first;
+            }
+        });
+    }
+
+    for (auto& header : headers) {
+        EXPECT_TRUE(header_oracle_.AddHeader(std::move(header)));
+    }
+
+    running = false;
+
+    for (auto& thread : threads) { thread.join(); }
+
+    auto latency = std::vector<Latency>{};
+
+    for (const auto& reader : readers) {
+        EXPECT_TRUE(reader.monotonic_);
+        EXPECT_TRUE(reader.consistent_);
+        latency.insert(
+            latency.end(), reader.latency_.cbegin(), reader.latency_.cend());
+    }
+
+    ASSERT_FALSE(latency.empty());
+
+    std::sort(latency.begin(), latency.end());
+    std::cout << "Reader threads: " << reader_count_ << '\n'
+              << "Reads: " << latency.size() << '\n'
+              << "p50 latency (ns): " << percentile(latency, 0.5).count()
+              << '\n'
+              << "p99 latency (ns): " << percentile(latency, 0.99).count()
+              << '\n'
+              << "max latency (ns): " << latency.crbegin()->count()
+              << std::endl;
+
+    const auto [height, hash] = header_oracle_.BestChain();
+
+    EXPECT_EQ(height, bitcoin_.size());
+    EXPECT_TRUE(header_oracle_.IsInBestChain(hash));
+}
@@ -6,6 +6,7 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <set>
@@ -220,6 +221,31 @@ TEST_F(Test_NymData, BestSocialMediaProfile)
     EXPECT_STREQ("profile1", profile.c_str());
 }
 
+TEST_F(Test_NymData, CachedLookup)
+{
+    using Clock = std::chrono::steady_clock;
+    const auto& wallet = client_.Wallet();
+    const auto& nym = nymData_.Nym();
+    const auto& id = nym.ID();
+
+    ASSERT_TRUE(wallet.Nym(id));
+
+    auto start = Clock::now();
+
+    for (auto i{0}; i < 10; ++i) { EXPECT_TRUE(nym.VerifyPseudonym()); }
+
+    const auto verify = Clock::now() - start;
+    start = Clock::now();
+
+    // A nym which has already been verified is not verified again until its
+    // revision changes, so these must be much cheaper than verifications
+    for (auto i{0}; i < 200; ++i) { EXPECT_TRUE(wallet.Nym(id)); }
+
+    const auto lookup = Clock::now() - start;
+
+    EXPECT_LT(lookup, verify);
+}
+
 TEST_F(Test_NymData, Claims)
 {
     auto contactData = nymData_.Claims();
@@ -430,6 +456,24 @@ TEST_F(Test_NymData, PrintContactData)
     EXPECT_STREQ(expected.c_str(), text.c_str());
 }
 
+TEST_F(Test_NymData, Revision)
+{
+    const auto& wallet = client_.Wallet();
+    const auto& id = nymData_.Nym().ID();
+    const auto before = nymData_.Nym().Revision();
+
+    ASSERT_TRUE(wallet.Nym(id));
+    EXPECT_TRUE(nymData_.AddEmail("email1", false, false, reason_));
+
+    const auto pNym = wallet.Nym(id);
+
+    // The edit must invalidate the verified revision recorded for the nym
+    ASSERT_TRUE(pNym);
+    EXPECT_GT(pNym->Revision(), before);
+    EXPECT_EQ(pNym->Revision(), nymData_.Nym().Revision());
+    EXPECT_EQ(pNym->BestEmail(), "email1");
+}
+
 TEST_F(Test_NymData, SetContactData)
 {
     const ot::ContactData contactData(
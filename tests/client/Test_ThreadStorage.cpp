@@ -0,0 +1,190 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/api/storage/Storage.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/storage/Storage.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/PasswordPrompt.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/protobuf/StorageEnums.pb.h"
+#include "opentxs/protobuf/StorageThread.pb.h"
+#include "opentxs/protobuf/StorageThreadItem.pb.h"
+
+namespace
+{
+// Large enough for the items to span several storage chunks
+constexpr auto item_count_{std::size_t{2500}};
+constexpr auto batch_size_{std::size_t{500}};
+
+class Test_ThreadStorage : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    const ot::OTPasswordPrompt reason_;
+    const std::string nym_;
+    const std::string thread_;
+    const std::string other_thread_;
+    std::vector<std::string> items_;
+
+    auto add_items(const std::size_t count) -> void
+    {
+        const auto& storage = api_.Storage();
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto& id =
+                items_.emplace_back(ot::Identifier::Random()->str());
+
+            EXPECT_TRUE(storage.Store(
+                nym_,
+                thread_,
+                id,
+                items_.size(),
+                "",
+                "",
+                ot::StorageBox::INCOMINGCHEQUE));
+        }
+    }
+
+    auto load(const std::string& thread) const
+        -> std::shared_ptr<ot::proto::StorageThread>
+    {
+        auto output = std::shared_ptr<ot::proto::StorageThread>{};
+
+        EXPECT_TRUE(api_.Storage().Load(nym_, thread, output));
+
+        return output;
+    }
+
+    Test_ThreadStorage()
+        : api_(ot::Context().StartClient(OTTestEnvironment::test_args_, 0))
+        , reason_(api_.Factory().PasswordPrompt(__FUNCTION__))
+        , nym_(api_.Wallet().Nym(reason_, "Alice")->ID().str())
+        , thread_(ot::Identifier::Random()->str())
+        , other_thread_(ot::Identifier::Random()->str())
+        , items_()
+    {
+        const auto participants =
+            std::set<std::string>{ot::Identifier::Random()->str()};
+        const auto& storage = api_.Storage();
+
+        EXPECT_TRUE(storage.CreateThread(nym_, thread_, participants));
+        EXPECT_TRUE(storage.CreateThread(nym_, other_thread_, participants));
+    }
+};
+
+TEST_F(Test_ThreadStorage, items)
+{
+    const auto& storage = api_.Storage();
+    add_items(item_count_);
+    auto thread = load(thread_);
+
+    ASSERT_TRUE(thread);
+    ASSERT_EQ(thread->item_size(), static_cast<int>(item_count_));
+
+    for (auto i = std::size_t{0}; i < item_count_; ++i) {
+        const auto& item = thread->item(static_cast<int>(i));
+
+        EXPECT_EQ(item.id(), items_.at(i));
+        EXPECT_EQ(item.index(), i);
+        EXPECT_TRUE(item.unread());
+    }
+
+    EXPECT_EQ(storage.UnreadCount(nym_, thread_), item_count_);
+
+    const auto& read = items_.front();
+    const auto& removed = items_.at(item_count_ / 2);
+    const auto& moved = items_.back();
+
+    EXPECT_TRUE(storage.SetReadState(nym_, thread_, read, false));
+    EXPECT_TRUE(storage.RemoveThreadItem(
+        ot::identifier::Nym::Factory(nym_),
+        ot::Identifier::Factory(thread_),
+        removed));
+    EXPECT_TRUE(storage.MoveThreadItem(nym_, thread_, other_thread_, moved));
+    EXPECT_EQ(storage.UnreadCount(nym_, thread_), item_count_ - 3);
+
+    thread = load(thread_);
+
+    ASSERT_TRUE(thread);
+    ASSERT_EQ(thread->item_size(), static_cast<int>(item_count_ - 2));
+    EXPECT_FALSE(thread->item(0).unread());
+
+    for (const auto& item : thread->item()) {
+        EXPECT_NE(item.id(), removed);
+        EXPECT_NE(item.id(), moved);
+    }
+
+    const auto other = load(other_thread_);
+
+    ASSERT_TRUE(other);
+    ASSERT_EQ(other->item_size(), 1);
+    EXPECT_EQ(other->item(0).id(), moved);
+    EXPECT_EQ(other->item(0).index(), item_count_ - 1);
+}
+
+TEST_F(Test_ThreadStorage, root_batching)
+{
+    const auto& storage =
+        dynamic_cast<const ot::api::storage::StorageInternal&>(api_.Storage());
+    add_items(3);
+    auto sequence = storage.Sequence();
+
+    // Removing the item from one thread and adding it to the other modifies
+    // two threads below the same nym but writes the storage root only once
+    EXPECT_TRUE(
+        storage.MoveThreadItem(nym_, thread_, other_thread_, items_[2]));
+    EXPECT_EQ(storage.Sequence(), sequence + 1u);
+
+    sequence = storage.Sequence();
+
+    EXPECT_TRUE(storage.RemoveThreadItem(
+        ot::identifier::Nym::Factory(nym_),
+        ot::Identifier::Factory(thread_),
+        items_[1]));
+    EXPECT_EQ(storage.Sequence(), sequence + 1u);
+
+    sequence = storage.Sequence();
+
+    EXPECT_TRUE(storage.SetReadState(nym_, thread_, items_[0], false));
+    EXPECT_EQ(storage.Sequence(), sequence + 1u);
+}
+
+TEST_F(Test_ThreadStorage, append)
+{
+    const auto& storage = api_.Storage();
+
+    // Each batch extends the last chunk written by the previous one
+    for (auto i = std::size_t{0}; i < (item_count_ / batch_size_); ++i) {
+        add_items(batch_size_);
+        const auto thread = load(thread_);
+        const auto count = items_.size();
+
+        ASSERT_TRUE(thread);
+        ASSERT_EQ(thread->item_size(), static_cast<int>(count));
+        EXPECT_EQ(thread->item(0).id(), items_.front());
+        EXPECT_EQ(
+            thread->item(static_cast<int>(count - 1u)).id(), items_.back());
+        EXPECT_EQ(storage.UnreadCount(nym_, thread_), count);
+    }
+}
+}  // namespace
@@ -0,0 +1,76 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/core/PasswordPrompt.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/protobuf/Nym.pb.h"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+class Test_WalletLookup : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& alice_;
+    const ot::api::client::Manager& bob_;
+    const ot::OTPasswordPrompt reason_;
+
+    Test_WalletLookup()
+        : alice_(ot::Context().StartClient(OTTestEnvironment::test_args_, 0))
+        , bob_(ot::Context().StartClient(OTTestEnvironment::test_args_, 1))
+        , reason_(bob_.Factory().PasswordPrompt(__FUNCTION__))
+    {
+    }
+};
+
+TEST_F(Test_WalletLookup, wake_on_arrival)
+{
+    const auto pBob = bob_.Wallet().Nym(reason_, "Bob");
+
+    ASSERT_TRUE(pBob);
+
+    const auto& id = pBob->ID();
+
+    ASSERT_FALSE(alice_.Wallet().Nym(id));
+
+    auto lookup = std::async(std::launch::async, [&] {
+        auto output = alice_.Wallet().Nym(id, std::chrono::seconds(10));
+
+        return std::make_pair(output, Clock::now());
+    });
+
+    // Delivered shortly after the lookup starts waiting, well before a
+    // waiter which polls the wallet at a fixed interval would check again
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const auto arrived = Clock::now();
+
+    ASSERT_TRUE(alice_.Wallet().Nym(pBob->asPublicNym()));
+
+    const auto [pNym, returned] = lookup.get();
+
+    ASSERT_TRUE(pNym);
+    EXPECT_EQ(pNym->ID().str(), id.str());
+    EXPECT_LT(returned - arrived, std::chrono::milliseconds(50));
+}
+}  // namespace
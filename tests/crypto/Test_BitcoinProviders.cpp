@@ -6,6 +6,7 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
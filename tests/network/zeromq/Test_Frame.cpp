@@ -7,11 +7,14 @@
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
 #include <zmq.h>
+#include <cstddef>
 #include <iosfwd>
 #include <string>
+#include <utility>
 
 #include "2_Factory.hpp"
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Data.hpp"
@@ -84,3 +87,31 @@ TEST(Frame, zmq_msg_t)
     zmq_msg_t* zmq_msg = message.get();
     ASSERT_NE(nullptr, zmq_msg);
 }
+
+TEST(Frame, clone)
+{
+    auto large = std::string(1024, 'a');
+    const OTZMQFrame message{Factory::ZMQFrame(large.data(), large.size())};
+    const auto copy = message;
+
+    ASSERT_EQ(copy->size(), large.size());
+    EXPECT_EQ(copy->data(), message->data());
+    EXPECT_EQ(copy->Bytes(), large);
+}
+
+TEST(Frame, adopt)
+{
+    auto large = Space(1024, std::byte{0x01});
+    const auto* buffer = large.data();
+    const OTZMQFrame message{Factory::ZMQFrame(std::move(large))};
+
+    ASSERT_EQ(message->size(), 1024);
+    EXPECT_EQ(message->data(), buffer);
+
+    auto small = std::string{"testString"};
+    const OTZMQFrame inline_frame{Factory::ZMQFrame(std::move(small))};
+
+    std::string messageString = inline_frame.get();
+
+    EXPECT_EQ(messageString, "testString");
+}
@@ -7,10 +7,13 @@
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
 #include <iosfwd>
+#include <cstddef>
 #include <iterator>
 #include <string>
+#include <utility>
 
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Bytes.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Version.hpp"
@@ -67,6 +70,51 @@ TEST(Message, AddFrame_string)
     ASSERT_STREQ("testString", messageString.c_str());
 }
 
+TEST(Message, AddFrame_Frame)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    const auto& original = multipartMessage->AddFrame(std::string(1024, 'a'));
+    auto copy = network::zeromq::Message::Factory();
+    const auto& shared = copy->AddFrame(original);
+
+    ASSERT_EQ(copy->size(), 1);
+    EXPECT_EQ(shared.size(), original.size());
+    EXPECT_EQ(shared.data(), original.data());
+}
+
+TEST(Message, AddFrame_move)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    auto space = Space(1024, std::byte{0x01});
+    const auto* buffer = space.data();
+    const auto& message = multipartMessage->AddFrame(std::move(space));
+
+    ASSERT_EQ(message.size(), 1024);
+    EXPECT_EQ(message.data(), buffer);
+
+    auto string = std::string(1024, 'b');
+    const auto* text = string.data();
+
+    EXPECT_EQ(multipartMessage->AddFrame(std::move(string)).data(), text);
+
+    auto data = Data::Factory(std::string(1024, 'c').data(), 1024);
+    const auto* bytes = data->data();
+
+    EXPECT_EQ(multipartMessage->AddFrame(std::move(data)).data(), bytes);
+}
+
+TEST(Message, copy)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    multipartMessage->AddFrame(std::string(1024, 'a'));
+    multipartMessage->AddFrame(std::string{"small"});
+    const auto copy = OTZMQMessage{multipartMessage};
+
+    ASSERT_EQ(copy->size(), 2);
+    EXPECT_EQ(copy->at(0).data(), multipartMessage->at(0).data());
+    EXPECT_EQ(copy->at(1).Bytes(), multipartMessage->at(1).Bytes());
+}
+
 TEST(Message, at)
 {
     auto multipartMessage = network::zeromq::Message::Factory();
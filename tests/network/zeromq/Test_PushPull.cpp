@@ -6,9 +6,15 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <ctime>
+#include <fstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
 #include "opentxs/Forward.hpp"
@@ -34,6 +40,20 @@ namespace zmq = ot::network::zeromq;
 
 namespace
 {
+// Returns zero on platforms without procfs
+auto thread_count() -> std::size_t
+{
+    auto status = std::ifstream{"/proc/self/status"};
+    auto line = std::string{};
+
+    while (std::getline(status, line)) {
+        if (0 == line.compare(0, 8, "Threads:")) {
+            return std::stoul(line.substr(8));
+        }
+    }
+
+    return 0;
+}
 
 class Test_PushPull : public ::testing::Test
 {
@@ -50,6 +70,82 @@ public:
         : context_(Context().ZMQ())
     {
     }
+
+    void receive_all(const zmq::socket::Socket::Threading threading)
+    {
+        constexpr auto count = std::size_t{200};
+        auto received = std::atomic<std::size_t>{0};
+        auto callback = zmq::ListenCallback::Factory(
+            [&](zmq::Message&) -> void { ++received; });
+        auto pullSockets = std::vector<OTZMQPullSocket>{};
+        auto pushSockets = std::vector<OTZMQPushSocket>{};
+        const auto before = thread_count();
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto endpoint = endpoint_ + "/" + std::to_string(i);
+            auto& pull = pullSockets.emplace_back(context_.PullSocket(
+                callback, zmq::socket::Socket::Direction::Bind, threading));
+
+            ASSERT_TRUE(pull->Start(endpoint));
+
+            auto& push = pushSockets.emplace_back(
+                context_.PushSocket(zmq::socket::Socket::Direction::Connect));
+
+            ASSERT_TRUE(push->Start(endpoint));
+        }
+
+        const auto after = thread_count();
+
+        // Shared sockets run on the reactor threads which the context
+        // started before the test
+        if (0 < before) {
+            const auto expected =
+                (zmq::socket::Socket::Threading::Shared == threading) ? 0u
+                                                                      : count;
+
+            EXPECT_EQ(after - before, expected);
+        }
+
+        for (auto& push : pushSockets) {
+            ASSERT_TRUE(push->Send(testMessage_));
+        }
+
+        auto end = std::time(nullptr) + 15;
+
+        while ((count > received) && (std::time(nullptr) < end)) {
+            Sleep(std::chrono::milliseconds(10));
+        }
+
+        EXPECT_EQ(received.load(), count);
+
+        // Each message must wake the thread which owns its socket without
+        // waiting for an unrelated event or a retry timeout
+        auto slowest = std::chrono::nanoseconds{};
+
+        for (auto& push : pushSockets) {
+            const auto target = received.load() + 1u;
+            const auto start = std::chrono::steady_clock::now();
+            const auto limit = start + std::chrono::seconds(5);
+
+            ASSERT_TRUE(push->Send(testMessage_));
+
+            while ((target > received) &&
+                   (std::chrono::steady_clock::now() < limit)) {
+                std::this_thread::yield();
+            }
+
+            ASSERT_EQ(received.load(), target);
+
+            slowest = std::max(
+                slowest,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start));
+        }
+
+        EXPECT_LT(slowest, std::chrono::seconds(1));
+
+        for (auto& pull : pullSockets) { pull->Close(); }
+    }
 };
 }  // namespace
 
@@ -104,3 +200,72 @@ TEST_F(Test_PushPull, Push_Pull)
 
     ASSERT_TRUE(callbackFinished);
 }
+
+TEST_F(Test_PushPull, Dedicated_Threads)
+{
+    receive_all(zmq::socket::Socket::Threading::Dedicated);
+}
+
+TEST_F(Test_PushPull, Shared_Threads)
+{
+    receive_all(zmq::socket::Socket::Threading::Shared);
+}
+
+TEST_F(Test_PushPull, Shared_Cross_Socket_Tasks)
+{
+    // Consecutive shared sockets are assigned to different reactor threads,
+    // so each callback waits for a task on the other thread
+    constexpr auto rounds = std::size_t{100};
+    auto finished = std::atomic<std::size_t>{0};
+    const zmq::socket::Pull* first{nullptr};
+    const zmq::socket::Pull* second{nullptr};
+    const auto configure = [&](const zmq::socket::Pull* socket) {
+        const auto set = socket->SetTimeouts(
+            std::chrono::milliseconds(0),
+            std::chrono::milliseconds(30000),
+            std::chrono::milliseconds(-1));
+
+        if (set) { ++finished; }
+    };
+    auto firstCallback = zmq::ListenCallback::Factory(
+        [&](zmq::Message&) -> void { configure(second); });
+    auto secondCallback = zmq::ListenCallback::Factory(
+        [&](zmq::Message&) -> void { configure(first); });
+    auto firstPull = context_.PullSocket(
+        firstCallback,
+        zmq::socket::Socket::Direction::Bind,
+        zmq::socket::Socket::Threading::Shared);
+    auto secondPull = context_.PullSocket(
+        secondCallback,
+        zmq::socket::Socket::Direction::Bind,
+        zmq::socket::Socket::Threading::Shared);
+    first = &firstPull.get();
+    second = &secondPull.get();
+
+    ASSERT_TRUE(firstPull->Start(endpoint_ + "/first"));
+    ASSERT_TRUE(secondPull->Start(endpoint_ + "/second"));
+
+    auto firstPush =
+        context_.PushSocket(zmq::socket::Socket::Direction::Connect);
+    auto secondPush =
+        context_.PushSocket(zmq::socket::Socket::Direction::Connect);
+
+    ASSERT_TRUE(firstPush->Start(endpoint_ + "/first"));
+    ASSERT_TRUE(secondPush->Start(endpoint_ + "/second"));
+
+    for (auto i = std::size_t{0}; i < rounds; ++i) {
+        ASSERT_TRUE(firstPush->Send(testMessage_));
+        ASSERT_TRUE(secondPush->Send(testMessage_));
+    }
+
+    auto end = std::time(nullptr) + 15;
+
+    while ((2 * rounds > finished) && (std::time(nullptr) < end)) {
+        Sleep(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(finished.load(), 2 * rounds);
+
+    firstPull->Close();
+    secondPull->Close();
+}
@@ -0,0 +1,213 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/SharedPimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Editor.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/client/OTX.hpp"
+#include "opentxs/api/server/Manager.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/PasswordPrompt.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/core/contract/ServerContract.hpp"
+#include "opentxs/core/contract/UnitDefinition.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/core/identifier/Server.hpp"
+#include "opentxs/core/identifier/UnitDefinition.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/otx/consensus/Server.hpp"
+#include "opentxs/protobuf/OTXEnums.pb.h"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr auto client_count_{4};
+constexpr auto duration_{std::chrono::seconds{5}};
+
+class Test_NotaryLoad : public ::testing::Test
+{
+public:
+    struct User {
+        const ot::api::client::Manager& api_;
+        ot::OTPasswordPrompt reason_;
+        ot::OTNymID nym_id_;
+        // Each user issues a unit so that its issuer account can send
+        // transfers without running out of funds
+        ot::OTUnitID unit_id_;
+
+        User(const int instance)
+            : api_(ot::Context().StartClient(
+                  OTTestEnvironment::test_args_,
+                  instance))
+            , reason_(api_.Factory().PasswordPrompt(__FUNCTION__))
+            , nym_id_(api_.Wallet()
+                          .Nym(reason_, "User " + std::to_string(instance))
+                          ->ID())
+            , unit_id_(api_.Wallet()
+                           .UnitDefinition(
+                               nym_id_->str(),
+                               "Unit " + std::to_string(instance),
+                               "YOLO",
+                               "dollars",
+                               "$",
+                               "USD",
+                               2,
+                               "cents",
+                               ot::proto::CITEMTYPE_USD,
+                               reason_)
+                           ->ID())
+        {
+        }
+    };
+
+    using Accounts = std::pair<ot::OTIdentifier, ot::OTIdentifier>;
+
+    static std::vector<std::unique_ptr<User>> users_;
+
+    // Reports the number of requests and transfers per second processed by a
+    // notary running the specified number of worker threads
+    void run(const int instance, const std::size_t workers)
+    {
+        auto args = OTTestEnvironment::test_args_;
+        args[OPENTXS_ARG_WORKERS] = {std::to_string(workers)};
+        const auto& server = ot::Context().StartServer(args, instance, true);
+        const auto& serverID = server.ID();
+        const auto contract = server.Wallet().Server(serverID);
+
+        auto accounts = std::vector<Accounts>{};
+
+        for (const auto& pUser : users_) {
+            const auto& user = *pUser;
+            user.api_.Wallet().Server(contract->PublicContract());
+            const auto registered =
+                user.api_.OTX().RegisterNym(user.nym_id_, serverID, true);
+
+            EXPECT_EQ(
+                ot::proto::LASTREPLYSTATUS_MESSAGESUCCESS,
+                registered.second.get().first);
+
+            const auto issued =
+                user.api_.OTX()
+                    .IssueUnitDefinition(user.nym_id_, serverID, user.unit_id_)
+                    .second.get();
+
+            ASSERT_EQ(ot::proto::LASTREPLYSTATUS_MESSAGESUCCESS, issued.first);
+            ASSERT_TRUE(issued.second);
+
+            const auto account =
+                user.api_.OTX()
+                    .RegisterAccount(user.nym_id_, serverID, user.unit_id_)
+                    .second.get();
+
+            ASSERT_EQ(
+                ot::proto::LASTREPLYSTATUS_MESSAGESUCCESS, account.first);
+            ASSERT_TRUE(account.second);
+
+            accounts.emplace_back(
+                ot::Identifier::Factory(issued.second->m_strAcctID),
+                ot::Identifier::Factory(account.second->m_strAcctID));
+        }
+
+        auto requests = std::atomic<std::size_t>{0};
+        auto transfers = std::atomic<std::size_t>{0};
+        auto failures = std::atomic<std::size_t>{0};
+        auto threads = std::vector<std::thread>{};
+        const auto start = Clock::now();
+
+        for (auto i = std::size_t{0}; i < users_.size(); ++i) {
+            threads.emplace_back(
+                [&, &user = *users_.at(i), &account = accounts.at(i)] {
+                    while ((Clock::now() - start) < duration_) {
+                        {
+                            auto context =
+                                user.api_.Wallet().mutable_ServerContext(
+                                    user.nym_id_, serverID, user.reason_);
+
+                            if (0 == context.get().UpdateRequestNumber(
+                                         user.reason_)) {
+                                ++failures;
+                            } else {
+                                ++requests;
+                            }
+                        }
+
+                        const auto sent = user.api_.OTX()
+                                              .SendTransfer(
+                                                  user.nym_id_,
+                                                  serverID,
+                                                  account.first,
+                                                  account.second,
+                                                  1,
+                                                  "load test")
+                                              .second.get();
+
+                        if (ot::proto::LASTREPLYSTATUS_MESSAGESUCCESS ==
+                            sent.first) {
+                            ++transfers;
+                        } else {
+                            ++failures;
+                        }
+                    }
+                });
+        }
+
+        for (auto& thread : threads) { thread.join(); }
+
+        const auto elapsed = std::chrono::duration_cast<
+            std::chrono::duration<double>>(Clock::now() - start);
+        std::cout << "Worker threads: " << workers << '\n'
+                  << "Client threads: " << users_.size() << '\n'
+                  << "Requests: " << requests.load() << '\n'
+                  << "Requests per second: "
+                  << (requests.load() / elapsed.count()) << '\n'
+                  << "Transfers: " << transfers.load() << '\n'
+                  << "Transfers per second: "
+                  << (transfers.load() / elapsed.count()) << std::endl;
+
+        EXPECT_EQ(failures.load(), 0);
+        EXPECT_GT(requests.load(), 0);
+        EXPECT_GT(transfers.load(), 0);
+    }
+
+    Test_NotaryLoad()
+    {
+        if (users_.empty()) {
+            for (auto i{0}; i < client_count_; ++i) {
+                users_.emplace_back(std::make_unique<User>(i));
+            }
+        }
+    }
+};
+
+std::vector<std::unique_ptr<Test_NotaryLoad::User>> Test_NotaryLoad::users_{};
+
+TEST_F(Test_NotaryLoad, single_worker) { run(0, 1); }
+
+TEST_F(Test_NotaryLoad, multiple_workers) { run(1, client_count_); }
+
+TEST_F(Test_NotaryLoad, cleanup) { users_.clear(); }
+}  // namespace
@@ -0,0 +1,197 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <sqlite3.h>
+}
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "2_Factory.hpp"
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/storage/Plugin.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "storage/StorageConfig.hpp"
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+class Test_StorageSqlite3 : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& client_;
+    const fs::path folder_;
+    ot::StorageConfig config_;
+    const ot::Digest digest_;
+    const ot::Random random_;
+    const ot::OTFlag bucket_;
+    std::unique_ptr<ot::api::storage::Plugin> driver_;
+
+    auto load(const std::string& key, std::string& value) const -> bool
+    {
+        return driver_->LoadFromBucket(key, value, false);
+    }
+    auto store(const std::string& key, const std::string& value) const -> bool
+    {
+        return driver_->Store(false, key, value, false);
+    }
+
+    Test_StorageSqlite3()
+        : client_(ot::Context().StartClient({}, 0))
+        , folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-sqlite3-%%%%-%%%%-%%%%-%%%%"))
+        , config_()
+        , digest_()
+        , random_()
+        , bucket_(ot::Flag::Factory(false))
+        , driver_()
+    {
+        fs::create_directories(folder_);
+        config_.path_ = folder_.string();
+        driver_.reset(ot::Factory::StorageSqlite3(
+            client_.Storage(), config_, digest_, random_, bucket_));
+    }
+    ~Test_StorageSqlite3() override
+    {
+        driver_.reset();
+        fs::remove_all(folder_);
+    }
+};
+
+TEST_F(Test_StorageSqlite3, exact_key)
+{
+    auto value = std::string{};
+
+    ASSERT_TRUE(store("ab", "first"));
+
+    // Keys are compared for equality rather than used as patterns
+    EXPECT_FALSE(load("a*", value));
+    EXPECT_FALSE(load("a?", value));
+    EXPECT_FALSE(load("[a]b", value));
+    EXPECT_FALSE(load("AB", value));
+
+    ASSERT_TRUE(store("a*", "second"));
+
+    EXPECT_TRUE(load("a*", value));
+    EXPECT_EQ(value, "second");
+    EXPECT_TRUE(load("ab", value));
+    EXPECT_EQ(value, "first");
+}
+
+TEST_F(Test_StorageSqlite3, rollback)
+{
+    const auto filename = (folder_ / config_.sqlite3_db_file_).string();
+    auto value = std::string{};
+    sqlite3* other{nullptr};
+
+    ASSERT_TRUE(driver_->StoreRoot(false, "root-1"));
+    ASSERT_EQ(
+        sqlite3_open_v2(
+            filename.c_str(), &other, SQLITE_OPEN_READWRITE, nullptr),
+        SQLITE_OK);
+    // Holding the write lock on another connection makes the commit fail
+    ASSERT_EQ(
+        sqlite3_exec(other, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr),
+        SQLITE_OK);
+    ASSERT_TRUE(driver_->Store(true, "pending", "lost", false));
+
+    EXPECT_FALSE(driver_->StoreRoot(true, "root-2"));
+    EXPECT_EQ(driver_->LoadRoot(), "root-1");
+    EXPECT_FALSE(load("pending", value));
+
+    ASSERT_EQ(
+        sqlite3_exec(other, "ROLLBACK;", nullptr, nullptr, nullptr),
+        SQLITE_OK);
+    ASSERT_EQ(sqlite3_close(other), SQLITE_OK);
+
+    // A transaction left open by the failed commit would prevent this one
+    // from starting
+    ASSERT_TRUE(driver_->Store(true, "pending", "saved", false));
+
+    EXPECT_TRUE(driver_->StoreRoot(true, "root-3"));
+    EXPECT_EQ(driver_->LoadRoot(), "root-3");
+    EXPECT_TRUE(load("pending", value));
+    EXPECT_EQ(value, "saved");
+}
+
+TEST_F(Test_StorageSqlite3, write_order)
+{
+    constexpr auto count = std::size_t{100};
+    auto promises = std::vector<std::promise<bool>>(count);
+    auto futures = std::vector<std::future<bool>>{};
+    auto value = std::string{};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        auto& promise = promises.at(i);
+        futures.emplace_back(promise.get_future());
+        driver_->Store(false, "key", std::to_string(i), false, promise);
+    }
+
+    for (auto& future : futures) { EXPECT_TRUE(future.get()); }
+
+    // Asynchronous writes to the same key are applied in the order they were
+    // submitted
+    EXPECT_TRUE(load("key", value));
+    EXPECT_EQ(value, std::to_string(count - 1u));
+
+    // A synchronous write is queued behind the asynchronous ones
+    auto promise = std::promise<bool>{};
+    auto future = promise.get_future();
+    driver_->Store(false, "key", "async", false, promise);
+
+    ASSERT_TRUE(store("key", "sync"));
+    EXPECT_TRUE(future.get());
+    EXPECT_TRUE(load("key", value));
+    EXPECT_EQ(value, "sync");
+}
+
+TEST_F(Test_StorageSqlite3, write_failure)
+{
+    const auto filename = (folder_ / config_.sqlite3_db_file_).string();
+    auto promise = std::promise<bool>{};
+    auto future = promise.get_future();
+    auto value = std::string{};
+    sqlite3* other{nullptr};
+
+    ASSERT_EQ(
+        sqlite3_open_v2(
+            filename.c_str(), &other, SQLITE_OPEN_READWRITE, nullptr),
+        SQLITE_OK);
+    ASSERT_EQ(
+        sqlite3_exec(other, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr),
+        SQLITE_OK);
+
+    driver_->Store(false, "failed", "value", false, promise);
+
+    EXPECT_FALSE(future.get());
+
+    ASSERT_EQ(
+        sqlite3_exec(other, "ROLLBACK;", nullptr, nullptr, nullptr),
+        SQLITE_OK);
+    ASSERT_EQ(sqlite3_close(other), SQLITE_OK);
+
+    // The failure is reported to the caller without stopping later writes
+    EXPECT_FALSE(load("failed", value));
+    EXPECT_TRUE(store("next", "value"));
+    EXPECT_TRUE(load("next", value));
+    EXPECT_EQ(value, "value");
+}
+}  // namespace